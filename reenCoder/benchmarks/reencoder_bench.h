@@ -0,0 +1,250 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../headers/reencoder_utf_8.h"
+#include "../headers/reencoder_utf_16.h"
+#include "../headers/reencoder_utf_32.h"
+
+#define _REENCODER_BENCH_MIN_SIZE 16
+#define _REENCODER_BENCH_DEFAULT_MAX_SIZE 16777216
+#define _REENCODER_BENCH_FULL_MAX_SIZE 268435456
+#define _REENCODER_BENCH_SIZE_STEP 16
+#define _REENCODER_BENCH_BYTES_PER_REPETITION 65536
+#define _REENCODER_BENCH_WARMUP_REPETITIONS 3
+#define _REENCODER_BENCH_MIN_REPETITIONS 5
+#define _REENCODER_BENCH_MAX_REPETITIONS 101
+#define _REENCODER_BENCH_TIME_BUDGET_NS 250000000ULL
+#define _REENCODER_BENCH_MAX_EXPANSION_PERCENT 300 // cap of the capped repair cases, the worst case of UTF-8 repair so it never fails
+
+// Hardware events counted around the timed calls, see `_ReencoderBenchCounters`
+#define _REENCODER_BENCH_COUNTER_CYCLES 0
+#define _REENCODER_BENCH_COUNTER_INSTRUCTIONS 1
+#define _REENCODER_BENCH_COUNTER_BRANCH_MISSES 2
+#define _REENCODER_BENCH_COUNTER_L1D_MISSES 3
+#define _REENCODER_BENCH_COUNTER_LLC_MISSES 4
+#define _REENCODER_BENCH_NUM_COUNTERS 5
+
+// glibc iconv (or any POSIX iconv) is used as the baseline converter wherever it exists
+#if !defined(_WIN32)
+#define _REENCODER_BENCH_HAS_ICONV 1
+#else
+#define _REENCODER_BENCH_HAS_ICONV 0
+#endif
+
+// Marker code point standing in for a malformed sequence, each encoding writes its own kind of malformation for it
+#define _REENCODER_BENCH_MALFORMED 0xFFFFFFFF
+
+/**
+ * @brief The same text in all three encodings, generated by `_reencoder_bench_corpus_create()`.
+ *
+ * Contains the corpus name (name), and the text as null-terminated UTF-8 (utf8), UTF-16 and UTF-32 in system endianness (utf16, utf32),
+ * each with its length in code units excluding the null-terminator.
+ * The UTF-16 and UTF-32 buffers can be passed to any source endianness, since the library reads them in system endianness.
+ */
+typedef struct {
+	const char* name;
+	uint8_t* utf8;
+	size_t utf8_units;
+	uint16_t* utf16;
+	size_t utf16_units;
+	uint32_t* utf32;
+	size_t utf32_units;
+} _ReencoderBenchCorpus;
+
+/**
+ * @brief One measured function, with optional untimed preparation around every repetition.
+ *
+ * setup runs before each repetition with the number of calls about to be made, run is the timed call, and teardown runs after each repetition.
+ * bytes_per_call is the input size throughput is reported against.
+ */
+typedef struct {
+	const char* function_name;
+	void (*setup)(void* arg, size_t calls);
+	void (*run)(void* arg);
+	void (*teardown)(void* arg);
+	void* arg;
+	size_t bytes_per_call;
+} _ReencoderBenchCase;
+
+/**
+ * @brief State handed to the measured library calls of the benchmark executable.
+ *
+ * Contains the corpus and encodings of the call, structs prepared by setup (structs, num_structs) along with the next one to be used (next_struct),
+ * an output buffer for functions that write into one (output), and a context for functions that take one (ctx).
+ */
+typedef struct {
+	const _ReencoderBenchCorpus* corpus;
+	enum ReencoderEncodeType source_encoding;
+	enum ReencoderEncodeType target_encoding;
+	ReencoderUnicodeStruct** structs;
+	size_t num_structs;
+	size_t next_struct;
+	uint8_t* output;
+	ReencoderContext* ctx;
+} _ReencoderBenchArgs;
+
+/**
+ * @brief Hardware performance counters read around every timed repetition.
+ *
+ * Contains one perf_event_open file descriptor per `_REENCODER_BENCH_COUNTER_*` event (fds), -1 for events that could not be opened,
+ * and whether at least one event is being counted (is_available).
+ * Counters only exist on Linux. Elsewhere, or where the kernel refuses access (see /proc/sys/kernel/perf_event_paranoid), is_available stays 0
+ * and results carry no counter values. Only user-space events of the calling thread are counted.
+ */
+typedef struct {
+	int fds[_REENCODER_BENCH_NUM_COUNTERS];
+	unsigned int is_available;
+} _ReencoderBenchCounters;
+
+/**
+ * @brief Summary of one measured case.
+ *
+ * events_per_byte holds every `_REENCODER_BENCH_COUNTER_*` event averaged over all timed bytes, or -1.0 if that event was not counted.
+ */
+typedef struct {
+	size_t repetitions;
+	size_t calls_per_repetition;
+	double median_ns;
+	double p99_ns;
+	double gb_per_s;
+	double events_per_byte[_REENCODER_BENCH_NUM_COUNTERS];
+} _ReencoderBenchResult;
+
+/**
+ * @brief Names of the generated corpora, in the order they are run.
+ *
+ * Corpora from all-ff onwards are adversarial: a short worst-case pattern repeated over and over.
+ * Their three encodings hold the closest equivalent malformation of each encoding rather than the same text.
+ */
+static const char* _REENCODER_BENCH_CORPUS_NAMES[] = {
+	"ascii",
+	"latin",
+	"cyrillic",
+	"cjk",
+	"emoji",
+	"mixed",
+	"malformed",
+	"all-ff",
+	"lone-surrogates",
+	"truncated",
+	"overlong"
+};
+#define _REENCODER_BENCH_FIRST_ADVERSARIAL_CORPUS 7
+#define _REENCODER_BENCH_NUM_CORPORA (sizeof(_REENCODER_BENCH_CORPUS_NAMES) / sizeof(_REENCODER_BENCH_CORPUS_NAMES[0]))
+
+/**
+ * @brief Generates a corpus of roughly utf8_bytes bytes of UTF-8, and the same text in UTF-16 and UTF-32.
+ *
+ * Text is pseudo-random but reproducible, and never contains U+0000.
+ *
+ * @param[in] name One of `_REENCODER_BENCH_CORPUS_NAMES`.
+ * @param[in] utf8_bytes Target size of the UTF-8 text. The text ends on a character boundary at or just below this size.
+ *
+ * @return Pointer to a `_ReencoderBenchCorpus`.
+ * @retval NULL If memory allocation fails or name is unknown.
+ */
+_ReencoderBenchCorpus* _reencoder_bench_corpus_create(const char* name, size_t utf8_bytes);
+
+/**
+ * @brief Frees a corpus and its buffers.
+ *
+ * @param[in] corpus Address of the pointer to the corpus to be freed.
+ */
+void _reencoder_bench_corpus_free(_ReencoderBenchCorpus** corpus);
+
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ */
+uint64_t _reencoder_bench_now_ns(void);
+
+/**
+ * @brief Opens the hardware performance counters of the calling thread.
+ *
+ * Events the CPU or kernel does not support are skipped, the rest are still counted.
+ *
+ * @param[out] counters Pointer to the counters to be opened.
+ *
+ * @return 1 if at least one event is being counted, 0 otherwise.
+ */
+unsigned int _reencoder_bench_counters_open(_ReencoderBenchCounters* counters);
+
+/**
+ * @brief Resets and starts every opened counter.
+ *
+ * @param[in] counters Pointer to opened counters. Can be NULL.
+ */
+void _reencoder_bench_counters_start(_ReencoderBenchCounters* counters);
+
+/**
+ * @brief Stops every opened counter and reads its value.
+ *
+ * Values are scaled up if the kernel had to multiplex more events than the CPU has counters.
+ *
+ * @param[in] counters Pointer to opened counters. Can be NULL.
+ * @param[out] values Array of _REENCODER_BENCH_NUM_COUNTERS values, set to 0 for events that are not counted.
+ */
+void _reencoder_bench_counters_stop(_ReencoderBenchCounters* counters, uint64_t* values);
+
+/**
+ * @brief Closes every opened counter.
+ *
+ * @param[in] counters Pointer to opened counters.
+ */
+void _reencoder_bench_counters_close(_ReencoderBenchCounters* counters);
+
+/**
+ * @brief Measures a case: warms it up, then times repetitions of several calls each until the time budget is spent.
+ *
+ * Calls per repetition are chosen so that each repetition covers about _REENCODER_BENCH_BYTES_PER_REPETITION bytes,
+ * which keeps timer resolution out of the results for small inputs.
+ * Hardware events are summed over every timed repetition, setup and teardown are never counted.
+ *
+ * @param[in] bench_case Case to be measured.
+ * @param[in] counters Opened hardware counters, or NULL to only measure time.
+ * @param[out] result Pointer to where the summary will be stored.
+ */
+void _reencoder_bench_measure(const _ReencoderBenchCase* bench_case, _ReencoderBenchCounters* counters, _ReencoderBenchResult* result);
+
+/**
+ * @brief Prints the header row of the results table.
+ *
+ * @param[in] csv 1 to print comma-separated values, 0 to print an aligned table.
+ */
+void _reencoder_bench_print_header(unsigned int csv);
+
+/**
+ * @brief Prints one row of the results table.
+ *
+ * @param[in] csv 1 to print comma-separated values, 0 to print an aligned table.
+ * @param[in] function_name Name of the measured function.
+ * @param[in] corpus_name Name of the corpus.
+ * @param[in] bytes Input size in bytes.
+ * @param[in] result Summary to be printed.
+ */
+void _reencoder_bench_print_row(unsigned int csv, const char* function_name, const char* corpus_name, size_t bytes, const _ReencoderBenchResult* result);
+
+/**
+ * @brief Runs every conversion between system-endian sources and all targets through both `reencoder_convert()` and iconv, printing their throughput side by side.
+ *
+ * Before timing, each pair is converted once by both and their outputs are compared byte for byte.
+ * A pair where both converters reject the input counts as matching.
+ * Does nothing if _REENCODER_BENCH_HAS_ICONV is 0.
+ *
+ * @param[in] corpus Corpus to be converted.
+ * @param[in] function_filter Only run pairs whose name contains this substring. NULL runs every pair.
+ * @param[in] csv 1 to print comma-separated values, 0 to print an aligned table.
+ *
+ * @return Number of pairs whose outputs differ.
+ */
+size_t _reencoder_bench_compare_iconv(const _ReencoderBenchCorpus* corpus, const char* function_filter, unsigned int csv);
+
+/**
+ * @brief Prints the header row of the iconv comparison table.
+ *
+ * @param[in] csv 1 to print comma-separated values, 0 to print an aligned table.
+ */
+void _reencoder_bench_print_iconv_header(unsigned int csv);
@@ -0,0 +1,229 @@
+#include "reencoder_bench.h"
+
+/**
+ * @brief Worst-case pattern an adversarial corpus repeats, in each encoding.
+ *
+ * Every encoding repeats its pattern the same number of times. UTF-16 and UTF-32 patterns are never longer (in code units) than the UTF-8 pattern.
+ */
+typedef struct {
+	const uint8_t* utf8;
+	size_t utf8_units;
+	const uint16_t* utf16;
+	size_t utf16_units;
+	const uint32_t* utf32;
+	size_t utf32_units;
+} _ReencoderBenchPattern;
+
+// all-ff: every unit is an error on its own (invalid lead byte / lone low surrogate / out of range)
+static const uint8_t _REENCODER_BENCH_ALL_FF_UTF8[] = { 0xFF };
+static const uint16_t _REENCODER_BENCH_ALL_FF_UTF16[] = { 0xDFFF };
+static const uint32_t _REENCODER_BENCH_ALL_FF_UTF32[] = { 0xFFFFFFFF };
+
+// lone-surrogates: high and low surrogates that never pair up, separated by spaces (encoded surrogates in UTF-8)
+static const uint8_t _REENCODER_BENCH_LONE_SURROGATES_UTF8[] = { 0xED, 0xA0, 0x80, 0x20, 0xED, 0xB0, 0x80, 0x20 };
+static const uint16_t _REENCODER_BENCH_LONE_SURROGATES_UTF16[] = { 0xD800, 0x0020, 0xDC00, 0x0020 };
+static const uint32_t _REENCODER_BENCH_LONE_SURROGATES_UTF32[] = { 0x0000D800, 0x00000020, 0x0000DC00, 0x00000020 };
+
+// truncated: U+1F600 cut off after every possible byte, each followed by 'A' (a high surrogate missing its low half in UTF-16)
+static const uint8_t _REENCODER_BENCH_TRUNCATED_UTF8[] = { 0xF0, 0x41, 0xF0, 0x9F, 0x41, 0xF0, 0x9F, 0x98, 0x41 };
+static const uint16_t _REENCODER_BENCH_TRUNCATED_UTF16[] = { 0xD83D, 0x0041 };
+static const uint32_t _REENCODER_BENCH_TRUNCATED_UTF32[] = { 0x0001F600, 0x00110000, 0x00000041 };
+
+// overlong: '/' encoded in 2, 3 and 4 bytes (UTF-16 and UTF-32 have no overlong forms, they use out of range and unpaired units instead)
+static const uint8_t _REENCODER_BENCH_OVERLONG_UTF8[] = { 0xC0, 0xAF, 0xE0, 0x80, 0xAF, 0xF0, 0x80, 0x80, 0xAF };
+static const uint16_t _REENCODER_BENCH_OVERLONG_UTF16[] = { 0xDC00, 0x002F, 0xDBFF };
+static const uint32_t _REENCODER_BENCH_OVERLONG_UTF32[] = { 0x00110000, 0x0000002F, 0x0000DFFF };
+
+static const _ReencoderBenchPattern _REENCODER_BENCH_PATTERNS[] = {
+	{ _REENCODER_BENCH_ALL_FF_UTF8, 1, _REENCODER_BENCH_ALL_FF_UTF16, 1, _REENCODER_BENCH_ALL_FF_UTF32, 1 },
+	{ _REENCODER_BENCH_LONE_SURROGATES_UTF8, 8, _REENCODER_BENCH_LONE_SURROGATES_UTF16, 4, _REENCODER_BENCH_LONE_SURROGATES_UTF32, 4 },
+	{ _REENCODER_BENCH_TRUNCATED_UTF8, 9, _REENCODER_BENCH_TRUNCATED_UTF16, 2, _REENCODER_BENCH_TRUNCATED_UTF32, 3 },
+	{ _REENCODER_BENCH_OVERLONG_UTF8, 9, _REENCODER_BENCH_OVERLONG_UTF16, 3, _REENCODER_BENCH_OVERLONG_UTF32, 3 }
+};
+
+/**
+ * @brief Fills a corpus by repeating an adversarial pattern for as long as the UTF-8 text fits in utf8_bytes.
+ *
+ * @param[in,out] corpus Corpus with empty buffers of at least utf8_bytes + 1 code units each.
+ * @param[in] pattern Pattern to be repeated.
+ * @param[in] utf8_bytes Target size of the UTF-8 text.
+ */
+static void _reencoder_bench_fill_pattern(_ReencoderBenchCorpus* corpus, const _ReencoderBenchPattern* pattern, size_t utf8_bytes);
+
+/**
+ * @brief Advances a xorshift64 state and returns the next pseudo-random value.
+ *
+ * @param[in,out] state Pointer to the generator state. Must not be 0.
+ *
+ * @return Next pseudo-random value.
+ */
+static uint64_t _reencoder_bench_random(uint64_t* state);
+
+/**
+ * @brief Picks the next code point of a corpus.
+ *
+ * @param[in] corpus_index Index of the corpus in `_REENCODER_BENCH_CORPUS_NAMES`.
+ * @param[in,out] state Pointer to the generator state.
+ *
+ * @return Next code point, or _REENCODER_BENCH_MALFORMED.
+ */
+static uint32_t _reencoder_bench_next_code_point(size_t corpus_index, uint64_t* state);
+
+/**
+ * @brief Returns how many UTF-8 bytes a code point (or malformation) takes up in a corpus.
+ *
+ * @param[in] code_point Code point, or _REENCODER_BENCH_MALFORMED.
+ * @param[in] malformation Kind of malformation, only used for _REENCODER_BENCH_MALFORMED.
+ *
+ * @return Number of UTF-8 bytes.
+ */
+static size_t _reencoder_bench_utf8_length(uint32_t code_point, unsigned int malformation);
+
+_ReencoderBenchCorpus* _reencoder_bench_corpus_create(const char* name, size_t utf8_bytes) {
+	size_t corpus_index = 0;
+	while (corpus_index < _REENCODER_BENCH_NUM_CORPORA && strcmp(name, _REENCODER_BENCH_CORPUS_NAMES[corpus_index]) != 0) {
+		corpus_index++;
+	}
+	if (corpus_index == _REENCODER_BENCH_NUM_CORPORA) {
+		return NULL;
+	}
+
+	_ReencoderBenchCorpus* corpus = (_ReencoderBenchCorpus*)malloc(sizeof(_ReencoderBenchCorpus));
+	if (corpus == NULL) {
+		return NULL;
+	}
+
+	// every character takes at least as many UTF-8 bytes as UTF-16 or UTF-32 units, so utf8_bytes units is always enough
+	corpus->name = _REENCODER_BENCH_CORPUS_NAMES[corpus_index];
+	corpus->utf8 = (uint8_t*)malloc(utf8_bytes + 1);
+	corpus->utf16 = (uint16_t*)malloc((utf8_bytes + 1) * sizeof(uint16_t));
+	corpus->utf32 = (uint32_t*)malloc((utf8_bytes + 1) * sizeof(uint32_t));
+	corpus->utf8_units = 0;
+	corpus->utf16_units = 0;
+	corpus->utf32_units = 0;
+	if (corpus->utf8 == NULL || corpus->utf16 == NULL || corpus->utf32 == NULL) {
+		_reencoder_bench_corpus_free(&corpus);
+		return NULL;
+	}
+
+	if (corpus_index >= _REENCODER_BENCH_FIRST_ADVERSARIAL_CORPUS) {
+		_reencoder_bench_fill_pattern(corpus, &_REENCODER_BENCH_PATTERNS[corpus_index - _REENCODER_BENCH_FIRST_ADVERSARIAL_CORPUS], utf8_bytes);
+		return corpus;
+	}
+
+	// same seed for every size, so a smaller corpus is a prefix of a larger one
+	uint64_t state = 0x9E3779B97F4A7C15ULL + corpus_index;
+	for (;;) {
+		uint32_t code_point = _reencoder_bench_next_code_point(corpus_index, &state);
+		unsigned int malformation = (unsigned int)(_reencoder_bench_random(&state) % 3);
+		if (corpus->utf8_units + _reencoder_bench_utf8_length(code_point, malformation) > utf8_bytes) {
+			break;
+		}
+
+		if (code_point != _REENCODER_BENCH_MALFORMED) {
+			corpus->utf8_units += _reencoder_utf8_encode_from_code_point(corpus->utf8, corpus->utf8_units, code_point);
+			corpus->utf16_units += _reencoder_utf16_encode_from_code_point(corpus->utf16, corpus->utf16_units, code_point);
+			corpus->utf32_units += _reencoder_utf32_encode_from_code_point(corpus->utf32, corpus->utf32_units, code_point);
+			continue;
+		}
+
+		// invalid lead byte / lone high surrogate / surrogate code point
+		if (malformation == 0) {
+			corpus->utf8[corpus->utf8_units++] = 0xFF;
+			corpus->utf16[corpus->utf16_units++] = 0xD83D;
+			corpus->utf32[corpus->utf32_units++] = 0x0000D800;
+		}
+		// lone continuation byte / lone low surrogate / out of range
+		else if (malformation == 1) {
+			corpus->utf8[corpus->utf8_units++] = 0x80;
+			corpus->utf16[corpus->utf16_units++] = 0xDC00;
+			corpus->utf32[corpus->utf32_units++] = 0x00110000;
+		}
+		// truncated 3-byte sequence, followed by a space so that the next character cannot complete it
+		else {
+			corpus->utf8[corpus->utf8_units++] = 0xE2;
+			corpus->utf8[corpus->utf8_units++] = 0x82;
+			corpus->utf8[corpus->utf8_units++] = 0x20;
+			corpus->utf16[corpus->utf16_units++] = 0xD83D;
+			corpus->utf16[corpus->utf16_units++] = 0x0020;
+			corpus->utf32[corpus->utf32_units++] = 0x7FFFFFFF;
+			corpus->utf32[corpus->utf32_units++] = 0x00000020;
+		}
+	}
+
+	corpus->utf8[corpus->utf8_units] = 0x00;
+	corpus->utf16[corpus->utf16_units] = 0x0000;
+	corpus->utf32[corpus->utf32_units] = 0x00000000;
+
+	return corpus;
+}
+
+void _reencoder_bench_corpus_free(_ReencoderBenchCorpus** corpus) {
+	if (corpus == NULL || *corpus == NULL) {
+		return;
+	}
+
+	free((*corpus)->utf8);
+	free((*corpus)->utf16);
+	free((*corpus)->utf32);
+	free(*corpus);
+
+	*corpus = NULL;
+}
+
+static void _reencoder_bench_fill_pattern(_ReencoderBenchCorpus* corpus, const _ReencoderBenchPattern* pattern, size_t utf8_bytes) {
+	while (corpus->utf8_units + pattern->utf8_units <= utf8_bytes) {
+		memcpy(corpus->utf8 + corpus->utf8_units, pattern->utf8, pattern->utf8_units * sizeof(uint8_t));
+		memcpy(corpus->utf16 + corpus->utf16_units, pattern->utf16, pattern->utf16_units * sizeof(uint16_t));
+		memcpy(corpus->utf32 + corpus->utf32_units, pattern->utf32, pattern->utf32_units * sizeof(uint32_t));
+		corpus->utf8_units += pattern->utf8_units;
+		corpus->utf16_units += pattern->utf16_units;
+		corpus->utf32_units += pattern->utf32_units;
+	}
+
+	corpus->utf8[corpus->utf8_units] = 0x00;
+	corpus->utf16[corpus->utf16_units] = 0x0000;
+	corpus->utf32[corpus->utf32_units] = 0x00000000;
+}
+
+static uint64_t _reencoder_bench_random(uint64_t* state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+
+	return *state;
+}
+
+static uint32_t _reencoder_bench_next_code_point(size_t corpus_index, uint64_t* state) {
+	uint64_t random = _reencoder_bench_random(state);
+
+	// mixed picks one of the single-script corpora per character, malformed does the same with 1 in 16 characters broken
+	if (corpus_index == 5 || corpus_index == 6) {
+		if (corpus_index == 6 && random % 16 == 0) {
+			return _REENCODER_BENCH_MALFORMED;
+		}
+		corpus_index = (size_t)((random >> 8) % 5);
+		random = _reencoder_bench_random(state);
+	}
+
+	switch (corpus_index) {
+	case 0: // ascii: printable text with line breaks
+		return random % 64 == 0 ? 0x0A : (uint32_t)(0x20 + ((random >> 8) % 95));
+	case 1: // latin: mostly ASCII letters with Latin-1 accented letters
+		return random % 10 < 6 ? (uint32_t)(0x61 + ((random >> 8) % 26)) : (uint32_t)(0xC0 + ((random >> 8) % 64));
+	case 2: // cyrillic: 2-byte letters separated by spaces
+		return random % 6 == 0 ? 0x20 : (uint32_t)(0x0410 + ((random >> 8) % 64));
+	case 3: // cjk: 3-byte ideographs with ideographic commas
+		return random % 12 == 0 ? 0x3001 : (uint32_t)(0x4E00 + ((random >> 8) % 0x5200));
+	default: // emoji: 4-byte characters (surrogate pairs in UTF-16) separated by spaces
+		return random % 3 == 0 ? 0x20 : (uint32_t)(0x1F300 + ((random >> 8) % 0x350));
+	}
+}
+
+static size_t _reencoder_bench_utf8_length(uint32_t code_point, unsigned int malformation) {
+	if (code_point == _REENCODER_BENCH_MALFORMED) {
+		return malformation == 2 ? 3 : 1;
+	}
+
+	return code_point < 0x80 ? 1 : code_point < 0x800 ? 2 : code_point < 0x10000 ? 3 : 4;
+}
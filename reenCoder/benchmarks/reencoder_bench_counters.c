@@ -0,0 +1,127 @@
+// syscall() is not declared under ISO C, it needs the GNU (or default) feature set requested before the first system header is included
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "reencoder_bench.h"
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+/**
+ * @brief Opens one user-space hardware event of the calling thread, initially disabled.
+ *
+ * @param[in] type perf_event_attr type (PERF_TYPE_HARDWARE or PERF_TYPE_HW_CACHE).
+ * @param[in] config perf_event_attr config of the event.
+ *
+ * @return File descriptor of the event.
+ * @retval -1 If the event could not be opened.
+ */
+static int _reencoder_bench_counter_open(uint32_t type, uint64_t config);
+#endif
+
+unsigned int _reencoder_bench_counters_open(_ReencoderBenchCounters* counters) {
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		counters->fds[i] = -1;
+	}
+	counters->is_available = 0;
+
+#if defined(__linux__)
+	counters->fds[_REENCODER_BENCH_COUNTER_CYCLES] = _reencoder_bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+	counters->fds[_REENCODER_BENCH_COUNTER_INSTRUCTIONS] = _reencoder_bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+	counters->fds[_REENCODER_BENCH_COUNTER_BRANCH_MISSES] = _reencoder_bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+	counters->fds[_REENCODER_BENCH_COUNTER_L1D_MISSES] = _reencoder_bench_counter_open(PERF_TYPE_HW_CACHE,
+		PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+	counters->fds[_REENCODER_BENCH_COUNTER_LLC_MISSES] = _reencoder_bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		if (counters->fds[i] != -1) {
+			counters->is_available = 1;
+		}
+	}
+#endif
+
+	return counters->is_available;
+}
+
+void _reencoder_bench_counters_start(_ReencoderBenchCounters* counters) {
+	if (counters == NULL || !counters->is_available) {
+		return;
+	}
+
+#if defined(__linux__)
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		if (counters->fds[i] != -1) {
+			ioctl(counters->fds[i], PERF_EVENT_IOC_RESET, 0);
+			ioctl(counters->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+#endif
+}
+
+void _reencoder_bench_counters_stop(_ReencoderBenchCounters* counters, uint64_t* values) {
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		values[i] = 0;
+	}
+
+	if (counters == NULL || !counters->is_available) {
+		return;
+	}
+
+#if defined(__linux__)
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		if (counters->fds[i] != -1) {
+			ioctl(counters->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+		}
+	}
+
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		// value, time enabled, time running (PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING)
+		uint64_t reading[3];
+		if (counters->fds[i] == -1 || read(counters->fds[i], reading, sizeof(reading)) != (ssize_t)sizeof(reading) || reading[2] == 0) {
+			continue;
+		}
+
+		// the event only ran for part of the time if the kernel multiplexed it, extrapolate to the whole run
+		values[i] = reading[2] < reading[1] ? (uint64_t)((double)reading[0] * (double)reading[1] / (double)reading[2]) : reading[0];
+	}
+#endif
+}
+
+void _reencoder_bench_counters_close(_ReencoderBenchCounters* counters) {
+#if defined(__linux__)
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		if (counters->fds[i] != -1) {
+			close(counters->fds[i]);
+		}
+	}
+#endif
+
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		counters->fds[i] = -1;
+	}
+	counters->is_available = 0;
+}
+
+#if defined(__linux__)
+static int _reencoder_bench_counter_open(uint32_t type, uint64_t config) {
+	struct perf_event_attr attr;
+	memset(&attr, 0x00, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+	// calling thread only (pid 0), on any CPU (-1), no group (-1)
+	long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+
+	return fd < 0 ? -1 : (int)fd;
+}
+#endif
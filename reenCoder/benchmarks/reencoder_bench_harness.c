@@ -0,0 +1,170 @@
+// clock_gettime() and CLOCK_MONOTONIC are POSIX, not ISO C, so they must be requested before the first system header is included
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "reencoder_bench.h"
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+/**
+ * @brief Runs one repetition of a case: setup, calls timed runs, teardown.
+ *
+ * @param[in] bench_case Case to be run.
+ * @param[in] calls Number of timed calls.
+ * @param[in] counters Opened hardware counters, or NULL.
+ * @param[in,out] event_totals Array of _REENCODER_BENCH_NUM_COUNTERS totals the events of the calls are added to. Can be NULL.
+ *
+ * @return Time taken by the calls, in nanoseconds.
+ */
+static uint64_t _reencoder_bench_repetition(const _ReencoderBenchCase* bench_case, size_t calls, _ReencoderBenchCounters* counters, uint64_t* event_totals);
+
+/**
+ * @brief Prints one counter value per byte scaled by multiplier, or a placeholder if the event was not counted.
+ */
+static void _reencoder_bench_print_event(unsigned int csv, double events_per_byte, double multiplier, int width);
+
+/**
+ * @brief qsort comparator for doubles, ascending.
+ */
+static int _reencoder_bench_compare_double(const void* a, const void* b);
+
+uint64_t _reencoder_bench_now_ns(void) {
+#if defined(_WIN32)
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (uint64_t)(((double)counter.QuadPart * 1e9) / (double)frequency.QuadPart);
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+#endif
+}
+
+void _reencoder_bench_measure(const _ReencoderBenchCase* bench_case, _ReencoderBenchCounters* counters, _ReencoderBenchResult* result) {
+	size_t calls = bench_case->bytes_per_call == 0 ? _REENCODER_BENCH_BYTES_PER_REPETITION : _REENCODER_BENCH_BYTES_PER_REPETITION / bench_case->bytes_per_call;
+	if (calls == 0) {
+		calls = 1;
+	}
+
+	// warm caches, branch predictors and the allocator, but do not spend more than the budget on huge inputs
+	uint64_t warmup_start = _reencoder_bench_now_ns();
+	for (size_t i = 0; i < _REENCODER_BENCH_WARMUP_REPETITIONS && _reencoder_bench_now_ns() - warmup_start < _REENCODER_BENCH_TIME_BUDGET_NS; i++) {
+		_reencoder_bench_repetition(bench_case, calls, NULL, NULL);
+	}
+
+	double samples[_REENCODER_BENCH_MAX_REPETITIONS];
+	uint64_t event_totals[_REENCODER_BENCH_NUM_COUNTERS] = { 0 };
+	size_t repetitions = 0;
+	uint64_t measure_start = _reencoder_bench_now_ns();
+	while (repetitions < _REENCODER_BENCH_MAX_REPETITIONS &&
+		(repetitions < _REENCODER_BENCH_MIN_REPETITIONS || _reencoder_bench_now_ns() - measure_start < _REENCODER_BENCH_TIME_BUDGET_NS)) {
+		samples[repetitions++] = (double)_reencoder_bench_repetition(bench_case, calls, counters, event_totals) / (double)calls;
+	}
+
+	qsort(samples, repetitions, sizeof(double), _reencoder_bench_compare_double);
+
+	// nearest-rank percentiles
+	result->repetitions = repetitions;
+	result->calls_per_repetition = calls;
+	result->median_ns = samples[(repetitions - 1) / 2];
+	result->p99_ns = samples[((repetitions * 99) + 99) / 100 - 1];
+	result->gb_per_s = result->median_ns > 0.0 ? (double)bench_case->bytes_per_call / result->median_ns : 0.0;
+
+	double total_bytes = (double)repetitions * (double)calls * (double)bench_case->bytes_per_call;
+	for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+		unsigned int is_counted = counters != NULL && counters->fds[i] != -1 && total_bytes > 0.0;
+		result->events_per_byte[i] = is_counted ? (double)event_totals[i] / total_bytes : -1.0;
+	}
+}
+
+void _reencoder_bench_print_header(unsigned int csv) {
+	if (csv) {
+		printf("function,corpus,bytes,median_ns_per_call,p99_ns_per_call,gb_per_s,repetitions,calls_per_repetition,");
+		printf("cycles_per_byte,instructions_per_cycle,branch_misses_per_kb,l1d_misses_per_kb,llc_misses_per_kb\n");
+		return;
+	}
+
+	printf("%-32s %-10s %12s %16s %16s %10s", "function", "corpus", "bytes", "median ns/call", "p99 ns/call", "GB/s");
+	printf(" %9s %6s %10s %10s %11s\n", "cycles/B", "IPC", "br-miss/KB", "L1-miss/KB", "LLC-miss/KB");
+}
+
+void _reencoder_bench_print_row(unsigned int csv, const char* function_name, const char* corpus_name, size_t bytes, const _ReencoderBenchResult* result) {
+	if (csv) {
+		printf("%s,%s,%zu,%.1f,%.1f,%.3f,%zu,%zu",
+			function_name, corpus_name, bytes, result->median_ns, result->p99_ns, result->gb_per_s, result->repetitions, result->calls_per_repetition
+		);
+	}
+	else {
+		printf("%-32s %-10s %12zu %16.1f %16.1f %10.3f", function_name, corpus_name, bytes, result->median_ns, result->p99_ns, result->gb_per_s);
+	}
+
+	double cycles = result->events_per_byte[_REENCODER_BENCH_COUNTER_CYCLES];
+	double instructions = result->events_per_byte[_REENCODER_BENCH_COUNTER_INSTRUCTIONS];
+	double instructions_per_cycle = cycles > 0.0 && instructions >= 0.0 ? instructions / cycles : -1.0;
+
+	_reencoder_bench_print_event(csv, cycles, 1.0, 9);
+	_reencoder_bench_print_event(csv, instructions_per_cycle, 1.0, 6);
+	_reencoder_bench_print_event(csv, result->events_per_byte[_REENCODER_BENCH_COUNTER_BRANCH_MISSES], 1024.0, 10);
+	_reencoder_bench_print_event(csv, result->events_per_byte[_REENCODER_BENCH_COUNTER_L1D_MISSES], 1024.0, 10);
+	_reencoder_bench_print_event(csv, result->events_per_byte[_REENCODER_BENCH_COUNTER_LLC_MISSES], 1024.0, 11);
+	printf("\n");
+}
+
+static uint64_t _reencoder_bench_repetition(const _ReencoderBenchCase* bench_case, size_t calls, _ReencoderBenchCounters* counters, uint64_t* event_totals) {
+	if (bench_case->setup != NULL) {
+		bench_case->setup(bench_case->arg, calls);
+	}
+
+	uint64_t events[_REENCODER_BENCH_NUM_COUNTERS];
+	_reencoder_bench_counters_start(counters);
+	uint64_t start = _reencoder_bench_now_ns();
+	for (size_t i = 0; i < calls; i++) {
+		bench_case->run(bench_case->arg);
+	}
+	uint64_t elapsed = _reencoder_bench_now_ns() - start;
+	_reencoder_bench_counters_stop(counters, events);
+
+	if (event_totals != NULL) {
+		for (size_t i = 0; i < _REENCODER_BENCH_NUM_COUNTERS; i++) {
+			event_totals[i] += events[i];
+		}
+	}
+
+	if (bench_case->teardown != NULL) {
+		bench_case->teardown(bench_case->arg);
+	}
+
+	return elapsed;
+}
+
+static int _reencoder_bench_compare_double(const void* a, const void* b) {
+	double value_a = *(const double*)a;
+	double value_b = *(const double*)b;
+
+	return (value_a > value_b) - (value_a < value_b);
+}
+
+static void _reencoder_bench_print_event(unsigned int csv, double events_per_byte, double multiplier, int width) {
+	if (csv) {
+		if (events_per_byte >= 0.0) {
+			printf(",%.3f", events_per_byte * multiplier);
+		}
+		else {
+			printf(",");
+		}
+		return;
+	}
+
+	if (events_per_byte >= 0.0) {
+		printf(" %*.3f", width, events_per_byte * multiplier);
+	}
+	else {
+		printf(" %*s", width, "-");
+	}
+}
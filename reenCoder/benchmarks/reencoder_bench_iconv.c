@@ -0,0 +1,211 @@
+#include "reencoder_bench.h"
+#if _REENCODER_BENCH_HAS_ICONV
+#include <iconv.h>
+#include <errno.h>
+
+/**
+ * @brief State handed to the measured calls of an iconv comparison.
+ *
+ * Contains the source text (source, source_bytes), both encodings, an open iconv descriptor for them (descriptor),
+ * and an output buffer large enough for any conversion of the source (output, output_bytes).
+ */
+typedef struct {
+	const void* source;
+	size_t source_bytes;
+	enum ReencoderEncodeType source_encoding;
+	enum ReencoderEncodeType target_encoding;
+	iconv_t descriptor;
+	uint8_t* output;
+	size_t output_bytes;
+} _ReencoderBenchIconvArgs;
+
+/**
+ * @brief Converts the source once with iconv into the output buffer.
+ *
+ * @param[in] args Comparison state.
+ *
+ * @return Number of bytes written to the output buffer.
+ * @retval SIZE_MAX If iconv rejected the source.
+ */
+static size_t _reencoder_bench_iconv_convert(_ReencoderBenchIconvArgs* args);
+
+/**
+ * @brief Checks that `reencoder_convert()` and iconv produce the same output for a pair.
+ *
+ * @param[in] args Comparison state. Its output buffer is overwritten.
+ *
+ * @return Human-readable verdict: "equal", "both reject", "DIFFERENT", "ONLY ICONV REJECTS" or "ONLY REENCODER REJECTS".
+ */
+static const char* _reencoder_bench_iconv_verdict(_ReencoderBenchIconvArgs* args);
+
+// Measured calls, matching `_ReencoderBenchCase.run`
+static void _reencoder_bench_run_iconv(void* arg);
+static void _reencoder_bench_run_reencoder(void* arg);
+#endif
+
+size_t _reencoder_bench_compare_iconv(const _ReencoderBenchCorpus* corpus, const char* function_filter, unsigned int csv) {
+#if _REENCODER_BENCH_HAS_ICONV
+	unsigned int is_little_endian = reencoder_is_system_little_endian();
+	enum ReencoderEncodeType sources[] = { UTF_8, is_little_endian ? UTF_16LE : UTF_16BE, is_little_endian ? UTF_32LE : UTF_32BE };
+	const void* source_buffers[] = { corpus->utf8, corpus->utf16, corpus->utf32 };
+	size_t source_sizes[] = { corpus->utf8_units, corpus->utf16_units * sizeof(uint16_t), corpus->utf32_units * sizeof(uint32_t) };
+
+	_ReencoderBenchIconvArgs args;
+	// every encoding needs at most 4 bytes per character, and UTF-32 holds exactly one code unit per character
+	args.output_bytes = (corpus->utf32_units + 1) * sizeof(uint32_t);
+	args.output = (uint8_t*)malloc(args.output_bytes);
+	if (args.output == NULL) {
+		fprintf(stderr, "Out of memory preparing an output buffer\n");
+		return 0;
+	}
+
+	size_t num_different = 0;
+	for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+		for (unsigned int target = UTF_8; target <= UTF_32LE; target++) {
+			if (target == sources[i]) {
+				continue;
+			}
+
+			char pair_name[64];
+			snprintf(pair_name, sizeof(pair_name), "%s>%s", reencoder_encode_type_as_str(sources[i]), reencoder_encode_type_as_str(target));
+			if (function_filter != NULL && strstr(pair_name, function_filter) == NULL) {
+				continue;
+			}
+
+			args.source = source_buffers[i];
+			args.source_bytes = source_sizes[i];
+			args.source_encoding = sources[i];
+			args.target_encoding = (enum ReencoderEncodeType)target;
+			// library names are the same as iconv's, explicit endianness means iconv writes no BOM
+			args.descriptor = iconv_open(reencoder_encode_type_as_str(target), reencoder_encode_type_as_str(sources[i]));
+			if (args.descriptor == (iconv_t)-1) {
+				fprintf(stderr, "iconv does not support %s\n", pair_name);
+				continue;
+			}
+
+			const char* verdict = _reencoder_bench_iconv_verdict(&args);
+			if (strcmp(verdict, "equal") != 0 && strcmp(verdict, "both reject") != 0) {
+				num_different++;
+			}
+
+			_ReencoderBenchCase bench_case;
+			bench_case.function_name = pair_name;
+			bench_case.setup = NULL;
+			bench_case.teardown = NULL;
+			bench_case.arg = &args;
+			bench_case.bytes_per_call = args.source_bytes;
+
+			_ReencoderBenchResult reencoder_result;
+			bench_case.run = _reencoder_bench_run_reencoder;
+			_reencoder_bench_measure(&bench_case, NULL, &reencoder_result);
+
+			_ReencoderBenchResult iconv_result;
+			bench_case.run = _reencoder_bench_run_iconv;
+			_reencoder_bench_measure(&bench_case, NULL, &iconv_result);
+
+			iconv_close(args.descriptor);
+
+			double speedup = reencoder_result.median_ns > 0.0 ? iconv_result.median_ns / reencoder_result.median_ns : 0.0;
+			if (csv) {
+				printf("%s,%s,%zu,%.1f,%.3f,%.1f,%.3f,%.3f,%s\n", pair_name, corpus->name, args.source_bytes,
+					reencoder_result.median_ns, reencoder_result.gb_per_s, iconv_result.median_ns, iconv_result.gb_per_s, speedup, verdict
+				);
+			}
+			else {
+				printf("%-20s %-10s %12zu %16.1f %14.3f %16.1f %14.3f %8.2fx  %s\n", pair_name, corpus->name, args.source_bytes,
+					reencoder_result.median_ns, reencoder_result.gb_per_s, iconv_result.median_ns, iconv_result.gb_per_s, speedup, verdict
+				);
+			}
+			fflush(stdout);
+		}
+	}
+
+	free(args.output);
+
+	return num_different;
+#else
+	(void)corpus;
+	(void)function_filter;
+	(void)csv;
+
+	return 0;
+#endif
+}
+
+void _reencoder_bench_print_iconv_header(unsigned int csv) {
+	if (csv) {
+		printf("pair,corpus,bytes,reencoder_median_ns_per_call,reencoder_gb_per_s,iconv_median_ns_per_call,iconv_gb_per_s,speedup,output\n");
+		return;
+	}
+
+	printf("%-20s %-10s %12s %16s %14s %16s %14s %9s  %s\n",
+		"pair", "corpus", "bytes", "reencoder ns", "reencoder GB/s", "iconv ns", "iconv GB/s", "speedup", "output"
+	);
+}
+
+#if _REENCODER_BENCH_HAS_ICONV
+static size_t _reencoder_bench_iconv_convert(_ReencoderBenchIconvArgs* args) {
+	char* in = (char*)args->source;
+	size_t in_left = args->source_bytes;
+	char* out = (char*)args->output;
+	size_t out_left = args->output_bytes;
+
+	// drop any shift state left behind by a previous call that stopped on an error
+	iconv(args->descriptor, NULL, NULL, NULL, NULL);
+	if (iconv(args->descriptor, &in, &in_left, &out, &out_left) == (size_t)-1) {
+		return SIZE_MAX;
+	}
+
+	return args->output_bytes - out_left;
+}
+
+static const char* _reencoder_bench_iconv_verdict(_ReencoderBenchIconvArgs* args) {
+	ReencoderUnicodeStruct* unicode_struct = reencoder_convert(args->source_encoding, args->target_encoding, args->source);
+	if (unicode_struct == NULL) {
+		return "DIFFERENT";
+	}
+
+	unsigned int is_rejected = unicode_struct->string_validity != REENCODER_UTF8_VALID &&
+		unicode_struct->string_validity != REENCODER_UTF16_VALID && unicode_struct->string_validity != REENCODER_UTF32_VALID;
+
+	uint8_t* reencoder_output = NULL;
+	size_t reencoder_bytes = 0;
+	if (!is_rejected) {
+		reencoder_output = (uint8_t*)malloc(unicode_struct->num_bytes + sizeof(uint32_t));
+		if (reencoder_output == NULL) {
+			reencoder_unicode_struct_free(&unicode_struct);
+			return "DIFFERENT";
+		}
+		reencoder_bytes = reencoder_write_to_buffer(unicode_struct, reencoder_output, 0);
+	}
+	reencoder_unicode_struct_free(&unicode_struct);
+
+	size_t iconv_bytes = _reencoder_bench_iconv_convert(args);
+
+	const char* verdict;
+	if (is_rejected) {
+		verdict = iconv_bytes == SIZE_MAX ? "both reject" : "ONLY REENCODER REJECTS";
+	}
+	else if (iconv_bytes == SIZE_MAX) {
+		verdict = "ONLY ICONV REJECTS";
+	}
+	else {
+		verdict = iconv_bytes == reencoder_bytes && memcmp(reencoder_output, args->output, iconv_bytes) == 0 ? "equal" : "DIFFERENT";
+	}
+
+	free(reencoder_output);
+
+	return verdict;
+}
+
+static void _reencoder_bench_run_iconv(void* arg) {
+	_reencoder_bench_iconv_convert((_ReencoderBenchIconvArgs*)arg);
+}
+
+static void _reencoder_bench_run_reencoder(void* arg) {
+	_ReencoderBenchIconvArgs* args = (_ReencoderBenchIconvArgs*)arg;
+
+	ReencoderUnicodeStruct* unicode_struct = reencoder_convert(args->source_encoding, args->target_encoding, args->source);
+	reencoder_unicode_struct_free(&unicode_struct);
+}
+#endif
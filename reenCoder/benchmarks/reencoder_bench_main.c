@@ -0,0 +1,380 @@
+#include "reencoder_bench.h"
+
+/**
+ * @brief Command line options of the benchmark executable.
+ */
+typedef struct {
+	size_t max_size;
+	const char* function_filter;
+	const char* corpus_filter;
+	unsigned int csv;
+	unsigned int use_counters;
+	unsigned int compare_iconv;
+} _ReencoderBenchOptions;
+
+/**
+ * @brief Parses the command line, printing usage on errors or --help.
+ *
+ * @return 1 if the benchmarks should run, 0 otherwise.
+ */
+static unsigned int _reencoder_bench_parse_options(int argc, char** argv, _ReencoderBenchOptions* options);
+
+/**
+ * @brief Measures and prints one case, unless it is filtered out.
+ */
+static void _reencoder_bench_run_case(const _ReencoderBenchOptions* options, _ReencoderBenchCounters* counters, _ReencoderBenchCase* bench_case, const char* corpus_name);
+
+/**
+ * @brief Runs every benchmarked function against one corpus.
+ */
+static void _reencoder_bench_run_corpus(const _ReencoderBenchOptions* options, _ReencoderBenchCounters* counters, const _ReencoderBenchCorpus* corpus);
+
+/**
+ * @brief Returns the corpus text in the given encoding, along with its size in bytes.
+ */
+static const void* _reencoder_bench_source_buffer(const _ReencoderBenchCorpus* corpus, enum ReencoderEncodeType encoding, size_t* bytes);
+
+/**
+ * @brief Parses the corpus text in the given encoding into a new struct.
+ */
+static ReencoderUnicodeStruct* _reencoder_bench_parse(const _ReencoderBenchCorpus* corpus, enum ReencoderEncodeType encoding);
+
+// Measured calls, matching the members of `_ReencoderBenchCase`
+static void _reencoder_bench_run_parse(void* arg);
+static void _reencoder_bench_run_convert(void* arg);
+static void _reencoder_bench_run_repair(void* arg);
+static void _reencoder_bench_run_repair_capped(void* arg);
+static void _reencoder_bench_run_duplicate(void* arg);
+static void _reencoder_bench_run_write_to_buffer(void* arg);
+static void _reencoder_bench_setup_structs(void* arg, size_t calls);
+static void _reencoder_bench_setup_single_struct(void* arg, size_t calls);
+static void _reencoder_bench_teardown_structs(void* arg);
+
+int main(int argc, char** argv) {
+	_ReencoderBenchOptions options;
+	if (!_reencoder_bench_parse_options(argc, argv, &options)) {
+		return 1;
+	}
+
+	_ReencoderBenchCounters counters;
+	_reencoder_bench_counters_open(&counters);
+	if (options.use_counters && !counters.is_available) {
+		fprintf(stderr, "Hardware performance counters are not available, only time is reported\n");
+	}
+	if (!options.use_counters) {
+		_reencoder_bench_counters_close(&counters);
+	}
+
+	if (options.compare_iconv && !_REENCODER_BENCH_HAS_ICONV) {
+		fprintf(stderr, "iconv is not available on this platform\n");
+		_reencoder_bench_counters_close(&counters);
+		return 1;
+	}
+
+	if (options.compare_iconv) {
+		_reencoder_bench_print_iconv_header(options.csv);
+	}
+	else {
+		_reencoder_bench_print_header(options.csv);
+	}
+
+	size_t num_different = 0;
+
+	for (size_t size = _REENCODER_BENCH_MIN_SIZE; size <= options.max_size; size *= _REENCODER_BENCH_SIZE_STEP) {
+		for (size_t i = 0; i < _REENCODER_BENCH_NUM_CORPORA; i++) {
+			if (options.corpus_filter != NULL && strcmp(options.corpus_filter, _REENCODER_BENCH_CORPUS_NAMES[i]) != 0) {
+				continue;
+			}
+
+			_ReencoderBenchCorpus* corpus = _reencoder_bench_corpus_create(_REENCODER_BENCH_CORPUS_NAMES[i], size);
+			if (corpus == NULL) {
+				fprintf(stderr, "Out of memory generating %s corpus of %zu bytes\n", _REENCODER_BENCH_CORPUS_NAMES[i], size);
+				_reencoder_bench_counters_close(&counters);
+				return 1;
+			}
+
+			if (options.compare_iconv) {
+				num_different += _reencoder_bench_compare_iconv(corpus, options.function_filter, options.csv);
+			}
+			else {
+				_reencoder_bench_run_corpus(&options, &counters, corpus);
+			}
+			_reencoder_bench_corpus_free(&corpus);
+		}
+	}
+
+	_reencoder_bench_counters_close(&counters);
+
+	if (num_different != 0) {
+		fprintf(stderr, "%zu conversions differ from iconv\n", num_different);
+		return 1;
+	}
+
+	return 0;
+}
+
+static unsigned int _reencoder_bench_parse_options(int argc, char** argv, _ReencoderBenchOptions* options) {
+	options->max_size = _REENCODER_BENCH_DEFAULT_MAX_SIZE;
+	options->function_filter = NULL;
+	options->corpus_filter = NULL;
+	options->csv = 0;
+	options->use_counters = 1;
+	options->compare_iconv = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) {
+			options->max_size = (size_t)strtoull(argv[++i], NULL, 10);
+		}
+		else if (strcmp(argv[i], "--full") == 0) {
+			options->max_size = _REENCODER_BENCH_FULL_MAX_SIZE;
+		}
+		else if (strcmp(argv[i], "--function") == 0 && i + 1 < argc) {
+			options->function_filter = argv[++i];
+		}
+		else if (strcmp(argv[i], "--corpus") == 0 && i + 1 < argc) {
+			options->corpus_filter = argv[++i];
+		}
+		else if (strcmp(argv[i], "--csv") == 0) {
+			options->csv = 1;
+		}
+		else if (strcmp(argv[i], "--no-counters") == 0) {
+			options->use_counters = 0;
+		}
+		else if (strcmp(argv[i], "--compare-iconv") == 0) {
+			options->compare_iconv = 1;
+		}
+		else {
+			printf("Usage: %s [--max-size BYTES] [--full] [--function SUBSTRING] [--corpus NAME] [--csv] [--no-counters] [--compare-iconv]\n", argv[0]);
+			printf("  --max-size  Largest corpus in UTF-8 bytes, sizes grow x%d from %d (default %d)\n", _REENCODER_BENCH_SIZE_STEP, _REENCODER_BENCH_MIN_SIZE, _REENCODER_BENCH_DEFAULT_MAX_SIZE);
+			printf("  --full      Same as --max-size %d\n", _REENCODER_BENCH_FULL_MAX_SIZE);
+			printf("  --function  Only run functions whose name contains SUBSTRING\n");
+			printf("  --corpus    Only run one corpus:");
+			for (size_t j = 0; j < _REENCODER_BENCH_NUM_CORPORA; j++) {
+				printf(" %s", _REENCODER_BENCH_CORPUS_NAMES[j]);
+			}
+			printf("\n  --csv       Print comma-separated values\n");
+			printf("  --no-counters  Do not read hardware performance counters (Linux only)\n");
+			printf("  --compare-iconv  Time reencoder_convert against iconv and check both give the same output (not on Windows)\n");
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static void _reencoder_bench_run_case(const _ReencoderBenchOptions* options, _ReencoderBenchCounters* counters, _ReencoderBenchCase* bench_case, const char* corpus_name) {
+	if (options->function_filter != NULL && strstr(bench_case->function_name, options->function_filter) == NULL) {
+		return;
+	}
+
+	_ReencoderBenchResult result;
+	_reencoder_bench_measure(bench_case, counters, &result);
+	_reencoder_bench_print_row(options->csv, bench_case->function_name, corpus_name, bench_case->bytes_per_call, &result);
+	fflush(stdout);
+}
+
+static void _reencoder_bench_run_corpus(const _ReencoderBenchOptions* options, _ReencoderBenchCounters* counters, const _ReencoderBenchCorpus* corpus) {
+	static const char* parse_names[] = {
+		"reencoder_utf8_parse", "reencoder_utf16_parse_uint16[BE]", "reencoder_utf16_parse_uint16[LE]",
+		"reencoder_utf32_parse_uint32[BE]", "reencoder_utf32_parse_uint32[LE]"
+	};
+	static const char* repair_names[] = {
+		"reencoder_repair_struct[UTF-8]", "reencoder_repair_struct[UTF-16BE]", "reencoder_repair_struct[UTF-16LE]",
+		"reencoder_repair_struct[UTF-32BE]", "reencoder_repair_struct[UTF-32LE]"
+	};
+	static const char* repair_capped_names[] = {
+		"repair_struct_ctx[UTF-8,capped]", "repair_struct_ctx[UTF-16BE,capped]", "repair_struct_ctx[UTF-16LE,capped]",
+		"repair_struct_ctx[UTF-32BE,capped]", "repair_struct_ctx[UTF-32LE,capped]"
+	};
+	static const char* duplicate_names[] = {
+		"struct_duplicate[UTF-8]", "struct_duplicate[UTF-16BE]", "struct_duplicate[UTF-16LE]",
+		"struct_duplicate[UTF-32BE]", "struct_duplicate[UTF-32LE]"
+	};
+	static const char* write_names[] = {
+		"write_to_buffer[UTF-8]", "write_to_buffer[UTF-16BE]", "write_to_buffer[UTF-16LE]",
+		"write_to_buffer[UTF-32BE]", "write_to_buffer[UTF-32LE]"
+	};
+
+	_ReencoderBenchArgs args;
+	memset(&args, 0x00, sizeof(args));
+	args.corpus = corpus;
+
+	// capped contexts reserve the worst case up front and never reallocate, which is what hostile input should be repaired with
+	args.ctx = reencoder_context_create(NULL);
+	if (args.ctx == NULL) {
+		fprintf(stderr, "Out of memory creating a context\n");
+		return;
+	}
+	reencoder_context_set_max_expansion(args.ctx, _REENCODER_BENCH_MAX_EXPANSION_PERCENT);
+
+	_ReencoderBenchCase bench_case;
+	bench_case.arg = &args;
+
+	for (unsigned int source = UTF_8; source <= UTF_32LE; source++) {
+		args.source_encoding = (enum ReencoderEncodeType)source;
+		_reencoder_bench_source_buffer(corpus, args.source_encoding, &bench_case.bytes_per_call);
+
+		bench_case.function_name = parse_names[source];
+		bench_case.setup = NULL;
+		bench_case.run = _reencoder_bench_run_parse;
+		bench_case.teardown = NULL;
+		_reencoder_bench_run_case(options, counters, &bench_case, corpus->name);
+
+		// all 20 conversions between different encodings
+		for (unsigned int target = UTF_8; target <= UTF_32LE; target++) {
+			if (target == source) {
+				continue;
+			}
+
+			char convert_name[64];
+			snprintf(convert_name, sizeof(convert_name), "reencoder_convert[%s>%s]", reencoder_encode_type_as_str(source), reencoder_encode_type_as_str(target));
+
+			args.target_encoding = (enum ReencoderEncodeType)target;
+			bench_case.function_name = convert_name;
+			bench_case.run = _reencoder_bench_run_convert;
+			_reencoder_bench_run_case(options, counters, &bench_case, corpus->name);
+		}
+
+		// repair is a no-op on well-formed text, only malformed corpora are worth timing
+		ReencoderUnicodeStruct* probe = _reencoder_bench_parse(corpus, args.source_encoding);
+		unsigned int is_malformed = probe != NULL && probe->string_validity != REENCODER_UTF8_VALID &&
+			probe->string_validity != REENCODER_UTF16_VALID && probe->string_validity != REENCODER_UTF32_VALID;
+		reencoder_unicode_struct_free(&probe);
+
+		if (is_malformed) {
+			bench_case.function_name = repair_names[source];
+			bench_case.setup = _reencoder_bench_setup_structs;
+			bench_case.run = _reencoder_bench_run_repair;
+			bench_case.teardown = _reencoder_bench_teardown_structs;
+			_reencoder_bench_run_case(options, counters, &bench_case, corpus->name);
+
+			bench_case.function_name = repair_capped_names[source];
+			bench_case.run = _reencoder_bench_run_repair_capped;
+			_reencoder_bench_run_case(options, counters, &bench_case, corpus->name);
+		}
+
+		bench_case.function_name = duplicate_names[source];
+		bench_case.setup = _reencoder_bench_setup_single_struct;
+		bench_case.run = _reencoder_bench_run_duplicate;
+		bench_case.teardown = _reencoder_bench_teardown_structs;
+		_reencoder_bench_run_case(options, counters, &bench_case, corpus->name);
+
+		bench_case.function_name = write_names[source];
+		bench_case.run = _reencoder_bench_run_write_to_buffer;
+		_reencoder_bench_run_case(options, counters, &bench_case, corpus->name);
+	}
+
+	reencoder_context_destroy(&args.ctx);
+}
+
+static const void* _reencoder_bench_source_buffer(const _ReencoderBenchCorpus* corpus, enum ReencoderEncodeType encoding, size_t* bytes) {
+	if (encoding == UTF_8) {
+		*bytes = corpus->utf8_units;
+		return corpus->utf8;
+	}
+	if (encoding == UTF_16BE || encoding == UTF_16LE) {
+		*bytes = corpus->utf16_units * sizeof(uint16_t);
+		return corpus->utf16;
+	}
+
+	*bytes = corpus->utf32_units * sizeof(uint32_t);
+	return corpus->utf32;
+}
+
+static ReencoderUnicodeStruct* _reencoder_bench_parse(const _ReencoderBenchCorpus* corpus, enum ReencoderEncodeType encoding) {
+	if (encoding == UTF_8) {
+		return reencoder_utf8_parse(corpus->utf8);
+	}
+	if (encoding == UTF_16BE || encoding == UTF_16LE) {
+		return reencoder_utf16_parse_uint16(corpus->utf16, encoding);
+	}
+
+	return reencoder_utf32_parse_uint32(corpus->utf32, encoding);
+}
+
+static void _reencoder_bench_run_parse(void* arg) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+
+	ReencoderUnicodeStruct* unicode_struct = _reencoder_bench_parse(args->corpus, args->source_encoding);
+	reencoder_unicode_struct_free(&unicode_struct);
+}
+
+static void _reencoder_bench_run_convert(void* arg) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+
+	size_t bytes = 0;
+	ReencoderUnicodeStruct* unicode_struct = reencoder_convert(
+		args->source_encoding, args->target_encoding, _reencoder_bench_source_buffer(args->corpus, args->source_encoding, &bytes)
+	);
+	reencoder_unicode_struct_free(&unicode_struct);
+}
+
+static void _reencoder_bench_run_repair(void* arg) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+
+	reencoder_repair_struct(args->structs[args->next_struct++]);
+}
+
+static void _reencoder_bench_run_repair_capped(void* arg) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+
+	reencoder_repair_struct_ctx(args->ctx, args->structs[args->next_struct++]);
+}
+
+static void _reencoder_bench_run_duplicate(void* arg) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+
+	ReencoderUnicodeStruct* duplicate = reencoder_unicode_struct_duplicate(args->structs[0]);
+	reencoder_unicode_struct_free(&duplicate);
+}
+
+static void _reencoder_bench_run_write_to_buffer(void* arg) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+
+	reencoder_write_to_buffer(args->structs[0], args->output, 0);
+}
+
+static void _reencoder_bench_setup_structs(void* arg, size_t calls) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+
+	// every call gets a struct of its own, since repairing changes the struct
+	args->structs = (ReencoderUnicodeStruct**)malloc(calls * sizeof(ReencoderUnicodeStruct*));
+	if (args->structs == NULL) {
+		fprintf(stderr, "Out of memory preparing %zu structs\n", calls);
+		exit(1);
+	}
+	for (size_t i = 0; i < calls; i++) {
+		args->structs[i] = _reencoder_bench_parse(args->corpus, args->source_encoding);
+	}
+	args->num_structs = calls;
+	args->next_struct = 0;
+	args->output = NULL;
+}
+
+static void _reencoder_bench_setup_single_struct(void* arg, size_t calls) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+	(void)calls;
+
+	_reencoder_bench_setup_structs(arg, 1);
+
+	// room for the string and the largest BOM
+	args->output = (uint8_t*)malloc(args->structs[0]->num_bytes + sizeof(uint32_t));
+	if (args->output == NULL) {
+		fprintf(stderr, "Out of memory preparing an output buffer\n");
+		exit(1);
+	}
+}
+
+static void _reencoder_bench_teardown_structs(void* arg) {
+	_ReencoderBenchArgs* args = (_ReencoderBenchArgs*)arg;
+
+	for (size_t i = 0; i < args->num_structs; i++) {
+		reencoder_unicode_struct_free(&args->structs[i]);
+	}
+	free(args->structs);
+	free(args->output);
+
+	args->structs = NULL;
+	args->num_structs = 0;
+	args->output = NULL;
+}
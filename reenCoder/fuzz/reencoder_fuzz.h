@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../headers/reencoder_utf_8.h"
+#include "../headers/reencoder_utf_16.h"
+#include "../headers/reencoder_utf_32.h"
+#include "../headers/reencoder_validate.h"
+#include "../headers/reencoder_batch.h"
+
+#define _REENCODER_FUZZ_NUM_ENCODINGS 5
+#define _REENCODER_FUZZ_MAX_INPUT_BYTES 65536 // longer inputs are cut, they only slow the fuzzer down without reaching new paths
+#define _REENCODER_FUZZ_ARENA_CHUNK_SIZE 4096
+#define _REENCODER_FUZZ_POOL_WORKERS 4
+#define _REENCODER_FUZZ_MAX_EXPANSION_PERCENT 400 // no conversion or repair grows past 400% of its input, so a context capped here must never fail
+
+/**
+ * @brief Everything the scalar reference says about one fuzz input.
+ *
+ * An input is a selector byte followed by the source string. The selector picks the source encoding (selector % 5) and the target encoding (selector / 5 % 5),
+ * and the source string is read in the byte order of the source encoding, up to its first null code unit. A trailing partial code unit is dropped.
+ *
+ * Contains both encodings, the source string in its own byte order (source_bytes) and in system endianness (source_units), both null-terminated,
+ * its length in code units (num_units) and bytes (num_bytes), and the results of the reference:
+ * the outcome of the whole string (validity), the byte offset of its first malformed sequence or num_bytes if there is none (error_offset),
+ * the number of malformed sequences (num_errors), the repaired string in the source byte order (repaired, repaired_bytes),
+ * the converted and repaired string in the target byte order (converted, converted_bytes) and the number of characters of either (num_chars).
+ * The reference only uses `_reencoder_*_buffer_idx0_is_valid()`, `_reencoder_*_seq_is_valid()` and `_reencoder_change_encoding_dynamic()`,
+ * which decode one character at a time and take no shortcuts.
+ */
+typedef struct {
+	enum ReencoderEncodeType source_encoding;
+	enum ReencoderEncodeType target_encoding;
+	uint8_t* source_bytes;
+	void* source_units;
+	size_t num_units;
+	size_t num_bytes;
+	unsigned int validity;
+	size_t error_offset;
+	size_t num_errors;
+	uint8_t* repaired;
+	size_t repaired_bytes;
+	uint8_t* converted;
+	size_t converted_bytes;
+	size_t num_chars;
+} _ReencoderFuzzReference;
+
+/**
+ * @brief Aborts with a description of the failed check and the encodings of the current input if condition is false.
+ *
+ * Aborting (rather than returning) is what libFuzzer and AFL++ report as a crash, and keeps the input that caused it.
+ */
+#define _REENCODER_FUZZ_CHECK(reference, condition, description) \
+	do { \
+		if (!(condition)) { \
+			_reencoder_fuzz_fail((reference), __FILE__, __LINE__, #condition, (description)); \
+		} \
+	} while (0)
+
+/**
+ * @brief libFuzzer entry point, also called by the standalone driver for every input it replays.
+ *
+ * Feeds the input through the scalar reference and through every fast path of the library, and aborts on the first difference
+ * in outcome, error offset, U+FFFD placement, num_bytes or num_chars.
+ *
+ * @param[in] data Fuzz input, see `_ReencoderFuzzReference` for its layout.
+ * @param[in] size Size of the fuzz input in bytes.
+ *
+ * @return 0, inputs are never rejected.
+ */
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+/**
+ * @brief Prints a failed check along with the encodings and length of the input, then aborts.
+ *
+ * @param[in] reference Reference of the current input.
+ * @param[in] file Source file of the check.
+ * @param[in] line Line of the check.
+ * @param[in] condition Text of the condition that was false.
+ * @param[in] description Which fast path was being checked.
+ */
+void _reencoder_fuzz_fail(const _ReencoderFuzzReference* reference, const char* file, int line, const char* condition, const char* description);
@@ -0,0 +1,463 @@
+#include "reencoder_fuzz.h"
+
+/**
+ * @brief Builds the reference of one fuzz input, see `_ReencoderFuzzReference`.
+ *
+ * @param[in] data Fuzz input.
+ * @param[in] size Size of the fuzz input in bytes. Must be at least 1.
+ * @param[out] reference Pointer to the reference to be filled.
+ *
+ * @return 1 if the reference was built, 0 if memory allocation failed.
+ */
+static unsigned int _reencoder_fuzz_reference_create(const uint8_t* data, size_t size, _ReencoderFuzzReference* reference);
+
+/**
+ * @brief Frees the buffers of a reference.
+ */
+static void _reencoder_fuzz_reference_free(_ReencoderFuzzReference* reference);
+
+/**
+ * @brief Runs `_reencoder_change_encoding_dynamic()` over the source units and stores the result in the byte order of target_encoding.
+ *
+ * @return Newly allocated output, or NULL if memory allocation failed.
+ */
+static uint8_t* _reencoder_fuzz_reference_convert(const _ReencoderFuzzReference* reference, enum ReencoderEncodeType target_encoding, size_t* output_bytes, size_t* output_units);
+
+/**
+ * @brief Checks the allocation-free validators and the error scanner against a character-by-character walk of the source.
+ */
+static void _reencoder_fuzz_check_validation(const _ReencoderFuzzReference* reference, ReencoderThreadPool* pool);
+
+/**
+ * @brief Checks every parse entry point of the source encoding, repairing each result that is malformed.
+ */
+static void _reencoder_fuzz_check_parse_and_repair(const _ReencoderFuzzReference* reference, ReencoderContext* ctx);
+
+/**
+ * @brief Checks every conversion entry point from the source to the target encoding.
+ */
+static void _reencoder_fuzz_check_convert(const _ReencoderFuzzReference* reference, ReencoderContext* ctx, ReencoderArena* arena);
+
+/**
+ * @brief Checks a parsed struct against the reference, then repairs it (and a duplicate sharing its buffer) if it is malformed.
+ */
+static void _reencoder_fuzz_check_parsed_struct(const _ReencoderFuzzReference* reference, ReencoderContext* ctx, ReencoderUnicodeStruct* unicode_struct, const char* description);
+
+/**
+ * @brief Checks a struct holding the string expected, in encoding type with outcome validity, as written by `reencoder_write_to_buffer()`.
+ */
+static void _reencoder_fuzz_check_struct(const _ReencoderFuzzReference* reference, const ReencoderUnicodeStruct* unicode_struct, enum ReencoderEncodeType type, unsigned int validity, const uint8_t* expected, size_t expected_bytes, size_t num_chars, const char* description);
+
+/**
+ * @brief Returns the well-formed outcome of an encoding, or its repaired outcome.
+ */
+static unsigned int _reencoder_fuzz_valid_outcome(enum ReencoderEncodeType type, unsigned int is_repaired);
+
+/**
+ * @brief Reads num_units code units stored in the byte order of type into system endianness.
+ */
+static void _reencoder_fuzz_load_units(void* dest, const uint8_t* src, size_t num_units, enum ReencoderEncodeType type);
+
+/**
+ * @brief Writes num_units code units in system endianness in the byte order of type.
+ */
+static void _reencoder_fuzz_store_units(uint8_t* dest, const void* src, size_t num_units, enum ReencoderEncodeType type);
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	// shared by every input of the process, like they would be by a long-running caller
+	static ReencoderContext* ctx = NULL;
+	static ReencoderContext* capped_ctx = NULL;
+	static ReencoderArena* arena = NULL;
+	static ReencoderThreadPool* pool = NULL;
+	if (ctx == NULL) {
+		ctx = reencoder_context_create(NULL);
+		capped_ctx = reencoder_context_create(NULL);
+		arena = reencoder_arena_create(_REENCODER_FUZZ_ARENA_CHUNK_SIZE);
+		pool = reencoder_thread_pool_create(_REENCODER_FUZZ_POOL_WORKERS);
+		if (ctx == NULL || capped_ctx == NULL || arena == NULL || pool == NULL) {
+			fprintf(stderr, "reencoder_fuzz: out of memory while setting up\n");
+			abort();
+		}
+
+		// every fast path a context can take: compact results, host-order storage, and a cap that reserves the worst case up front
+		reencoder_context_set_memory_policy(capped_ctx, REENCODER_MEMORY_POLICY_COMPACT);
+		reencoder_context_set_host_order_storage(capped_ctx, 1);
+		reencoder_context_set_max_expansion(capped_ctx, _REENCODER_FUZZ_MAX_EXPANSION_PERCENT);
+	}
+
+	if (size == 0) {
+		return 0;
+	}
+	if (size > _REENCODER_FUZZ_MAX_INPUT_BYTES) {
+		size = _REENCODER_FUZZ_MAX_INPUT_BYTES;
+	}
+
+	_ReencoderFuzzReference reference;
+	if (!_reencoder_fuzz_reference_create(data, size, &reference)) {
+		return 0;
+	}
+
+	_reencoder_fuzz_check_validation(&reference, pool);
+	_reencoder_fuzz_check_parse_and_repair(&reference, ctx);
+	_reencoder_fuzz_check_parse_and_repair(&reference, capped_ctx);
+	_reencoder_fuzz_check_convert(&reference, ctx, NULL);
+	_reencoder_fuzz_check_convert(&reference, capped_ctx, NULL);
+	_reencoder_fuzz_check_convert(&reference, ctx, arena);
+
+	reencoder_arena_reset(arena);
+	_reencoder_fuzz_reference_free(&reference);
+
+	return 0;
+}
+
+void _reencoder_fuzz_fail(const _ReencoderFuzzReference* reference, const char* file, int line, const char* condition, const char* description) {
+	fprintf(stderr, "reencoder_fuzz: %s differs from the scalar reference\n", description);
+	fprintf(stderr, "  check:  %s (%s:%d)\n", condition, file, line);
+	fprintf(stderr, "  input:  %s -> %s, %zu code units, outcome %s\n",
+		reencoder_encode_type_as_str(reference->source_encoding), reencoder_encode_type_as_str(reference->target_encoding),
+		reference->num_units, reencoder_outcome_as_str(reference->validity)
+	);
+	abort();
+}
+
+static unsigned int _reencoder_fuzz_reference_create(const uint8_t* data, size_t size, _ReencoderFuzzReference* reference) {
+	memset(reference, 0, sizeof(_ReencoderFuzzReference));
+	reference->source_encoding = (enum ReencoderEncodeType)(data[0] % _REENCODER_FUZZ_NUM_ENCODINGS);
+	reference->target_encoding = (enum ReencoderEncodeType)((data[0] / _REENCODER_FUZZ_NUM_ENCODINGS) % _REENCODER_FUZZ_NUM_ENCODINGS);
+
+	size_t unit_size = _reencoder_code_unit_size(reference->source_encoding);
+	size_t max_units = (size - 1) / unit_size;
+
+	// one extra unit for the null-terminator
+	reference->source_bytes = (uint8_t*)calloc(max_units + 1, unit_size);
+	reference->source_units = calloc(max_units + 1, unit_size);
+	if (reference->source_bytes == NULL || reference->source_units == NULL) {
+		_reencoder_fuzz_reference_free(reference);
+		return 0;
+	}
+
+	// every entry point stops at the first null code unit, so the string ends there
+	_reencoder_fuzz_load_units(reference->source_units, data + 1, max_units, reference->source_encoding);
+	size_t num_units = 0;
+	while (num_units < max_units) {
+		uint32_t unit = unit_size == sizeof(uint8_t) ? ((const uint8_t*)reference->source_units)[num_units] :
+			unit_size == sizeof(uint16_t) ? ((const uint16_t*)reference->source_units)[num_units] : ((const uint32_t*)reference->source_units)[num_units];
+		if (unit == 0) {
+			break;
+		}
+		num_units++;
+	}
+	memset((uint8_t*)reference->source_units + (num_units * unit_size), 0, (max_units - num_units) * unit_size);
+	memcpy(reference->source_bytes, data + 1, num_units * unit_size);
+	reference->num_units = num_units;
+	reference->num_bytes = num_units * unit_size;
+
+	// whole-string outcome
+	if (reference->source_encoding == UTF_8) {
+		reference->validity = _reencoder_utf8_seq_is_valid((const uint8_t*)reference->source_units, NULL);
+	}
+	else if (unit_size == sizeof(uint16_t)) {
+		reference->validity = _reencoder_utf16_seq_is_valid((const uint16_t*)reference->source_units, num_units, NULL);
+	}
+	else {
+		reference->validity = _reencoder_utf32_seq_is_valid((const uint32_t*)reference->source_units, num_units, NULL);
+	}
+
+	// first error and number of errors, one character at a time, resuming after each malformed sequence like a repair does
+	reference->error_offset = reference->num_bytes;
+	for (size_t i = 0; i < num_units;) {
+		unsigned int units_read = 1;
+		unsigned int outcome = 0;
+		if (reference->source_encoding == UTF_8) {
+			outcome = _reencoder_utf8_buffer_idx0_is_valid((const uint8_t*)reference->source_units + i, num_units - i, &units_read);
+		}
+		else if (unit_size == sizeof(uint16_t)) {
+			outcome = _reencoder_utf16_buffer_idx0_is_valid((const uint16_t*)reference->source_units + i, num_units - i, &units_read);
+		}
+		else {
+			outcome = _reencoder_utf32_buffer_idx0_is_valid((const uint32_t*)reference->source_units + i);
+		}
+
+		if (outcome != _reencoder_fuzz_valid_outcome(reference->source_encoding, 0)) {
+			if (reference->num_errors == 0) {
+				reference->error_offset = i * unit_size;
+			}
+			reference->num_errors++;
+		}
+		i += units_read;
+	}
+
+	// repaired source, converted target, and the number of characters (every UTF-32 code unit is one)
+	size_t ignored = 0;
+	uint8_t* as_utf32 = _reencoder_fuzz_reference_convert(reference, UTF_32BE, &ignored, &reference->num_chars);
+	reference->repaired = _reencoder_fuzz_reference_convert(reference, reference->source_encoding, &reference->repaired_bytes, &ignored);
+	reference->converted = _reencoder_fuzz_reference_convert(reference, reference->target_encoding, &reference->converted_bytes, &ignored);
+	free(as_utf32);
+	if (as_utf32 == NULL || reference->repaired == NULL || reference->converted == NULL) {
+		_reencoder_fuzz_reference_free(reference);
+		return 0;
+	}
+
+	return 1;
+}
+
+static void _reencoder_fuzz_reference_free(_ReencoderFuzzReference* reference) {
+	free(reference->source_bytes);
+	free(reference->source_units);
+	free(reference->repaired);
+	free(reference->converted);
+	reference->source_bytes = NULL;
+	reference->source_units = NULL;
+	reference->repaired = NULL;
+	reference->converted = NULL;
+}
+
+static uint8_t* _reencoder_fuzz_reference_convert(const _ReencoderFuzzReference* reference, enum ReencoderEncodeType target_encoding, size_t* output_bytes, size_t* output_units) {
+	size_t output_index = 0;
+	size_t output_size = 0;
+	void* output_units_buffer = NULL;
+
+	if (_reencoder_change_encoding_dynamic(
+		reference->source_encoding, target_encoding, reference->num_units, &output_index, &output_size, reference->source_units, &output_units_buffer, SIZE_MAX
+	) != REENCODER_CONVERT_SUCCESS) {
+		free(output_units_buffer);
+		return NULL;
+	}
+
+	// the dynamic conversion writes code units in system endianness, results are compared in the byte order of their encoding
+	size_t unit_size = _reencoder_code_unit_size(target_encoding);
+	uint8_t* output = (uint8_t*)malloc((output_index + 1) * unit_size);
+	if (output != NULL) {
+		_reencoder_fuzz_store_units(output, output_units_buffer, output_index, target_encoding);
+	}
+	free(output_units_buffer);
+
+	*output_bytes = output_index * unit_size;
+	*output_units = output_index;
+
+	return output;
+}
+
+static void _reencoder_fuzz_check_validation(const _ReencoderFuzzReference* reference, ReencoderThreadPool* pool) {
+	size_t error_offset = SIZE_MAX;
+	unsigned int outcome = reencoder_validate(reference->source_encoding, reference->source_units, reference->num_units, &error_offset);
+	_REENCODER_FUZZ_CHECK(reference, outcome == reference->validity, "reencoder_validate() outcome");
+	_REENCODER_FUZZ_CHECK(reference, error_offset == reference->error_offset, "reencoder_validate() error offset");
+
+	error_offset = SIZE_MAX;
+	outcome = reencoder_validate_parallel(pool, reference->source_encoding, reference->source_units, reference->num_units, &error_offset);
+	_REENCODER_FUZZ_CHECK(reference, outcome == reference->validity, "reencoder_validate_parallel() outcome");
+	_REENCODER_FUZZ_CHECK(reference, error_offset == reference->error_offset, "reencoder_validate_parallel() error offset");
+
+	ReencoderErrorReport* report = reencoder_scan_errors(reference->source_encoding, reference->source_units, reference->num_units, 0);
+	ReencoderErrorReport* summary = reencoder_scan_errors(reference->source_encoding, reference->source_units, reference->num_units, 1);
+	if (report == NULL || summary == NULL) {
+		reencoder_error_report_free(&report);
+		reencoder_error_report_free(&summary);
+		return;
+	}
+
+	_REENCODER_FUZZ_CHECK(reference, report->num_errors == reference->num_errors, "reencoder_scan_errors() number of errors");
+	_REENCODER_FUZZ_CHECK(reference, summary->num_errors == reference->num_errors, "reencoder_scan_errors() summary number of errors");
+	_REENCODER_FUZZ_CHECK(reference, memcmp(report->histogram, summary->histogram, sizeof(report->histogram)) == 0, "reencoder_scan_errors() summary histogram");
+	if (reference->num_errors > 0) {
+		_REENCODER_FUZZ_CHECK(reference, report->spans[0].offset == reference->error_offset, "reencoder_scan_errors() first span offset");
+		_REENCODER_FUZZ_CHECK(reference, report->spans[0].outcome == reference->validity, "reencoder_scan_errors() first span outcome");
+	}
+
+	// spans are in order and never overlap, each one being a sequence a repair turns into one U+FFFD
+	for (size_t i = 1; i < report->num_errors; i++) {
+		_REENCODER_FUZZ_CHECK(reference, report->spans[i].offset >= report->spans[i - 1].offset + report->spans[i - 1].length, "reencoder_scan_errors() span order");
+	}
+
+	reencoder_error_report_free(&report);
+	reencoder_error_report_free(&summary);
+}
+
+static void _reencoder_fuzz_check_parse_and_repair(const _ReencoderFuzzReference* reference, ReencoderContext* ctx) {
+	enum ReencoderEncodeType source_encoding = reference->source_encoding;
+
+	if (source_encoding == UTF_8) {
+		_reencoder_fuzz_check_parsed_struct(reference, ctx, reencoder_utf8_parse(reference->source_bytes), "reencoder_utf8_parse()");
+	}
+	else if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
+		_reencoder_fuzz_check_parsed_struct(reference, ctx,
+			reencoder_utf16_parse_uint16((const uint16_t*)reference->source_units, source_encoding), "reencoder_utf16_parse_uint16()"
+		);
+		_reencoder_fuzz_check_parsed_struct(reference, ctx,
+			reencoder_utf16_parse_uint8(reference->source_bytes, reference->num_bytes, source_encoding, source_encoding), "reencoder_utf16_parse_uint8()"
+		);
+		_reencoder_fuzz_check_parsed_struct(reference, ctx,
+			reencoder_utf16_parse_uint8_ctx(ctx, reference->source_bytes, reference->num_bytes, source_encoding, source_encoding), "reencoder_utf16_parse_uint8_ctx()"
+		);
+	}
+	else {
+		_reencoder_fuzz_check_parsed_struct(reference, ctx,
+			reencoder_utf32_parse_uint32((const uint32_t*)reference->source_units, source_encoding), "reencoder_utf32_parse_uint32()"
+		);
+		_reencoder_fuzz_check_parsed_struct(reference, ctx,
+			reencoder_utf32_parse_uint8(reference->source_bytes, reference->num_bytes, source_encoding, source_encoding), "reencoder_utf32_parse_uint8()"
+		);
+		_reencoder_fuzz_check_parsed_struct(reference, ctx,
+			reencoder_utf32_parse_uint8_ctx(ctx, reference->source_bytes, reference->num_bytes, source_encoding, source_encoding), "reencoder_utf32_parse_uint8_ctx()"
+		);
+	}
+}
+
+static void _reencoder_fuzz_check_convert(const _ReencoderFuzzReference* reference, ReencoderContext* ctx, ReencoderArena* arena) {
+	enum ReencoderEncodeType source_encoding = reference->source_encoding;
+	enum ReencoderEncodeType target_encoding = reference->target_encoding;
+	unsigned int is_valid = reference->validity == _reencoder_fuzz_valid_outcome(source_encoding, 0);
+
+	// malformed input is handed back as-is in the source encoding, well-formed input is converted
+	enum ReencoderEncodeType expected_type = is_valid ? target_encoding : source_encoding;
+	unsigned int expected_validity = is_valid ? _reencoder_fuzz_valid_outcome(target_encoding, 0) : reference->validity;
+	const uint8_t* expected = is_valid ? reference->converted : reference->source_bytes;
+	size_t expected_bytes = is_valid ? reference->converted_bytes : reference->num_bytes;
+	size_t expected_chars = is_valid ? reference->num_chars : 0;
+
+	ReencoderUnicodeStruct* output_struct = NULL;
+	if (arena != NULL) {
+		output_struct = reencoder_convert_arena(arena, source_encoding, target_encoding, reference->source_units);
+		_reencoder_fuzz_check_struct(reference, output_struct, expected_type, expected_validity, expected, expected_bytes, expected_chars, "reencoder_convert_arena()");
+		return;
+	}
+
+	output_struct = reencoder_convert(source_encoding, target_encoding, reference->source_units);
+	_reencoder_fuzz_check_struct(reference, output_struct, expected_type, expected_validity, expected, expected_bytes, expected_chars, "reencoder_convert()");
+	reencoder_unicode_struct_free(&output_struct);
+
+	output_struct = reencoder_convert_ctx(ctx, source_encoding, target_encoding, reference->source_units);
+	_reencoder_fuzz_check_struct(reference, output_struct, expected_type, expected_validity, expected, expected_bytes, expected_chars, "reencoder_convert_ctx()");
+
+	// materializing brings a host-order struct into its byte order without changing what it holds
+	if (output_struct != NULL && reencoder_unicode_struct_materialize(output_struct) == REENCODER_MATERIALIZE_SUCCESS) {
+		_reencoder_fuzz_check_struct(reference, output_struct, expected_type, expected_validity, expected, expected_bytes, expected_chars, "reencoder_unicode_struct_materialize()");
+	}
+	reencoder_unicode_struct_free(&output_struct);
+
+	// a malformed batch entry keeps its outcome and is stored as an empty string
+	const void* inputs[] = { reference->source_units };
+	size_t lengths[] = { reference->num_units };
+	ReencoderBatch* batch = reencoder_convert_batch(source_encoding, target_encoding, inputs, lengths, 1);
+	if (batch != NULL) {
+		_REENCODER_FUZZ_CHECK(reference, batch->validity[0] == (is_valid ? expected_validity : reference->validity), "reencoder_convert_batch() outcome");
+		_REENCODER_FUZZ_CHECK(reference, batch->num_bytes[0] == (is_valid ? expected_bytes : 0), "reencoder_convert_batch() num_bytes");
+		_REENCODER_FUZZ_CHECK(reference, batch->num_chars[0] == expected_chars, "reencoder_convert_batch() num_chars");
+		if (is_valid) {
+			_REENCODER_FUZZ_CHECK(reference, memcmp(batch->buffer + batch->offsets[0], expected, expected_bytes) == 0, "reencoder_convert_batch() output");
+		}
+		reencoder_batch_free(&batch);
+	}
+}
+
+static void _reencoder_fuzz_check_parsed_struct(const _ReencoderFuzzReference* reference, ReencoderContext* ctx, ReencoderUnicodeStruct* unicode_struct, const char* description) {
+	if (unicode_struct == NULL) {
+		return;
+	}
+
+	enum ReencoderEncodeType source_encoding = reference->source_encoding;
+	unsigned int is_valid = reference->validity == _reencoder_fuzz_valid_outcome(source_encoding, 0);
+	_reencoder_fuzz_check_struct(reference, unicode_struct, source_encoding, reference->validity, reference->source_bytes, reference->num_bytes, is_valid ? reference->num_chars : 0, description);
+
+	ReencoderUnicodeStruct* duplicate = reencoder_unicode_struct_duplicate(unicode_struct);
+
+	unsigned int repair_outcome = reencoder_repair_struct_ctx(ctx, unicode_struct);
+	if (is_valid) {
+		_REENCODER_FUZZ_CHECK(reference, repair_outcome == REENCODER_REPAIR_FAILURE_NO_OP, "reencoder_repair_struct_ctx() of a well-formed struct");
+	}
+	else if (repair_outcome != REENCODER_REPAIR_FAILURE_OOM) {
+		_REENCODER_FUZZ_CHECK(reference, repair_outcome == REENCODER_REPAIR_SUCCESS, "reencoder_repair_struct_ctx() outcome");
+		_reencoder_fuzz_check_struct(reference, unicode_struct, source_encoding, _reencoder_fuzz_valid_outcome(source_encoding, 1),
+			reference->repaired, reference->repaired_bytes, reference->num_chars, "reencoder_repair_struct_ctx()"
+		);
+	}
+
+	// repairing a struct must never show through a duplicate sharing its buffer, and the duplicate repairs just the same on its own
+	if (duplicate != NULL) {
+		_reencoder_fuzz_check_struct(reference, duplicate, source_encoding, reference->validity, reference->source_bytes, reference->num_bytes, is_valid ? reference->num_chars : 0, "duplicate of a repaired struct");
+
+		repair_outcome = reencoder_repair_struct(duplicate);
+		if (!is_valid && repair_outcome != REENCODER_REPAIR_FAILURE_OOM) {
+			_REENCODER_FUZZ_CHECK(reference, repair_outcome == REENCODER_REPAIR_SUCCESS, "reencoder_repair_struct() outcome");
+			_reencoder_fuzz_check_struct(reference, duplicate, source_encoding, _reencoder_fuzz_valid_outcome(source_encoding, 1),
+				reference->repaired, reference->repaired_bytes, reference->num_chars, "reencoder_repair_struct()"
+			);
+		}
+		reencoder_unicode_struct_free(&duplicate);
+	}
+
+	reencoder_unicode_struct_free(&unicode_struct);
+}
+
+static void _reencoder_fuzz_check_struct(const _ReencoderFuzzReference* reference, const ReencoderUnicodeStruct* unicode_struct, enum ReencoderEncodeType type, unsigned int validity, const uint8_t* expected, size_t expected_bytes, size_t num_chars, const char* description) {
+	if (unicode_struct == NULL) {
+		return;
+	}
+
+	_REENCODER_FUZZ_CHECK(reference, unicode_struct->string_type == type, description);
+	_REENCODER_FUZZ_CHECK(reference, unicode_struct->string_validity == validity, description);
+	_REENCODER_FUZZ_CHECK(reference, unicode_struct->num_bytes == expected_bytes, description);
+	_REENCODER_FUZZ_CHECK(reference, unicode_struct->num_chars == num_chars, description);
+
+	// write_to_buffer hands out the string in the byte order of its encoding, however the struct stores it
+	uint8_t* written = (uint8_t*)malloc(expected_bytes + 1);
+	if (written == NULL) {
+		return;
+	}
+	size_t written_bytes = reencoder_write_to_buffer((ReencoderUnicodeStruct*)unicode_struct, written, 0);
+	_REENCODER_FUZZ_CHECK(reference, written_bytes == expected_bytes, description);
+	_REENCODER_FUZZ_CHECK(reference, memcmp(written, expected, expected_bytes) == 0, description);
+	free(written);
+}
+
+static unsigned int _reencoder_fuzz_valid_outcome(enum ReencoderEncodeType type, unsigned int is_repaired) {
+	if (type == UTF_8) {
+		return is_repaired ? REENCODER_UTF8_VALID_REPAIRED : REENCODER_UTF8_VALID;
+	}
+	if (type == UTF_16BE || type == UTF_16LE) {
+		return is_repaired ? REENCODER_UTF16_VALID_REPAIRED : REENCODER_UTF16_VALID;
+	}
+
+	return is_repaired ? REENCODER_UTF32_VALID_REPAIRED : REENCODER_UTF32_VALID;
+}
+
+static void _reencoder_fuzz_load_units(void* dest, const uint8_t* src, size_t num_units, enum ReencoderEncodeType type) {
+	for (size_t i = 0; i < num_units; i++) {
+		if (type == UTF_8) {
+			((uint8_t*)dest)[i] = src[i];
+		}
+		else if (type == UTF_16BE) {
+			((uint16_t*)dest)[i] = (uint16_t)((src[(i * 2) + 0] << 8) | src[(i * 2) + 1]);
+		}
+		else if (type == UTF_16LE) {
+			((uint16_t*)dest)[i] = (uint16_t)((src[(i * 2) + 1] << 8) | src[(i * 2) + 0]);
+		}
+		else if (type == UTF_32BE) {
+			((uint32_t*)dest)[i] = ((uint32_t)src[(i * 4) + 0] << 24) | ((uint32_t)src[(i * 4) + 1] << 16) | ((uint32_t)src[(i * 4) + 2] << 8) | (uint32_t)src[(i * 4) + 3];
+		}
+		else {
+			((uint32_t*)dest)[i] = ((uint32_t)src[(i * 4) + 3] << 24) | ((uint32_t)src[(i * 4) + 2] << 16) | ((uint32_t)src[(i * 4) + 1] << 8) | (uint32_t)src[(i * 4) + 0];
+		}
+	}
+}
+
+static void _reencoder_fuzz_store_units(uint8_t* dest, const void* src, size_t num_units, enum ReencoderEncodeType type) {
+	for (size_t i = 0; i < num_units; i++) {
+		if (type == UTF_8) {
+			dest[i] = ((const uint8_t*)src)[i];
+		}
+		else if (type == UTF_16BE || type == UTF_16LE) {
+			uint16_t unit = ((const uint16_t*)src)[i];
+			dest[(i * 2) + (type == UTF_16BE ? 0 : 1)] = (uint8_t)(unit >> 8);
+			dest[(i * 2) + (type == UTF_16BE ? 1 : 0)] = (uint8_t)(unit & 0xFF);
+		}
+		else {
+			uint32_t unit = ((const uint32_t*)src)[i];
+			for (size_t byte = 0; byte < 4; byte++) {
+				size_t shift = type == UTF_32BE ? (3 - byte) * 8 : byte * 8;
+				dest[(i * 4) + byte] = (uint8_t)(unit >> shift);
+			}
+		}
+	}
+}
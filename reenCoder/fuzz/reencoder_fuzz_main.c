@@ -0,0 +1,84 @@
+#include "reencoder_fuzz.h"
+
+/**
+ * @brief Reads a whole file (or stdin) into a new buffer.
+ *
+ * @return Newly allocated buffer holding the contents, or NULL if the file could not be read.
+ */
+static uint8_t* _reencoder_fuzz_read_file(FILE* fp, size_t* size);
+
+/**
+ * @brief Standalone driver, used wherever the fuzzer does not provide its own main().
+ *
+ * Replays every file given on the command line through `LLVMFuzzerTestOneInput()`, or a single input read from stdin if no file is given.
+ * This is how AFL++ runs the harness without libFuzzer, and how crashing inputs are replayed in a debugger or as a regression run over a corpus.
+ */
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		size_t size = 0;
+		uint8_t* data = _reencoder_fuzz_read_file(stdin, &size);
+		if (data == NULL) {
+			fprintf(stderr, "reencoder_fuzz: failed to read stdin\n");
+			return 1;
+		}
+
+		LLVMFuzzerTestOneInput(data, size);
+		free(data);
+
+		return 0;
+	}
+
+	for (int i = 1; i < argc; i++) {
+		FILE* fp = fopen(argv[i], "rb");
+		if (fp == NULL) {
+			fprintf(stderr, "reencoder_fuzz: failed to open %s\n", argv[i]);
+			return 1;
+		}
+
+		size_t size = 0;
+		uint8_t* data = _reencoder_fuzz_read_file(fp, &size);
+		fclose(fp);
+		if (data == NULL) {
+			fprintf(stderr, "reencoder_fuzz: failed to read %s\n", argv[i]);
+			return 1;
+		}
+
+		LLVMFuzzerTestOneInput(data, size);
+		free(data);
+	}
+
+	printf("reencoder_fuzz: %d inputs match the scalar reference\n", argc - 1);
+
+	return 0;
+}
+
+static uint8_t* _reencoder_fuzz_read_file(FILE* fp, size_t* size) {
+	size_t capacity = 4096;
+	size_t length = 0;
+	uint8_t* data = (uint8_t*)malloc(capacity);
+	if (data == NULL) {
+		return NULL;
+	}
+
+	size_t bytes_read = 0;
+	while ((bytes_read = fread(data + length, 1, capacity - length, fp)) > 0) {
+		length += bytes_read;
+		if (length == capacity) {
+			uint8_t* grown = (uint8_t*)realloc(data, capacity * 2);
+			if (grown == NULL) {
+				free(data);
+				return NULL;
+			}
+			data = grown;
+			capacity *= 2;
+		}
+	}
+	if (ferror(fp)) {
+		free(data);
+		return NULL;
+	}
+
+	*size = length;
+
+	return data;
+}
@@ -0,0 +1,94 @@
+#include "reencoder_fuzz.h"
+#include "../tests_cmocka/reencoder_test_utf_strings.h"
+
+/**
+ * @brief One test string of tests_cmocka/reencoder_test_utf_strings.h, as bytes in the byte order of its encoding.
+ */
+typedef struct {
+	const char* name;
+	enum ReencoderEncodeType encoding;
+	const uint8_t* bytes;
+	size_t num_bytes;
+} _ReencoderFuzzSeed;
+
+#define _REENCODER_FUZZ_SEED(string, encoding) { #string, (encoding), (const uint8_t*)(string), sizeof(string) }
+
+// uint16_t and uint32_t test strings are in system endianness, so only their byte-order twins (u8le and u8be) are used
+static const _ReencoderFuzzSeed _REENCODER_FUZZ_SEEDS[] = {
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_valid_1_byte, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_valid_2_byte, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_valid_3_byte, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_valid_4_byte, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_valid_long_sequence, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_invalid_lead, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_truncated, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_invalid_cont, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_overlong_2, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_overlong_3, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_overlong_4, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_surrogate_pair, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_out_of_range, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_repair_broken, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_8_repair_sparse_broken, UTF_8),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8le_valid_2_byte, UTF_16LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8be_valid_2_byte, UTF_16BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8le_valid_4_byte, UTF_16LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8be_valid_4_byte, UTF_16BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8le_valid_long_sequence, UTF_16LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8be_valid_long_sequence, UTF_16BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8le_only_high_surrogate, UTF_16LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8be_only_high_surrogate, UTF_16BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8le_only_low_surrogate, UTF_16LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8be_only_low_surrogate, UTF_16BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_u8le_odd_broken, UTF_16LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_16_repair_broken, UTF_16LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_u8le_valid, UTF_32LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_u8be_valid, UTF_32BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_u8le_valid_long_sequence, UTF_32LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_u8be_valid_long_sequence, UTF_32BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_u8le_surrogate, UTF_32LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_u8be_surrogate, UTF_32BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_u8le_out_of_range, UTF_32LE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_u8be_out_of_range, UTF_32BE),
+	_REENCODER_FUZZ_SEED(_reencoder_test_string_utf_32_repair_broken, UTF_32LE)
+};
+#define _REENCODER_FUZZ_NUM_SEEDS (sizeof(_REENCODER_FUZZ_SEEDS) / sizeof(_REENCODER_FUZZ_SEEDS[0]))
+
+/**
+ * @brief Writes the seed corpus: every test string paired with every target encoding, one file each.
+ *
+ * Each file is a selector byte followed by the test string (see `_ReencoderFuzzReference`), named after the test string and its target encoding.
+ */
+int main(int argc, char** argv) {
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <existing output directory>\n", argv[0]);
+		return 1;
+	}
+
+	size_t files_written = 0;
+	for (size_t i = 0; i < _REENCODER_FUZZ_NUM_SEEDS; i++) {
+		const _ReencoderFuzzSeed* seed = &_REENCODER_FUZZ_SEEDS[i];
+
+		for (unsigned int target = 0; target < _REENCODER_FUZZ_NUM_ENCODINGS; target++) {
+			char path[512];
+			snprintf(path, sizeof(path), "%s/%s_to_%s", argv[1], seed->name + strlen("_reencoder_test_string_"), reencoder_encode_type_as_str(target));
+
+			FILE* fp = fopen(path, "wb");
+			if (fp == NULL) {
+				fprintf(stderr, "failed to create %s\n", path);
+				return 1;
+			}
+
+			uint8_t selector = (uint8_t)((target * _REENCODER_FUZZ_NUM_ENCODINGS) + seed->encoding);
+			fwrite(&selector, 1, 1, fp);
+			fwrite(seed->bytes, 1, seed->num_bytes, fp);
+			fclose(fp);
+
+			files_written++;
+		}
+	}
+
+	printf("wrote %zu seeds to %s\n", files_written, argv[1]);
+
+	return 0;
+}
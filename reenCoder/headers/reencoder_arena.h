@@ -0,0 +1,109 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define _REENCODER_ARENA_DEFAULT_CHUNK_SIZE 16384
+#define _REENCODER_ARENA_ALIGNMENT 16
+
+/**
+ * @brief Header of a single chunk owned by a `ReencoderArena`.
+ *
+ * Chunks are singly linked in allocation order. The usable memory of a chunk starts right after this header
+ * (rounded up to _REENCODER_ARENA_ALIGNMENT) and spans capacity bytes, of which used bytes have been handed out.
+ */
+typedef struct _ReencoderArenaChunk {
+	struct _ReencoderArenaChunk* next;
+	size_t capacity;
+	size_t used;
+} _ReencoderArenaChunk;
+
+/**
+ * @brief Chunked bump allocator for `ReencoderUnicodeStruct`s and their string buffers.
+ *
+ * Contains the first chunk (head), the chunk currently being bumped (current), and the default size of new chunks (chunk_size).
+ * Allocations are never freed individually; memory is reclaimed all at once using `reencoder_arena_reset()` or `reencoder_arena_destroy()`.
+ * An arena is not thread-safe, use one arena per thread.
+ */
+typedef struct {
+	_ReencoderArenaChunk* head;
+	_ReencoderArenaChunk* current;
+	size_t chunk_size;
+} ReencoderArena;
+
+/**
+ * @brief Creates an empty `ReencoderArena`.
+ *
+ * No chunk is allocated until the first allocation is made from the arena.
+ * Requests larger than chunk_size are placed in a dedicated chunk of exactly the requested size.
+ *
+ * The returned `ReencoderArena` must be freed using `reencoder_arena_destroy()` once it is no longer needed.
+ *
+ * @param[in] chunk_size Size in bytes of each chunk. 0 selects the default (_REENCODER_ARENA_DEFAULT_CHUNK_SIZE).
+ *
+ * @return Pointer to a `ReencoderArena`.
+ * @retval NULL If memory allocation fails.
+ */
+ReencoderArena* reencoder_arena_create(size_t chunk_size);
+
+/**
+ * @brief Marks all memory in a `ReencoderArena` as unused, keeping its chunks for reuse.
+ *
+ * Every `ReencoderUnicodeStruct` allocated from the arena becomes invalid after this call and must not be used (or freed) again.
+ *
+ * @param[in] arena Pointer to the `ReencoderArena` to be reset.
+ *
+ * @return void
+ */
+void reencoder_arena_reset(ReencoderArena* arena);
+
+/**
+ * @brief Frees a `ReencoderArena` and every chunk it owns.
+ *
+ * Every `ReencoderUnicodeStruct` allocated from the arena becomes invalid after this call.
+ *
+ * @param[in] arena Address of the pointer to the `ReencoderArena` to be freed.
+ *
+ * @return void
+ */
+void reencoder_arena_destroy(ReencoderArena** arena);
+
+/**
+ * @brief Allocates a block of memory from a `ReencoderArena`.
+ *
+ * The returned block is aligned to _REENCODER_ARENA_ALIGNMENT and remains valid until the arena is reset or destroyed.
+ *
+ * @param[in] arena Pointer to the `ReencoderArena` to allocate from.
+ * @param[in] bytes Number of bytes to allocate.
+ *
+ * @return Pointer to the allocated block.
+ * @retval NULL If arena is NULL or memory allocation fails.
+ */
+void* _reencoder_arena_alloc(ReencoderArena* arena, size_t bytes);
+
+/**
+ * @brief Allocates memory either from a `ReencoderArena` or from the heap.
+ *
+ * Intended for internal use by reencoder_utf_* functions which can place their results in an arena.
+ *
+ * @param[in] arena Pointer to the `ReencoderArena` to allocate from. NULL allocates from the heap using malloc().
+ * @param[in] bytes Number of bytes to allocate.
+ *
+ * @return Pointer to the allocated block.
+ * @retval NULL If memory allocation fails.
+ */
+void* _reencoder_alloc(ReencoderArena* arena, size_t bytes);
+
+/**
+ * @brief Releases memory obtained from `_reencoder_alloc()`.
+ *
+ * No-op for arena memory, which is only reclaimed by `reencoder_arena_reset()` or `reencoder_arena_destroy()`.
+ *
+ * @param[in] arena Pointer to the `ReencoderArena` the block was allocated from. NULL if the block was allocated from the heap.
+ * @param[in] ptr Block to be released. Can be NULL.
+ *
+ * @return void
+ */
+void _reencoder_free(ReencoderArena* arena, void* ptr);
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "reencoder_utf_common.h"
+#include "reencoder_thread_pool.h"
+
+#define _REENCODER_BATCH_TASK_MAX_STRINGS 64
+#define _REENCODER_BATCH_TASK_MAX_UNITS 65536
+
+/**
+ * @brief Results of converting many strings at once, laid out as a structure of arrays.
+ *
+ * Contains the encoding of every output string (string_type), a single buffer holding all output strings back to back (buffer),
+ * the number of bytes used in buffer (buffer_bytes), and the number of strings in the batch (num_strings).
+ * For each string i, offsets[i] is the byte offset of its first code unit in buffer, num_bytes[i] its length in bytes excluding the null-terminator,
+ * num_chars[i] its number of characters, and validity[i] its outcome.
+ * Every output string is null-terminated and stored in the byte order of string_type.
+ * A string that failed validation keeps the error outcome of source_encoding in validity and is stored as an empty string.
+ */
+typedef struct {
+	enum ReencoderEncodeType string_type;
+	uint8_t* buffer;
+	size_t buffer_bytes;
+	size_t num_strings;
+	size_t* offsets;
+	size_t* num_bytes;
+	size_t* num_chars;
+	unsigned int* validity;
+} ReencoderBatch;
+
+/**
+ * @brief Shared state of one `reencoder_convert_batch_pool()` call, handed to every task run by the pool.
+ *
+ * Contains the call's arguments, the batch being filled (batch), the first string of every task with one extra entry marking the end (task_starts),
+ * the worker each task ran on (task_workers), the number of code units each worker has written to its scratch buffer (worker_units),
+ * and whether any worker ran out of memory (has_failed).
+ * While the pool runs, batch->offsets holds byte offsets into the scratch buffer of the worker that converted the string.
+ */
+typedef struct {
+	ReencoderThreadPool* pool;
+	enum ReencoderEncodeType source_encoding;
+	enum ReencoderEncodeType target_encoding;
+	const void* const* inputs;
+	const size_t* lengths;
+	ReencoderBatch* batch;
+	size_t* task_starts;
+	size_t* task_workers;
+	size_t* worker_units;
+	volatile long has_failed;
+} _ReencoderBatchJob;
+
+/**
+ * @brief Converts an array of UTF strings to another encoding, placing all results in a single `ReencoderBatch`.
+ *
+ * Intended for large numbers of short strings, where per-call setup would otherwise dominate.
+ * Output strings share one growing buffer and the per-string results share one block, so the number of allocations does not depend on num_strings.
+ * Input strings follow the same rules as in `reencoder_convert()`, each input ends at its length or at its first null code unit, whichever comes first.
+ * A NULL entry in inputs is treated as an empty string.
+ *
+ * The returned `ReencoderBatch` must be freed using `reencoder_batch_free()` once it is no longer needed.
+ *
+ * @param[in] source_encoding Specifies source encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE). Source endian should follow system endianness.
+ * @param[in] target_encoding Specifies target encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE).
+ * @param[in] inputs Array of input strings. Each must be represented as a uint8_t* (UTF-8), uint16_t* (UTF-16), or uint32_t* (UTF-32) and cast to const void*.
+ * @param[in] lengths Array of input lengths in code units (not bytes). NULL if every input is null-terminated.
+ * @param[in] num_strings Number of entries in inputs (and lengths).
+ *
+ * @return Pointer to a `ReencoderBatch` containing every converted string.
+ * @retval NULL If memory allocation fails, inputs is NULL while num_strings is not 0, or an invalid `source_encoding` or `target_encoding` is provided.
+ */
+ReencoderBatch* reencoder_convert_batch(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* const* inputs, const size_t* lengths, size_t num_strings);
+
+/**
+ * @brief Converts an array of UTF strings to another encoding across the workers of a `ReencoderThreadPool`.
+ *
+ * Behaves like `reencoder_convert_batch()`. Strings are grouped into tasks of up to _REENCODER_BATCH_TASK_MAX_STRINGS strings
+ * or _REENCODER_BATCH_TASK_MAX_UNITS code units, and idle workers steal tasks from busy ones, so batches mixing very short and very long strings stay balanced.
+ * Lengths are only known up front if lengths is not NULL, so passing lengths gives the best balance.
+ * Each worker writes into its own scratch buffer, which are stitched into the batch buffer once every task has completed.
+ * Strings therefore stay contiguous and null-terminated, but are not necessarily stored in input order; use offsets to locate them.
+ *
+ * The returned `ReencoderBatch` must be freed using `reencoder_batch_free()` once it is no longer needed.
+ *
+ * @param[in] pool Pool to run the conversion on. NULL, or a pool with a single worker, converts on the calling thread like `reencoder_convert_batch()`.
+ * @param[in] source_encoding Specifies source encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE). Source endian should follow system endianness.
+ * @param[in] target_encoding Specifies target encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE).
+ * @param[in] inputs Array of input strings. Each must be represented as a uint8_t* (UTF-8), uint16_t* (UTF-16), or uint32_t* (UTF-32) and cast to const void*.
+ * @param[in] lengths Array of input lengths in code units (not bytes). NULL if every input is null-terminated.
+ * @param[in] num_strings Number of entries in inputs (and lengths).
+ *
+ * @return Pointer to a `ReencoderBatch` containing every converted string.
+ * @retval NULL If memory allocation fails, inputs is NULL while num_strings is not 0, or an invalid `source_encoding` or `target_encoding` is provided.
+ */
+ReencoderBatch* reencoder_convert_batch_pool(ReencoderThreadPool* pool, enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* const* inputs, const size_t* lengths, size_t num_strings);
+
+/**
+ * @brief Frees a `ReencoderBatch` and every string it holds.
+ *
+ * @param[in] batch Address of the pointer to the `ReencoderBatch` to be freed.
+ *
+ * @return void
+ */
+void reencoder_batch_free(ReencoderBatch** batch);
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "reencoder_arena.h"
+#include "reencoder_stats.h"
+#include "reencoder_trace.h"
+
+#define _REENCODER_CONTEXT_GROW_RATE 2 // scratch buffers grow at least by this factor, and a handed-over buffer larger than this many times its string is trimmed
+
+/**
+ * @brief Enum containing memory footprint policies for a `ReencoderContext`.
+ *
+ * REENCODER_MEMORY_POLICY_FAST keeps the output scratch buffer in the context for the next call, and copies every result out of it at its exact size.
+ * REENCODER_MEMORY_POLICY_COMPACT hands the output scratch buffer over to the resulting struct, trimmed to its exact size, so the context holds no output memory between calls.
+ * Calls made without a context hand their scratch buffer over as well, trimming it only if it is more than _REENCODER_CONTEXT_GROW_RATE times the size of the result.
+ * Results placed in a `ReencoderArena` are always exactly sized.
+ */
+enum ReencoderMemoryPolicy {
+	REENCODER_MEMORY_POLICY_FAST,
+	REENCODER_MEMORY_POLICY_COMPACT
+};
+
+/**
+ * @brief Reusable conversion context holding scratch buffers that persist across calls.
+ *
+ * Contains a scratch buffer for native-endian copies of source strings (scratch_source), a scratch buffer
+ * for re-encoded output (scratch_output), their current sizes in bytes, an optional arena results are placed in (arena),
+ * whether the context only lives for the duration of one call (is_transient), whether the output scratch buffer is kept or handed over to results (memory_policy),
+ * whether UTF-16/UTF-32 results are kept in system byte order (host_order_storage), and the largest result allowed as a percentage of its input (max_expansion_percent, 0 if unlimited).
+ * Scratch buffers only ever grow, so a context reaches a steady state with no allocations other than the results themselves.
+ * A context is not thread-safe, use one context per thread.
+ */
+typedef struct {
+	void* scratch_source;
+	size_t scratch_source_size;
+	void* scratch_output;
+	size_t scratch_output_size;
+	ReencoderArena* arena;
+	unsigned int is_transient;
+	enum ReencoderMemoryPolicy memory_policy;
+	unsigned int host_order_storage;
+	size_t max_expansion_percent;
+} ReencoderContext;
+
+/**
+ * @brief Creates a `ReencoderContext` with empty scratch buffers.
+ *
+ * The returned `ReencoderContext` must be freed using `reencoder_context_destroy()` once it is no longer needed.
+ *
+ * @param[in] arena Arena that `ReencoderUnicodeStruct`s created through this context are placed in. NULL allocates results from the heap.
+ *
+ * @return Pointer to a `ReencoderContext`.
+ * @retval NULL If memory allocation fails.
+ */
+ReencoderContext* reencoder_context_create(ReencoderArena* arena);
+
+/**
+ * @brief Frees a `ReencoderContext` and its scratch buffers.
+ *
+ * Does not destroy the arena attached to the context.
+ *
+ * @param[in] ctx Address of the pointer to the `ReencoderContext` to be freed.
+ *
+ * @return void
+ */
+void reencoder_context_destroy(ReencoderContext** ctx);
+
+/**
+ * @brief Sets the memory footprint policy of a `ReencoderContext`.
+ *
+ * Contexts start out with REENCODER_MEMORY_POLICY_FAST.
+ *
+ * @param[in] ctx Pointer to the `ReencoderContext` to be updated.
+ * @param[in] memory_policy Policy to be used for subsequent calls.
+ *
+ * @return void
+ */
+void reencoder_context_set_memory_policy(ReencoderContext* ctx, enum ReencoderMemoryPolicy memory_policy);
+
+/**
+ * @brief Sets whether UTF-16/UTF-32 results created through a `ReencoderContext` are stored in system byte order.
+ *
+ * Host-order results keep their requested endianness as string_type, but their string buffer is left in system byte order
+ * so that parsing and converting never byte-swap. The swap is applied when the struct is written out, or by `reencoder_unicode_struct_materialize()`.
+ * Contexts start out with host-order storage disabled.
+ *
+ * @param[in] ctx Pointer to the `ReencoderContext` to be updated.
+ * @param[in] host_order_storage 1 to store results in system byte order, 0 to store them in their requested byte order.
+ *
+ * @return void
+ */
+void reencoder_context_set_host_order_storage(ReencoderContext* ctx, unsigned int host_order_storage);
+
+/**
+ * @brief Caps the size of results created through a `ReencoderContext` relative to the size of their input, in bytes.
+ *
+ * Intended for untrusted input. Repairing UTF-8 turns every malformed byte into a 3-byte replacement character,
+ * and converting to UTF-32 turns every ASCII byte into 4 bytes, so without a cap output size is only bounded by these worst cases.
+ * Calls whose result would exceed the cap fail instead (`reencoder_convert_ctx()` returns NULL, `reencoder_repair_struct_ctx()` returns REENCODER_REPAIR_FAILURE_TOO_LARGE).
+ * A capped context also reserves its scratch buffer for the worst case allowed by the cap before starting, so conversions and repairs
+ * make a single pass with no reallocation, taking time linear in the input no matter how it is malformed.
+ * Contexts start out unlimited.
+ *
+ * @param[in] ctx Pointer to the `ReencoderContext` to be updated.
+ * @param[in] max_expansion_percent Largest result allowed, as a percentage of the input size (e.g. 300 allows results up to 3 times their input). 0 removes the cap.
+ *
+ * @return void
+ */
+void reencoder_context_set_max_expansion(ReencoderContext* ctx, size_t max_expansion_percent);
+
+/**
+ * @brief Prepares a stack-allocated `ReencoderContext` for a single call.
+ *
+ * Intended for internal use by functions that do not receive a context from the caller.
+ * Such a context must be released using `_reencoder_context_release()` before it goes out of scope.
+ *
+ * @param[out] ctx Pointer to the `ReencoderContext` to be prepared.
+ * @param[in] arena Arena that results are placed in. Can be NULL.
+ *
+ * @return void
+ */
+void _reencoder_context_init_transient(ReencoderContext* ctx, ReencoderArena* arena);
+
+/**
+ * @brief Frees the scratch buffers of a `ReencoderContext` without freeing the context itself.
+ *
+ * @param[in] ctx Pointer to the `ReencoderContext` whose scratch buffers are freed.
+ *
+ * @return void
+ */
+void _reencoder_context_release(ReencoderContext* ctx);
+
+/**
+ * @brief Ensures a scratch buffer can hold at least the requested number of bytes.
+ *
+ * The buffer keeps its contents when grown, and is never shrunk.
+ * On allocation failure the buffer is freed and its size is set to 0.
+ *
+ * @param[in,out] buffer Address of the scratch buffer pointer. Can point to NULL.
+ * @param[in,out] buffer_size_bytes Current size of the scratch buffer. Is updated to the new size during function call.
+ * @param[in] bytes_needed Minimum number of bytes required.
+ *
+ * @return Pointer to the scratch buffer (same as *buffer).
+ * @retval NULL If memory allocation fails.
+ */
+void* _reencoder_context_reserve(void** buffer, size_t* buffer_size_bytes, size_t bytes_needed);
+
+/**
+ * @brief Returns the largest result a `ReencoderContext` allows for an input of the given size.
+ *
+ * @param[in] ctx Pointer to the `ReencoderContext`.
+ * @param[in] input_bytes Size of the input in bytes.
+ *
+ * @return Largest allowed result in bytes, excluding the null-terminator.
+ * @retval SIZE_MAX If the context has no cap.
+ */
+size_t _reencoder_context_output_limit(const ReencoderContext* ctx, size_t input_bytes);
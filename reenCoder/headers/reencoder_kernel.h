@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "reencoder_utf_common.h"
+#include "reencoder_utf_8.h"
+
+// Conversion kernels, numbered after the REENCODER_STATS_TIER_* they are counted under
+#define _REENCODER_KERNEL_GENERAL REENCODER_STATS_TIER_SCALAR // decodes and encodes one character at a time, for text mixing every sequence length
+#define _REENCODER_KERNEL_ASCII REENCODER_STATS_TIER_ASCII // widens or narrows runs of ASCII several code units at a time
+#define _REENCODER_KERNEL_SUPPLEMENTARY REENCODER_STATS_TIER_SUPPLEMENTARY // checks for characters above U+FFFF (surrogate pairs, 4-byte sequences) first
+
+#define _REENCODER_KERNEL_ASCII_RUN 8 // code units an ASCII run is checked and copied in
+#define _REENCODER_KERNEL_SAMPLE_WINDOWS 4 // windows sampled: the start of the input, then evenly strided up to its end
+#define _REENCODER_KERNEL_SAMPLE_UNITS 64 // source code units per window
+#define _REENCODER_KERNEL_ASCII_PERMILLE 900 // share of ASCII characters from which the ASCII kernel is chosen
+#define _REENCODER_KERNEL_SUPPLEMENTARY_PERMILLE 250 // share of characters above U+FFFF from which the supplementary kernel is chosen
+#define _REENCODER_KERNEL_HYSTERESIS_PERMILLE 100 // how far a share must fall below its threshold before the thread leaves that kernel again
+#define _REENCODER_KERNEL_HISTORY_SHIFT 2 // each sample moves the thread's history 1 / 2^shift of the way towards it
+
+/**
+ * @brief Character distribution recently seen by the calling thread for one source encoding, and the kernel chosen from it.
+ *
+ * Contains the running shares (in permille) of ASCII characters (ascii_permille) and of characters above U+FFFF (supplementary_permille),
+ * the kernel last chosen (kernel), and whether anything was sampled yet (has_samples).
+ */
+typedef struct {
+	int32_t ascii_permille;
+	int32_t supplementary_permille;
+	unsigned int kernel;
+	unsigned int has_samples;
+} _ReencoderKernelHistory;
+
+/**
+ * @brief Samples the character distribution of a well-formed source buffer and picks the conversion kernel for it.
+ *
+ * Lead units are classified in up to _REENCODER_KERNEL_SAMPLE_WINDOWS windows of _REENCODER_KERNEL_SAMPLE_UNITS code units each (UTF-8 through
+ * `_reencoder_utf8_determine_length_from_first_byte()`), and the shares found are folded into a running history kept per thread and source encoding.
+ * The kernel is picked from that history with some hysteresis, so that a stream of similar strings keeps the same kernel even when a short one samples differently.
+ *
+ * @param[in] source_encoding Encoding of source_buffer, as enum ReencoderEncodeType.
+ * @param[in] source_buffer Pointer to well-formed code units in system endianness.
+ * @param[in] string_num_code_units Number of code units in source_buffer.
+ *
+ * @return _REENCODER_KERNEL_GENERAL, _REENCODER_KERNEL_ASCII or _REENCODER_KERNEL_SUPPLEMENTARY.
+ */
+unsigned int _reencoder_kernel_select(enum ReencoderEncodeType source_encoding, const void* source_buffer, size_t string_num_code_units);
+
+/**
+ * @brief Converts well-formed code units to another encoding, through the kernel picked by `_reencoder_kernel_select()`.
+ *
+ * Drop-in replacement for `_reencoder_change_encoding_dynamic()` on input that was already validated. Characters are not checked again, and the output buffer is
+ * reserved for the worst case once up front instead of being grown character by character.
+ * Source and output code units are in system endianness. The output is null-terminated, and output_buffer_index is advanced past the characters only.
+ *
+ * @param[in] source_encoding Encoding of source_buffer, as enum ReencoderEncodeType.
+ * @param[in] target_encoding Encoding to convert to, as enum ReencoderEncodeType.
+ * @param[in] string_num_code_units Number of code units in source_buffer.
+ * @param[in,out] output_buffer_index Pointer to the index (in target code units) to write from, advanced past every unit written.
+ * @param[in,out] output_buffer_size Pointer to the size in bytes of output_buffer, updated if it grows.
+ * @param[in] source_buffer Pointer to well-formed code units.
+ * @param[in,out] output_buffer Pointer to the output buffer, reallocated if it is too small. Freed and set to NULL if that fails.
+ * @param[in] max_output_bytes Largest output allowed in bytes, excluding the null-terminator. SIZE_MAX if unlimited.
+ * @param[out] kernel Pointer to where the kernel used will be stored, NULL if not needed.
+ *
+ * @return REENCODER_CONVERT_SUCCESS if the conversion was successful.
+ * @retval REENCODER_CONVERT_FAILURE_NULL_ARGS if any of the required pointers are NULL.
+ * @retval REENCODER_CONVERT_FAILURE_OOM if the output buffer could not be reserved.
+ * @retval REENCODER_CONVERT_FAILURE_TOO_LARGE if the output grew past max_output_bytes. Conversion stops as soon as this is detected.
+ */
+unsigned int _reencoder_kernel_convert(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer, size_t max_output_bytes, unsigned int* kernel);
+
+/**
+ * @brief Checks if the REENCODER_CHARS_* flags of a well-formed source string let it be converted without decoding.
+ *
+ * That is the case for ASCII to or from UTF-8 (one unit per character on both sides), Latin-1 to or from UTF-8 (one or two bytes per character, one unit on the other side),
+ * and BMP between UTF-16 and UTF-32 (no surrogate pairs, one unit per character on both sides).
+ * Encodings of the same code unit width are left to a plain copy and are not covered.
+ *
+ * @param[in] source_encoding Encoding of the source string, as enum ReencoderEncodeType.
+ * @param[in] target_encoding Encoding to convert to, as enum ReencoderEncodeType.
+ * @param[in] char_flags REENCODER_CHARS_* flags found while validating the source string.
+ *
+ * @return 1 if `_reencoder_kernel_convert_trivial()` can be used, 0 if the string has to go through `_reencoder_kernel_convert()`.
+ */
+unsigned int _reencoder_kernel_has_trivial_path(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, unsigned int char_flags);
+
+/**
+ * @brief Converts well-formed code units to another encoding by widening or narrowing them, for strings `_reencoder_kernel_has_trivial_path()` accepts.
+ *
+ * Same contract as `_reencoder_kernel_convert()`, without picking a kernel. Latin-1 UTF-8 is read and written one or two bytes at a time, everything else one unit at a time.
+ *
+ * @param[in] source_encoding Encoding of source_buffer, as enum ReencoderEncodeType.
+ * @param[in] target_encoding Encoding to convert to, as enum ReencoderEncodeType.
+ * @param[in] char_flags REENCODER_CHARS_* flags found while validating source_buffer.
+ * @param[in] string_num_code_units Number of code units in source_buffer.
+ * @param[in,out] output_buffer_index Pointer to the index (in target code units) to write from, advanced past every unit written.
+ * @param[in,out] output_buffer_size Pointer to the size in bytes of output_buffer, updated if it grows.
+ * @param[in] source_buffer Pointer to well-formed code units.
+ * @param[in,out] output_buffer Pointer to the output buffer, reallocated if it is too small. Freed and set to NULL if that fails.
+ * @param[in] max_output_bytes Largest output allowed in bytes, excluding the null-terminator. SIZE_MAX if unlimited.
+ *
+ * @return REENCODER_CONVERT_SUCCESS if the conversion was successful.
+ * @retval REENCODER_CONVERT_FAILURE_NULL_ARGS if any of the required pointers are NULL.
+ * @retval REENCODER_CONVERT_FAILURE_OOM if the output buffer could not be reserved.
+ * @retval REENCODER_CONVERT_FAILURE_TOO_LARGE if the output grew past max_output_bytes. Conversion stops as soon as this is detected.
+ */
+unsigned int _reencoder_kernel_convert_trivial(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, unsigned int char_flags, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer, size_t max_output_bytes);
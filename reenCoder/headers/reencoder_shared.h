@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#if defined(_WIN32)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Control block for a string buffer shared between several `ReencoderUnicodeStruct`s.
+ *
+ * Contains the number of structs currently referencing the buffer (refcount) and the shared buffer itself (buffer).
+ * The refcount is only ever accessed atomically, so structs sharing a buffer may be used and freed from different threads.
+ * A control block is only created once a buffer is actually shared, so unshared buffers carry no overhead.
+ */
+typedef struct {
+	volatile long refcount;
+	uint8_t* buffer;
+} _ReencoderSharedBuffer;
+
+/**
+ * @brief Creates a control block for a heap buffer.
+ *
+ * @param[in] buffer Heap buffer to be shared. Ownership passes to the control block.
+ * @param[in] refcount Initial number of references.
+ *
+ * @return Pointer to a `_ReencoderSharedBuffer`.
+ * @retval NULL If memory allocation fails.
+ */
+_ReencoderSharedBuffer* _reencoder_shared_buffer_create(uint8_t* buffer, long refcount);
+
+/**
+ * @brief Adds a reference to a shared buffer.
+ *
+ * @param[in] shared_buffer Pointer to the control block.
+ *
+ * @return void
+ */
+void _reencoder_shared_buffer_retain(_ReencoderSharedBuffer* shared_buffer);
+
+/**
+ * @brief Drops a reference to a shared buffer, freeing the buffer and its control block when the last reference is dropped.
+ *
+ * @param[in] shared_buffer Pointer to the control block. Must not be used after this call.
+ *
+ * @return 1 if the buffer was freed, 0 if other references remain.
+ */
+unsigned int _reencoder_shared_buffer_release(_ReencoderSharedBuffer* shared_buffer);
+
+/**
+ * @brief Returns the current number of references to a shared buffer.
+ *
+ * @param[in] shared_buffer Pointer to the control block.
+ *
+ * @return Number of references.
+ */
+long _reencoder_shared_buffer_refcount(_ReencoderSharedBuffer* shared_buffer);
+
+/**
+ * @brief Atomically increments a counter.
+ *
+ * Uses Interlocked intrinsics on Windows and GCC/Clang __atomic builtins elsewhere.
+ *
+ * @param[in,out] value Pointer to the counter.
+ *
+ * @return Value of the counter after the increment.
+ */
+long _reencoder_atomic_increment(volatile long* value);
+
+/**
+ * @brief Atomically decrements a counter.
+ *
+ * Uses Interlocked intrinsics on Windows and GCC/Clang __atomic builtins elsewhere.
+ *
+ * @param[in,out] value Pointer to the counter.
+ *
+ * @return Value of the counter after the decrement.
+ */
+long _reencoder_atomic_decrement(volatile long* value);
+
+/**
+ * @brief Atomically reads a counter.
+ *
+ * @param[in] value Pointer to the counter.
+ *
+ * @return Current value of the counter.
+ */
+long _reencoder_atomic_load(volatile long* value);
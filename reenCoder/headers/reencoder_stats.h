@@ -0,0 +1,259 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <intrin.h>
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#if defined(_MSC_VER)
+#define _REENCODER_STATS_THREAD_LOCAL __declspec(thread)
+#else
+#define _REENCODER_STATS_THREAD_LOCAL _Thread_local
+#endif
+
+#define REENCODER_STATS_NUM_ENCODINGS 5 // indexed by enum ReencoderEncodeType
+#define REENCODER_STATS_NUM_FAMILIES 3 // UTF-8, UTF-16, UTF-32
+#define REENCODER_STATS_NUM_OUTCOMES 10 // indexed by outcome minus the parse offset of its family, like ReencoderErrorReport.histogram
+
+// Kernels a call can be dispatched to
+#define REENCODER_STATS_TIER_SCALAR 0 // one character at a time
+#define REENCODER_STATS_TIER_WORD 1 // clean runs skipped several code units at a time through a machine word
+#define REENCODER_STATS_TIER_COPY 2 // copied or byte-swapped as-is, or widened and narrowed directly where REENCODER_CHARS_* flags allow, without decoding
+#define REENCODER_STATS_TIER_ASCII 3 // converted with ASCII runs widened or narrowed several code units at a time, picked for mostly-ASCII input
+#define REENCODER_STATS_TIER_SUPPLEMENTARY 4 // converted checking for characters above U+FFFF first, picked for input heavy in surrogate pairs or 4-byte sequences
+#define REENCODER_STATS_NUM_TIERS 5
+
+// Public entry points timed per call, only the outermost one is recorded when they call each other
+#define REENCODER_STATS_CALL_PARSE 0 // reencoder_utf*_parse*()
+#define REENCODER_STATS_CALL_CONVERT 1 // reencoder_convert*()
+#define REENCODER_STATS_CALL_REPAIR 2 // reencoder_repair_struct*()
+#define REENCODER_STATS_CALL_WRITE 3 // reencoder_write_to_buffer(), reencoder_write_to_file()
+#define REENCODER_STATS_NUM_CALLS 4
+
+// Histograms split every power of two into 2^REENCODER_STATS_SUB_BUCKET_BITS linear sub-buckets (values below that get a bucket each),
+// so a bucket is never wider than a quarter of its lower bound, up to the largest uint64_t
+#define REENCODER_STATS_SUB_BUCKET_BITS 2
+#define REENCODER_STATS_NUM_BUCKETS ((64 - REENCODER_STATS_SUB_BUCKET_BITS + 1) << REENCODER_STATS_SUB_BUCKET_BITS)
+
+// Formats of reencoder_stats_dump()
+#define REENCODER_STATS_DUMP_TEXT 0 // Prometheus text exposition format
+#define REENCODER_STATS_DUMP_JSON 1
+
+/**
+ * @brief Counters of the work done by the library, filled in by `reencoder_stats_get()`.
+ *
+ * Contains the bytes of input checked by parse, convert and validate calls per encoding (bytes_validated),
+ * the bytes of input converted per source and target encoding (bytes_converted), the U+FFFD characters written by repairs per encoding (replacements_inserted),
+ * the malformed inputs found per encoding family and outcome (malformed_inputs), the number of times an output or scratch buffer was reallocated (buffer_grows),
+ * the largest size in bytes any of those buffers was grown to (peak_buffer_bytes), and the number of calls dispatched to each kernel (tier_calls).
+ * Per public entry point, it also contains the number of calls (call_count), their total latency and input size (call_latency_sum_ns, call_input_bytes_sum),
+ * and histograms of both (call_latency_ns, call_input_bytes).
+ * Encodings are indexed by `enum ReencoderEncodeType`, families by 0 (UTF-8), 1 (UTF-16) and 2 (UTF-32), tiers by REENCODER_STATS_TIER_*,
+ * entry points by REENCODER_STATS_CALL_*, and histogram buckets as described in `reencoder_stats_bucket_index()`.
+ */
+typedef struct {
+	uint64_t bytes_validated[REENCODER_STATS_NUM_ENCODINGS];
+	uint64_t bytes_converted[REENCODER_STATS_NUM_ENCODINGS][REENCODER_STATS_NUM_ENCODINGS];
+	uint64_t replacements_inserted[REENCODER_STATS_NUM_ENCODINGS];
+	uint64_t malformed_inputs[REENCODER_STATS_NUM_FAMILIES][REENCODER_STATS_NUM_OUTCOMES];
+	uint64_t buffer_grows;
+	uint64_t peak_buffer_bytes;
+	uint64_t tier_calls[REENCODER_STATS_NUM_TIERS];
+	uint64_t call_count[REENCODER_STATS_NUM_CALLS];
+	uint64_t call_latency_sum_ns[REENCODER_STATS_NUM_CALLS];
+	uint64_t call_input_bytes_sum[REENCODER_STATS_NUM_CALLS];
+	uint64_t call_latency_ns[REENCODER_STATS_NUM_CALLS][REENCODER_STATS_NUM_BUCKETS];
+	uint64_t call_input_bytes[REENCODER_STATS_NUM_CALLS][REENCODER_STATS_NUM_BUCKETS];
+} ReencoderStats;
+
+/**
+ * @brief Counters of a single thread, linked into a list of every thread that ever counted anything.
+ *
+ * Contains the counters themselves (stats), the reset generation they were counted in (generation), whether its thread has exited (is_free),
+ * and the block of the next thread (next).
+ * Only the owning thread writes to its block, so counting needs neither locks nor atomic read-modify-writes.
+ * Blocks are never freed. When a thread exits its block is marked free, keeping the counts in it, and the next thread to start counting claims it and adds to them.
+ * The counts of threads that have exited still show up in `reencoder_stats_get()`, and there are never more blocks than threads that counted at the same time.
+ */
+typedef struct _ReencoderStatsBlock {
+	ReencoderStats stats;
+	volatile long generation;
+	volatile long is_free;
+	struct _ReencoderStatsBlock* next;
+} _ReencoderStatsBlock;
+
+/**
+ * @brief Sums the counters of every thread.
+ *
+ * Counters only exist if the library was compiled with REENCODER_ENABLE_STATS defined. Otherwise every call to the library compiles without them,
+ * and this only zeroes stats.
+ * Counts of threads that are still running may be a few updates behind, counts of threads that have exited are kept.
+ *
+ * @param[out] stats Pointer to where the counters will be stored.
+ *
+ * @return 1 if the library counts statistics, 0 if it was compiled without them.
+ */
+unsigned int reencoder_stats_get(ReencoderStats* stats);
+
+/**
+ * @brief Sets the counters of every thread back to zero.
+ *
+ * Nothing is written to the counters of other threads. Each thread notices the reset the next time it counts something, and starts over from zero.
+ * Until then, `reencoder_stats_get()` leaves its counts out.
+ *
+ * @return void
+ */
+void reencoder_stats_reset(void);
+
+/**
+ * @brief Returns the histogram bucket a value is counted in.
+ *
+ * Values below 2^REENCODER_STATS_SUB_BUCKET_BITS have a bucket each. Above that, every power of two is split into 2^REENCODER_STATS_SUB_BUCKET_BITS buckets of equal width.
+ *
+ * @param[in] value Value to be bucketed, a latency in nanoseconds or a size in bytes.
+ *
+ * @return Bucket index, less than REENCODER_STATS_NUM_BUCKETS.
+ */
+size_t reencoder_stats_bucket_index(uint64_t value);
+
+/**
+ * @brief Returns the smallest value counted in a histogram bucket.
+ *
+ * @param[in] bucket Bucket index, less than REENCODER_STATS_NUM_BUCKETS.
+ *
+ * @return Smallest value of the bucket. The largest is one less than that of the next bucket (or UINT64_MAX for the last one).
+ */
+uint64_t reencoder_stats_bucket_lower_bound(size_t bucket);
+
+/**
+ * @brief Estimates a percentile of a histogram.
+ *
+ * @param[in] histogram Array of REENCODER_STATS_NUM_BUCKETS bucket counts, such as call_latency_ns[REENCODER_STATS_CALL_CONVERT].
+ * @param[in] percentile Percentile to be estimated, from 0.0 to 100.0.
+ *
+ * @return Largest value of the bucket the percentile falls in, so the estimate is never below the real value. 0 if the histogram is empty.
+ */
+uint64_t reencoder_stats_percentile(const uint64_t* histogram, double percentile);
+
+/**
+ * @brief Writes counters to a file, for scraping or logging.
+ *
+ * REENCODER_STATS_DUMP_TEXT writes the Prometheus text exposition format, with histograms as cumulative buckets. REENCODER_STATS_DUMP_JSON writes a single JSON object.
+ * Either way, only non-empty histogram buckets are written.
+ *
+ * @param[in] stats Pointer to counters filled in by `reencoder_stats_get()`.
+ * @param[in] fp_write File pointer to write to.
+ * @param[in] format REENCODER_STATS_DUMP_TEXT or REENCODER_STATS_DUMP_JSON.
+ *
+ * @return 1 if everything was written, 0 if an argument was invalid or writing failed.
+ */
+unsigned int reencoder_stats_dump(const ReencoderStats* stats, FILE* fp_write, unsigned int format);
+
+/**
+ * @brief Returns the counters of the calling thread, claiming the block of an exited thread or creating a new one on first use.
+ *
+ * @return Pointer to the counters of the calling thread.
+ * @retval NULL If memory allocation fails, in which case nothing is counted.
+ */
+ReencoderStats* _reencoder_stats_local(void);
+
+/**
+ * @brief Adds to a counter of the calling thread.
+ *
+ * @param[in] counter Pointer to a counter returned through `_reencoder_stats_local()`.
+ * @param[in] amount Amount to be added.
+ *
+ * @return void
+ */
+void _reencoder_stats_add(uint64_t* counter, uint64_t amount);
+
+/**
+ * @brief Counts a malformed input by its outcome. Well-formed and repaired outcomes are ignored.
+ *
+ * @param[in] outcome Outcome of the input, REENCODER_UTF*_ERR_*.
+ *
+ * @return void
+ */
+void _reencoder_stats_count_outcome(unsigned int outcome);
+
+/**
+ * @brief Records the new size of a buffer that was just reallocated.
+ *
+ * @param[in] buffer_bytes Size of the buffer in bytes after reallocation.
+ *
+ * @return void
+ */
+void _reencoder_stats_count_grow(size_t buffer_bytes);
+
+/**
+ * @brief Counts the blocks in the list of every thread's counters, whether they are in use or free.
+ *
+ * @return Number of blocks, 0 if the library was compiled without statistics.
+ */
+size_t _reencoder_stats_num_blocks(void);
+
+/**
+ * @brief Marks the start of a call to a public entry point on the calling thread.
+ *
+ * Calls nest, only the outermost one is timed.
+ *
+ * @return void
+ */
+void _reencoder_stats_call_begin(void);
+
+/**
+ * @brief Records the input size of the outermost call in progress, unless it already has one.
+ *
+ * Called by whichever entry point first knows the input size, so a conversion is recorded with the size of its input and not of the output it parses afterwards.
+ *
+ * @param[in] input_bytes Size of the input in bytes.
+ *
+ * @return void
+ */
+void _reencoder_stats_call_input(size_t input_bytes);
+
+/**
+ * @brief Marks the end of a call started with `_reencoder_stats_call_begin()`, recording it if it was the outermost one.
+ *
+ * @param[in] call Entry point that was called, REENCODER_STATS_CALL_*.
+ *
+ * @return void
+ */
+void _reencoder_stats_call_end(unsigned int call);
+
+// Hooks used throughout the library. Without REENCODER_ENABLE_STATS they expand to nothing, and their arguments are never evaluated.
+#if defined(REENCODER_ENABLE_STATS)
+#define _REENCODER_STATS_ADD(field, amount) \
+	do { \
+		ReencoderStats* _stats_local = _reencoder_stats_local(); \
+		if (_stats_local != NULL) { \
+			_reencoder_stats_add(&_stats_local->field, (uint64_t)(amount)); \
+		} \
+	} while (0)
+#define _REENCODER_STATS_OUTCOME(outcome) _reencoder_stats_count_outcome(outcome)
+#define _REENCODER_STATS_VALIDATED(encoding, bytes, outcome) \
+	do { \
+		_REENCODER_STATS_ADD(bytes_validated[(encoding)], (bytes)); \
+		_reencoder_stats_count_outcome(outcome); \
+	} while (0)
+#define _REENCODER_STATS_GROW(buffer_bytes) _reencoder_stats_count_grow(buffer_bytes)
+#define _REENCODER_STATS_CALL_BEGIN() _reencoder_stats_call_begin()
+#define _REENCODER_STATS_CALL_INPUT(input_bytes) _reencoder_stats_call_input(input_bytes)
+#define _REENCODER_STATS_CALL_END(call) _reencoder_stats_call_end(call)
+#else
+#define _REENCODER_STATS_ADD(field, amount) ((void)0)
+#define _REENCODER_STATS_OUTCOME(outcome) ((void)0)
+#define _REENCODER_STATS_VALIDATED(encoding, bytes, outcome) ((void)0)
+#define _REENCODER_STATS_GROW(buffer_bytes) ((void)0)
+#define _REENCODER_STATS_CALL_BEGIN() ((void)0)
+#define _REENCODER_STATS_CALL_INPUT(input_bytes) ((void)0)
+#define _REENCODER_STATS_CALL_END(call) ((void)0)
+#endif
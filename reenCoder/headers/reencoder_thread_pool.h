@@ -0,0 +1,128 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#define _REENCODER_THREAD_POOL_MAX_WORKERS 256
+
+#if defined(_WIN32)
+typedef CRITICAL_SECTION _ReencoderMutex;
+typedef CONDITION_VARIABLE _ReencoderCondition;
+typedef HANDLE _ReencoderThread;
+#else
+typedef pthread_mutex_t _ReencoderMutex;
+typedef pthread_cond_t _ReencoderCondition;
+typedef pthread_t _ReencoderThread;
+#endif
+
+/**
+ * @brief Function run once for every task handed to `_reencoder_thread_pool_run()`.
+ *
+ * @param[in] job Job shared by every task of the run.
+ * @param[in] worker_index Index of the worker running the task, from 0 to num_workers - 1.
+ * @param[in] task_index Index of the task, from 0 to num_tasks - 1.
+ */
+typedef void (*_ReencoderTaskFunction)(void* job, size_t worker_index, size_t task_index);
+
+/**
+ * @brief Double-ended queue of task indices owned by a single worker.
+ *
+ * Holds the tasks in [top, bottom). The owning worker takes tasks from the bottom, idle workers steal from the top,
+ * so the owner and a thief only ever contend on the last task left in the deque.
+ */
+typedef struct {
+	_ReencoderMutex lock;
+	size_t top;
+	size_t bottom;
+} _ReencoderTaskDeque;
+
+struct ReencoderThreadPool;
+
+/**
+ * @brief State of a single worker of a `ReencoderThreadPool`.
+ *
+ * Contains the worker's thread (unused for worker 0, which is the calling thread), the pool it belongs to, its index, its task deque,
+ * and a scratch buffer with its size that tasks may use for per-worker output. The scratch buffer only ever grows and is kept across runs.
+ */
+typedef struct {
+	_ReencoderThread thread;
+	struct ReencoderThreadPool* pool;
+	size_t worker_index;
+	_ReencoderTaskDeque deque;
+	void* scratch;
+	size_t scratch_size;
+} _ReencoderWorker;
+
+/**
+ * @brief Fixed set of worker threads that split a run of tasks between them using work-stealing deques.
+ *
+ * Contains the workers (workers) and their number (num_workers), the lock and condition variables used to hand out runs and wait for them,
+ * a counter incremented once per run (generation), the number of background workers still busy with the current run (workers_busy),
+ * whether the pool is being destroyed (is_shutting_down), and the task function and job of the current run.
+ * The thread calling `_reencoder_thread_pool_run()` acts as worker 0, so a pool of n workers starts n - 1 threads.
+ * A pool runs one batch at a time, use one pool per calling thread.
+ */
+typedef struct ReencoderThreadPool {
+	_ReencoderWorker* workers;
+	size_t num_workers;
+	_ReencoderMutex lock;
+	_ReencoderCondition work_ready;
+	_ReencoderCondition work_done;
+	unsigned long generation;
+	size_t workers_busy;
+	unsigned int is_shutting_down;
+	_ReencoderTaskFunction task_function;
+	void* job;
+} ReencoderThreadPool;
+
+/**
+ * @brief Creates a `ReencoderThreadPool` and starts its worker threads.
+ *
+ * If a worker thread cannot be started, the pool keeps the workers started so far.
+ * The returned `ReencoderThreadPool` must be freed using `reencoder_thread_pool_destroy()` once it is no longer needed.
+ *
+ * @param[in] num_workers Number of workers, including the calling thread. 0 uses one worker per online processor. Capped at _REENCODER_THREAD_POOL_MAX_WORKERS.
+ *
+ * @return Pointer to a `ReencoderThreadPool`.
+ * @retval NULL If memory allocation fails.
+ */
+ReencoderThreadPool* reencoder_thread_pool_create(size_t num_workers);
+
+/**
+ * @brief Stops the worker threads of a `ReencoderThreadPool` and frees it.
+ *
+ * @param[in] pool Address of the pointer to the `ReencoderThreadPool` to be freed.
+ *
+ * @return void
+ */
+void reencoder_thread_pool_destroy(ReencoderThreadPool** pool);
+
+/**
+ * @brief Runs num_tasks tasks across every worker of a pool and returns once all of them have completed.
+ *
+ * Tasks are first split into one contiguous range per worker. A worker that runs out of tasks steals single tasks from the other workers,
+ * so uneven tasks do not leave workers idle. The calling thread takes part as worker 0.
+ *
+ * @param[in] pool Pointer to the `ReencoderThreadPool` to run on.
+ * @param[in] num_tasks Number of tasks.
+ * @param[in] task_function Function called once per task.
+ * @param[in] job Job passed to every call of task_function.
+ *
+ * @return void
+ */
+void _reencoder_thread_pool_run(ReencoderThreadPool* pool, size_t num_tasks, _ReencoderTaskFunction task_function, void* job);
+
+/**
+ * @brief Returns the number of online processors.
+ *
+ * @return Number of online processors.
+ * @retval 1 If the number cannot be determined.
+ */
+size_t _reencoder_thread_pool_num_processors(void);
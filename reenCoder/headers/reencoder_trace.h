@@ -0,0 +1,28 @@
+#pragma once
+
+// Optional USDT (SystemTap/DTrace-compatible) probes, enabled by defining REENCODER_ENABLE_USDT on platforms that ship sys/sdt.h (systemtap-sdt-dev).
+// Each probe compiles to a single nop plus a note in the binary's .note.stapsdt section, so nothing runs until a tracer attaches to it.
+// Arguments are values the function already holds, so evaluating them costs nothing extra either.
+//
+// Probes of provider "reencoder", with their arguments:
+//   parse_entry(encoding, input)                           parse_return(encoding, num_bytes, outcome)
+//   convert_entry(source_encoding, target_encoding, input) convert_return(source_encoding, target_encoding, num_bytes, outcome)
+//   repair_entry(encoding, num_bytes, outcome)             repair_return(encoding, num_bytes, repair_outcome)
+//   write_entry(encoding, num_bytes, write_bom)            write_return(encoding, bytes_written)
+// Encodings are `enum ReencoderEncodeType` values, outcomes are REENCODER_UTF*_* (0 if no struct was returned),
+// num_bytes counts the string in the struct (input and output of a repair, output of the rest), and input is the source buffer pointer.
+// Probes fire on every entry point reached. A conversion builds its output struct directly, so it fires no parse probes between convert_entry and convert_return.
+//
+// Example, latency of conversions per source and target encoding:
+//   bpftrace -e 'usdt:./app:reencoder:convert_entry { @start[tid] = nsecs; }
+//     usdt:./app:reencoder:convert_return /@start[tid]/ { @ns[arg0, arg1] = hist(nsecs - @start[tid]); delete(@start[tid]); }'
+#if defined(REENCODER_ENABLE_USDT) && !defined(_WIN32)
+#include <sys/sdt.h>
+#define _REENCODER_TRACE2(probe, a, b) DTRACE_PROBE2(reencoder, probe, a, b)
+#define _REENCODER_TRACE3(probe, a, b, c) DTRACE_PROBE3(reencoder, probe, a, b, c)
+#define _REENCODER_TRACE4(probe, a, b, c, d) DTRACE_PROBE4(reencoder, probe, a, b, c, d)
+#else
+#define _REENCODER_TRACE2(probe, a, b) ((void)0)
+#define _REENCODER_TRACE3(probe, a, b, c) ((void)0)
+#define _REENCODER_TRACE4(probe, a, b, c, d) ((void)0)
+#endif
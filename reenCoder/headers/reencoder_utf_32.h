@@ -24,10 +24,25 @@
  */
 ReencoderUnicodeStruct* reencoder_utf32_parse_uint32(const uint32_t* string, enum ReencoderEncodeType target_endian);
 
+/**
+ * @brief Same as `reencoder_utf32_parse_uint32()`, but places the returned `ReencoderUnicodeStruct` and its string buffer in a `ReencoderArena`.
+ *
+ * @param[in] arena Arena to allocate from. NULL allocates from the heap, same as `reencoder_utf32_parse_uint32()`.
+ * @param[in] string Input UTF-32 string. Must be null-terminated.
+ * @param[in] target_endian Specifies target UTF-32 endianness (UTF_32BE or UTF_32LE).
+ *
+ * @return Pointer to a `ReencoderUnicodeStruct` living in arena.
+ * @retval NULL If memory allocation fails or an invalid `target_endian` is provided.
+ *
+ * @note The returned `ReencoderUnicodeStruct` is reclaimed by `reencoder_arena_reset()` or `reencoder_arena_destroy()`.
+ */
+ReencoderUnicodeStruct* reencoder_utf32_parse_uint32_arena(ReencoderArena* arena, const uint32_t* string, enum ReencoderEncodeType target_endian);
+
 /**
  * @brief Parses a given UTF-32 uint8_t* sequence and loads it into a `ReencoderUnicodeStruct`.
  *
  * Input string must be represented as uint8_t* and match provided endianness.
+ * Input with a length divisible by 4 is read directly in source_endian (no alignment needed) and written to the struct in one pass.
  * The returned `ReencoderUnicodeStruct` will be fully initialised if the string is valid.
  * ReencoderUnicodeStruct->num_chars will be 0 if the string is invalid.
  *
@@ -43,6 +58,38 @@ ReencoderUnicodeStruct* reencoder_utf32_parse_uint32(const uint32_t* string, enu
  */
 ReencoderUnicodeStruct* reencoder_utf32_parse_uint8(const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian);
 
+/**
+ * @brief Same as `reencoder_utf32_parse_uint8()`, but places the returned `ReencoderUnicodeStruct` and its string buffer in a `ReencoderArena`.
+ *
+ * @param[in] arena Arena to allocate from. NULL allocates from the heap, same as `reencoder_utf32_parse_uint8()`.
+ * @param[in] string Input UTF-32 string.
+ * @param[in] bytes Number of bytes in the input string.
+ * @param[in] source_endian Specifies source UTF-32 endianness (UTF_32BE or UTF_32LE).
+ * @param[in] target_endian Specifies target UTF-32 endianness (UTF_32BE or UTF_32LE).
+ *
+ * @return Pointer to a `ReencoderUnicodeStruct` living in arena.
+ * @retval NULL If memory allocation fails or an invalid `target_endian` is provided.
+ *
+ * @note The returned `ReencoderUnicodeStruct` is reclaimed by `reencoder_arena_reset()` or `reencoder_arena_destroy()`.
+ */
+ReencoderUnicodeStruct* reencoder_utf32_parse_uint8_arena(ReencoderArena* arena, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian);
+
+/**
+ * @brief Same as `reencoder_utf32_parse_uint8()`, but builds the padded native uint32_t copy of input with a length not divisible by 4 in the scratch buffer of a `ReencoderContext`.
+ *
+ * The returned `ReencoderUnicodeStruct` is placed in the context's arena if it has one, otherwise it is allocated from the heap.
+ *
+ * @param[in] ctx Context providing scratch buffers. NULL behaves the same as `reencoder_utf32_parse_uint8()`.
+ * @param[in] string Input UTF-32 string.
+ * @param[in] bytes Number of bytes in the input string.
+ * @param[in] source_endian Specifies source UTF-32 endianness (UTF_32BE or UTF_32LE).
+ * @param[in] target_endian Specifies target UTF-32 endianness (UTF_32BE or UTF_32LE).
+ *
+ * @return Pointer to a `ReencoderUnicodeStruct` containing parsed string data.
+ * @retval NULL If memory allocation fails or an invalid `target_endian` is provided.
+ */
+ReencoderUnicodeStruct* reencoder_utf32_parse_uint8_ctx(ReencoderContext* ctx, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian);
+
 /**
  * @brief Returns the length of a UTF-32 string.
  *
@@ -73,10 +120,11 @@ unsigned int _reencoder_utf32_buffer_idx0_is_valid(const uint32_t* ptr);
  *
  * @param[in] string UTF-32 string to be checked. Should be represented as an array of uint32_t.
  * @param[in] length Length of the provided string. Length is not number of bytes, but number of uint32_t elements.
+ * @param[out] char_flags Pointer to where the REENCODER_CHARS_* flags of the string will be stored if it is valid, tracked in the same pass. Can be NULL if not needed.
  *
  * @return Unsigned integer representing the outcome of the check. Corresponds to index in `REENCODER_UTF32_OUTCOME_ARR` after offsets.
  */
-unsigned int _reencoder_utf32_seq_is_valid(const uint32_t* string, size_t length);
+unsigned int _reencoder_utf32_seq_is_valid(const uint32_t* string, size_t length, unsigned int* char_flags);
 
 /**
  * @brief Converts a UTF-32 string represented in uint8_t to standardised uint32_t.
@@ -129,3 +177,19 @@ unsigned int _reencoder_utf32_encode_from_code_point(uint32_t* buffer, size_t in
  * @return void
  */
 void _reencoder_utf32_write_buffer_swap_endian(uint8_t* dest, const uint32_t* src, size_t length);
+
+/**
+ * @brief Repairs a UTF-32 buffer in place, replacing every invalid code unit with the replacement character (U+FFFD).
+ *
+ * Officially declared in reencoder_utf_32.c.
+ * Code units are read and written in the byte order given by endian, so the buffer does not need to be in system endianness.
+ * Replacing a unit never changes the length of the string, so no memory is allocated.
+ *
+ * @param[in,out] buffer UTF-32 byte buffer to be repaired. Must hold length + 1 code units, the last of which is set to the null-terminator.
+ * @param[in] length Number of uint32_t code units in the buffer.
+ * @param[in] endian Byte order of the buffer (UTF_32BE or UTF_32LE).
+ * @param[out] char_flags REENCODER_CHARS_* flags of the repaired buffer, replacement characters included.
+ *
+ * @return Number of characters in the repaired buffer before the first null character.
+ */
+size_t _reencoder_utf32_repair_in_place(uint8_t* buffer, size_t length, enum ReencoderEncodeType endian, unsigned int* char_flags);
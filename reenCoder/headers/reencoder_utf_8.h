@@ -22,6 +22,19 @@
  */
 ReencoderUnicodeStruct* reencoder_utf8_parse(const uint8_t* string);
 
+/**
+ * @brief Same as `reencoder_utf8_parse()`, but places the returned `ReencoderUnicodeStruct` and its string buffer in a `ReencoderArena`.
+ *
+ * @param[in] arena Arena to allocate from. NULL allocates from the heap, same as `reencoder_utf8_parse()`.
+ * @param[in] string Input UTF-8 string. Must be null-terminated (0x00).
+ *
+ * @return Pointer to a `ReencoderUnicodeStruct` living in arena.
+ * @retval NULL If memory allocation fails.
+ *
+ * @note The returned `ReencoderUnicodeStruct` is reclaimed by `reencoder_arena_reset()` or `reencoder_arena_destroy()`.
+ */
+ReencoderUnicodeStruct* reencoder_utf8_parse_arena(ReencoderArena* arena, const uint8_t* string);
+
 /**
  * @brief Checks if a given UTF-8 string contains multibyte sequences.
  *
@@ -42,6 +55,8 @@ int reencoder_utf8_contains_multibyte(const uint8_t* string);
 /**
  * @brief Determines the number of UTF-8 characters, not bytes in a string.
  *
+ * The string must be well-formed, a truncated sequence before the null-terminator makes this read past it.
+ *
  * @param[in] string UTF-8 string to be checked. Should be represented as an array of uint8_t.
  *
  * @return Number of UTF-8 characters in the string.
@@ -63,16 +78,32 @@ size_t _reencoder_utf8_determine_num_chars(const uint8_t* string);
  */
 unsigned int _reencoder_utf8_buffer_idx0_is_valid(const uint8_t* ptr, size_t units_left, unsigned int* units_actual);
 
+/**
+ * @brief Measures the run of valid, non-null UTF-8 characters at the start of a buffer.
+ *
+ * Runs of ASCII are checked 8 bytes at a time, and only multi-byte characters go through `_reencoder_utf8_buffer_idx0_is_valid()`.
+ * Stops at the first malformed sequence, the first null byte, or after units_left bytes, whichever comes first.
+ *
+ * @param[in] string Pointer to the start of the UTF-8 buffer to be checked.
+ * @param[in] units_left Number of uint8_t units left in the buffer starting from string.
+ * @param[out] num_chars Pointer to where the number of characters in the run will be stored.
+ * @param[in,out] max_leading_byte Pointer to the largest leading byte seen so far, raised to the largest one in the run. Can be NULL.
+ *
+ * @return Number of bytes in the valid run.
+ */
+size_t _reencoder_utf8_valid_span(const uint8_t* string, size_t units_left, size_t* num_chars, uint8_t* max_leading_byte);
+
 /**
  * @brief Checks if a provided UTF-8 string is valid.
  *
  * Checks for surrogate presence, overlong encoding, invalid bytes, and premature string endings.
  *
  * @param[in] string UTF-16 string to be checked. Should be represented as an array of uint8_t.
+ * @param[out] char_flags Pointer to where the REENCODER_CHARS_* flags of the string will be stored if it is valid, tracked in the same pass. Can be NULL if not needed.
  *
  * @return Unsigned integer representing the outcome of the check. Corresponds to index in `REENCODER_UTF8_OUTCOME_ARR` after offsets.
  */
-unsigned int _reencoder_utf8_seq_is_valid(const uint8_t* string);
+unsigned int _reencoder_utf8_seq_is_valid(const uint8_t* string, unsigned int* char_flags);
 
 /**
  * @brief Given a single UTF-8 starting byte, determines how many bytes this character is.
@@ -107,3 +138,27 @@ uint32_t _reencoder_utf8_decode_to_code_point(const uint8_t* ptr, unsigned int*
  * @return Unsigned integer representing the unit count (no. of 1 byte units) written to the buffer.
  */
 unsigned int _reencoder_utf8_encode_from_code_point(uint8_t* buffer, size_t index, uint32_t code_point);
+
+/**
+ * @brief Repairs a UTF-8 uint8_t buffer into an output buffer in a single forward pass.
+ *
+ * Officially declared in reencoder_utf_8.c.
+ * Valid runs between errors are found using `_reencoder_utf8_valid_span()` and block-copied as-is.
+ * Only the malformed sequences themselves are replaced by the replacement character (U+FFFD).
+ * The output buffer is grown using `_reencoder_context_reserve()` and is always null-terminated.
+ * With a cap on the output size, the buffer is reserved once for the worst case the cap allows and never grown after.
+ *
+ * @param[in] string UTF-8 string to be repaired.
+ * @param[in] num_bytes Number of bytes in the provided string.
+ * @param[in,out] output_buffer Address of the output buffer pointer. Can point to NULL.
+ * @param[in,out] output_buffer_size Current size of the output buffer. Is updated if the buffer is grown.
+ * @param[out] output_buffer_index Number of bytes written to the output buffer, excluding the null-terminator.
+ * @param[out] num_chars Number of characters written before the first null character.
+ * @param[out] char_flags REENCODER_CHARS_* flags of the repaired string, replacement characters included.
+ * @param[in] max_output_bytes Largest output allowed in bytes, excluding the null-terminator. SIZE_MAX if unlimited.
+ *
+ * @return REENCODER_REPAIR_SUCCESS if the string was repaired.
+ * @retval REENCODER_REPAIR_FAILURE_OOM if the output buffer could not be grown.
+ * @retval REENCODER_REPAIR_FAILURE_TOO_LARGE if the output grew past max_output_bytes. Repair stops as soon as this is detected.
+ */
+unsigned int _reencoder_utf8_repair_to_buffer(const uint8_t* string, size_t num_bytes, void** output_buffer, size_t* output_buffer_size, size_t* output_buffer_index, size_t* num_chars, unsigned int* char_flags, size_t max_output_bytes);
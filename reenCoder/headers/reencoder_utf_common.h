@@ -5,9 +5,29 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include "reencoder_arena.h"
+#include "reencoder_context.h"
+#include "reencoder_shared.h"
 
 #define _REENCODER_BASE_STRING_BYTE_SIZE 256
 #define _REENCODER_BASE_STRING_GROW_RATE 4
+#define _REENCODER_WRITE_SWAP_CHUNK_SIZE 1024 // stack chunk used to byte-swap host-order buffers while writing to a file, multiple of every code unit size
+
+// system endianness resolved at compile time where the compiler reports it: 1 (little-endian) or 0 (big-endian)
+// left undefined on unknown platforms, in which case _REENCODER_IS_SYSTEM_LITTLE_ENDIAN() falls back to a runtime check
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define _REENCODER_SYSTEM_LITTLE_ENDIAN 1
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define _REENCODER_SYSTEM_LITTLE_ENDIAN 0
+#elif defined(_WIN32)
+#define _REENCODER_SYSTEM_LITTLE_ENDIAN 1 // every architecture targeted by Windows is little-endian
+#endif
+
+#if defined(_REENCODER_SYSTEM_LITTLE_ENDIAN)
+#define _REENCODER_IS_SYSTEM_LITTLE_ENDIAN() _REENCODER_SYSTEM_LITTLE_ENDIAN
+#else
+#define _REENCODER_IS_SYSTEM_LITTLE_ENDIAN() reencoder_is_system_little_endian()
+#endif
 
 /**
  * @brief Enum containing supported Unicode string types.
@@ -34,6 +54,13 @@ static const char* _REENCODER_ENCODE_TYPE_ARR[] = {
  *
  * Contains the string type (string_type), the string in a 1 byte buffer (string_buffer),
  * validity of the string (string_validity), number of characters (num_chars), and number of bytes (num_bytes).
+ * The number of bytes actually allocated for string_buffer, including the null-terminator and any slack left over from growth, is recorded (capacity).
+ * If the struct and its buffer were placed in a `ReencoderArena`, the owning arena is recorded (arena), otherwise it is NULL.
+ * If string_buffer is shared with duplicates of the struct, its control block is recorded (shared), otherwise it is NULL.
+ * Shared buffers are copy-on-write: library functions that modify a string give the struct its own copy first.
+ * If a UTF-16/UTF-32 string_buffer holds its code units in system byte order rather than the byte order of string_type, this is recorded (is_host_order).
+ * Such buffers are only brought into the byte order of string_type when written out, or by `reencoder_unicode_struct_materialize()`.
+ * Character ranges found while validating or repairing the string are recorded as REENCODER_CHARS_* flags (char_flags). They are 0 for invalid strings.
  */
 typedef struct {
 	enum ReencoderEncodeType string_type;
@@ -41,8 +68,18 @@ typedef struct {
 	unsigned int string_validity;
 	size_t num_chars;
 	size_t num_bytes;
+	size_t capacity;
+	ReencoderArena* arena;
+	_ReencoderSharedBuffer* shared;
+	unsigned int is_host_order;
+	unsigned int char_flags;
 } ReencoderUnicodeStruct;
 
+// ReencoderUnicodeStruct->char_flags, each one implies the ones after it
+#define REENCODER_CHARS_ASCII 0x1 // every character is below U+0080, so UTF-8 is one byte per character
+#define REENCODER_CHARS_LATIN1 0x2 // every character is below U+0100, so UTF-16/32 units can be narrowed to single bytes as-is
+#define REENCODER_CHARS_BMP 0x4 // every character is below U+10000, so UTF-16 has no surrogate pairs and is one unit per character
+
 #define _REENCODER_UTF8_PARSE_OFFSET 800
 #define REENCODER_UTF8_VALID 800
 #define REENCODER_UTF8_VALID_REPAIRED 801
@@ -99,10 +136,25 @@ static const char* _REENCODER_UTF32_OUTCOME_ARR[] = {
 #define REENCODER_REPAIR_FAILURE_NO_STRUCT 101
 #define REENCODER_REPAIR_FAILURE_NO_OP 102
 #define REENCODER_REPAIR_FAILURE_OOM 103
+#define REENCODER_REPAIR_FAILURE_TOO_LARGE 104
 
 #define REENCODER_CONVERT_SUCCESS 200
 #define REENCODER_CONVERT_FAILURE_NULL_ARGS 201
 #define REENCODER_CONVERT_FAILURE_OOM 202
+#define REENCODER_CONVERT_FAILURE_TOO_LARGE 203
+
+#define REENCODER_SHRINK_SUCCESS 300
+#define REENCODER_SHRINK_FAILURE_NO_STRUCT 301
+#define REENCODER_SHRINK_FAILURE_NO_OP 302
+#define REENCODER_SHRINK_FAILURE_OOM 303
+
+#define REENCODER_MATERIALIZE_SUCCESS 400
+#define REENCODER_MATERIALIZE_FAILURE_NO_STRUCT 401
+#define REENCODER_MATERIALIZE_FAILURE_NO_OP 402
+#define REENCODER_MATERIALIZE_FAILURE_OOM 403
+
+#define REENCODER_VALIDATE_FAILURE_NULL_ARGS 500
+#define REENCODER_VALIDATE_FAILURE_INVALID_TYPE 501
 
 #define _REENCODER_UTF8_VALIDATION_HAS_VALID_LENGTH 0
 #define _REENCODER_UTF8_VALIDATION_HAS_VALID_CONTINUATION_BYTES 0
@@ -123,6 +175,9 @@ static const uint8_t _REENCODER_UTF32LE_BOM[] = { 0xFF, 0xFE, 0x00, 0x00 };
 /**
  * @brief Frees a `ReencoderUnicodeStruct` and its string buffer.
  *
+ * If the struct lives in a `ReencoderArena`, no memory is released (the arena reclaims it on reset or destroy), but the pointer is still set to NULL.
+ * If the string buffer is shared with duplicates, it is only freed together with the last struct referencing it.
+ *
  * @param[in] unicode_struct Address of the pointer to the `ReencoderUnicodeStruct` to be freed.
  *
  * @return void
@@ -133,6 +188,9 @@ void reencoder_unicode_struct_free(ReencoderUnicodeStruct** unicode_struct);
  * @brief Creates a copy of an existing `ReencoderUnicodeStruct`.
  *
  * The returned `ReencoderUnicodeStruct` must be freed using `reencoder_unicode_struct_free()` once it is no longer needed.
+ * The duplicate is always allocated from the heap, even if unicode_struct lives in a `ReencoderArena`.
+ * For heap structs, the duplicate shares the original's string buffer (reference-counted, copy-on-write), so no string data is copied.
+ * Structs sharing a buffer may be freed from different threads. Arena structs are still copied, since a reset would invalidate a shared buffer.
  *
  * @param[in] unicode_struct Pointer to the `ReencoderUnicodeStruct` to be duplicated.
  *
@@ -143,6 +201,53 @@ void reencoder_unicode_struct_free(ReencoderUnicodeStruct** unicode_struct);
  */
 ReencoderUnicodeStruct* reencoder_unicode_struct_duplicate(ReencoderUnicodeStruct* unicode_struct);
 
+/**
+ * @brief Trims the string buffer of a `ReencoderUnicodeStruct` to exactly num_bytes plus the null-terminator.
+ *
+ * Buffers handed over from growth (e.g. by `reencoder_repair_struct()`) can be larger than needed, see `ReencoderUnicodeStruct->capacity`.
+ * Structs living in a `ReencoderArena` are left untouched, since arena memory cannot be returned individually.
+ * Structs sharing their buffer with duplicates are also left untouched, since trimming would require a full copy.
+ *
+ * @param[in] unicode_struct Pointer to the `ReencoderUnicodeStruct` to be trimmed.
+ *
+ * @return REENCODER_SHRINK_SUCCESS if the buffer was trimmed.
+ * @retval REENCODER_SHRINK_FAILURE_NO_STRUCT if the provided unicode_struct is NULL or has no string buffer.
+ * @retval REENCODER_SHRINK_FAILURE_NO_OP if the buffer is already exactly sized, shared, or lives in a `ReencoderArena`.
+ * @retval REENCODER_SHRINK_FAILURE_OOM if the buffer could not be reallocated, in which case the struct is left untouched.
+ */
+unsigned int reencoder_unicode_struct_shrink(ReencoderUnicodeStruct* unicode_struct);
+
+/**
+ * @brief Brings the string buffer of a host-order `ReencoderUnicodeStruct` into the byte order of its string_type.
+ *
+ * Structs are only stored in host order when created through a `ReencoderContext` with host-order storage enabled (see `reencoder_context_set_host_order_storage()`).
+ * Writing out a host-order struct does not require this call, `reencoder_write_to_buffer()` and `reencoder_write_to_file()` swap while writing.
+ * A buffer shared with duplicates is copied first, so the duplicates are left untouched.
+ *
+ * @param[in] unicode_struct Pointer to the `ReencoderUnicodeStruct` to be materialized.
+ *
+ * @return REENCODER_MATERIALIZE_SUCCESS if the buffer is now in the byte order of string_type.
+ * @retval REENCODER_MATERIALIZE_FAILURE_NO_STRUCT if the provided unicode_struct is NULL or has no string buffer.
+ * @retval REENCODER_MATERIALIZE_FAILURE_NO_OP if the buffer is not stored in host order.
+ * @retval REENCODER_MATERIALIZE_FAILURE_OOM if a shared buffer could not be copied, in which case the struct is left untouched.
+ */
+unsigned int reencoder_unicode_struct_materialize(ReencoderUnicodeStruct* unicode_struct);
+
+/**
+ * @brief Finds where a character starts in the string buffer of a `ReencoderUnicodeStruct`.
+ *
+ * UTF-32 strings, UTF-16 strings flagged REENCODER_CHARS_BMP and UTF-8 strings flagged REENCODER_CHARS_ASCII have one code unit per character,
+ * so the offset is computed directly. Other strings are walked from the start, counting the first code unit of each character.
+ * Host-order and shared buffers are read as they are stored.
+ *
+ * @param[in] unicode_struct Pointer to a `ReencoderUnicodeStruct` containing a valid (or repaired) string.
+ * @param[in] char_index Index of the character. num_chars gives the offset of the null-terminator.
+ *
+ * @return Offset in bytes of the character from the start of string_buffer.
+ * @retval SIZE_MAX If unicode_struct is NULL or invalid, or char_index is past num_chars.
+ */
+size_t reencoder_unicode_struct_char_offset(const ReencoderUnicodeStruct* unicode_struct, size_t char_index);
+
 /**
  * @brief Returns a human-readable string for a given ReencoderEncodeType.
  *
@@ -170,6 +275,7 @@ const char* reencoder_outcome_as_str(unsigned int outcome);
  * The returned `ReencoderUnicodeStruct` will be fully initialised if the string is valid.
  * If the provided UTF string is invalid, a ReencoderUnicodeStruct handling that string directly will be returned.
  * ReencoderUnicodeStruct->num_chars will be 0 if any string is invalid (both provided and converted strings).
+ * Conversions between encodings of the same code unit width (e.g. UTF_16BE to UTF_16LE, or UTF_8 to UTF_8) skip decoding and only copy or byte-swap the validated string.
  *
  * @param[in] source_encoding Specifies source encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE). Source endian should follow system endianness, obtainable using `_reencoder_is_system_little_endian()`.
  * @param[in] target_encoding Specifies target encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE).
@@ -183,10 +289,43 @@ const char* reencoder_outcome_as_str(unsigned int outcome);
  */
 ReencoderUnicodeStruct* reencoder_convert(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* source_uint_buffer);
 
+/**
+ * @brief Same as `reencoder_convert()`, but places the returned `ReencoderUnicodeStruct` and its string buffer in a `ReencoderArena`.
+ *
+ * @param[in] arena Arena to allocate the returned `ReencoderUnicodeStruct` from. NULL allocates from the heap, same as `reencoder_convert()`.
+ * @param[in] source_encoding Specifies source encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE).
+ * @param[in] target_encoding Specifies target encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE).
+ * @param[in] source_uint_buffer Input UTF string. See `reencoder_convert()`.
+ *
+ * @return Pointer to a `ReencoderUnicodeStruct` living in arena.
+ * @retval NULL If memory allocation fails or an invalid `source_encoding` or `target_encoding` is provided.
+ *
+ * @note The returned `ReencoderUnicodeStruct` is reclaimed by `reencoder_arena_reset()` or `reencoder_arena_destroy()`.
+ */
+ReencoderUnicodeStruct* reencoder_convert_arena(ReencoderArena* arena, enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* source_uint_buffer);
+
+/**
+ * @brief Same as `reencoder_convert()`, but re-encodes through the scratch buffers of a `ReencoderContext` instead of allocating temporary buffers.
+ *
+ * The returned `ReencoderUnicodeStruct` is placed in the context's arena if it has one, otherwise it is allocated from the heap.
+ * The result is subject to the context's expansion cap, see `reencoder_context_set_max_expansion()`.
+ *
+ * @param[in] ctx Context providing scratch buffers. NULL behaves the same as `reencoder_convert()`.
+ * @param[in] source_encoding Specifies source encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE).
+ * @param[in] target_encoding Specifies target encoding type (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE).
+ * @param[in] source_uint_buffer Input UTF string. See `reencoder_convert()`.
+ *
+ * @return Pointer to a `ReencoderUnicodeStruct` containing data for a string encoded in provided target encoding type.
+ * @retval Pointer to a `ReencoderUnicodeStruct` containing data for a string encoded in provided source encoding type if the provided string is invalid.
+ * @retval NULL If memory allocation fails, the result would exceed the context's expansion cap, or an invalid `source_encoding` or `target_encoding` is provided.
+ */
+ReencoderUnicodeStruct* reencoder_convert_ctx(ReencoderContext* ctx, enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* source_uint_buffer);
+
 /**
  * @brief Parses a given ReencoderUnicodeStruct containing an invalid UTF sequence and repairs it, updating the provided struct with the repaired string and it's new metadata.
  *
  * Any invalid UTF sequence will be replaced with the Unicode replacement character (U+FFFD).
+ * If the struct lives in a `ReencoderArena`, the repaired string buffer is allocated from the same arena.
  *
  * @param[in] unicode_struct Pointer to a `ReencoderUnicodeStruct` containing an invalid UTF sequence.
  *
@@ -197,6 +336,23 @@ ReencoderUnicodeStruct* reencoder_convert(enum ReencoderEncodeType source_encodi
  */
 unsigned int reencoder_repair_struct(ReencoderUnicodeStruct* unicode_struct);
 
+/**
+ * @brief Same as `reencoder_repair_struct()`, but works in the scratch buffers of a `ReencoderContext` instead of allocating temporary buffers.
+ *
+ * The repaired string buffer is still allocated from the struct's own arena, or from the heap if it has none.
+ * The repaired string is subject to the context's expansion cap, see `reencoder_context_set_max_expansion()`. The struct is left untouched if the cap is hit.
+ *
+ * @param[in] ctx Context providing scratch buffers. NULL behaves the same as `reencoder_repair_struct()`.
+ * @param[in] unicode_struct Pointer to a `ReencoderUnicodeStruct` containing an invalid UTF sequence.
+ *
+ * @return REENCODER_REPAIR_SUCCESS if the string was successfully repaired.
+ * @retval REENCODER_REPAIR_FAILURE_NO_STRUCT if the provided unicode_struct is NULL.
+ * @retval REENCODER_REPAIR_FAILURE_NO_OP if the string is already valid.
+ * @retval REENCODER_REPAIR_FAILURE_OOM if memory allocation fails during the repair process.
+ * @retval REENCODER_REPAIR_FAILURE_TOO_LARGE if the repaired string would exceed the context's expansion cap.
+ */
+unsigned int reencoder_repair_struct_ctx(ReencoderContext* ctx, ReencoderUnicodeStruct* unicode_struct);
+
 /**
  * @brief Writes the string contents stored in a `ReencoderUnicodeStruct` to a buffer.
  *
@@ -231,7 +387,7 @@ size_t reencoder_write_to_file(ReencoderUnicodeStruct* unicode_struct, FILE* fil
  *
  * Can be used to determine the endianness of the system when dealing with UTF-16 and UTF-32 conversions.
  * Example: reencoder_convert(reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE, UTF_8, uint16_input);
- * Also for internal use by reencoder_utf_* functions.
+ * Internally, reencoder_utf_* functions use `_REENCODER_IS_SYSTEM_LITTLE_ENDIAN()` instead, which is a compile-time constant on known platforms.
  *
  * @return 1 if the system is little-endian, 0 if the system is big-endian.
  */
@@ -244,12 +400,13 @@ uint8_t reencoder_is_system_little_endian(void);
  * string_buffer is set to NULL, string_validity to 0, num_chars to 0, and num_bytes to 0.
  *
  * @param[in] string_type The type of the string to be parsed. Must be one of the `ReencoderEncodeType` enum values.
+ * @param[in] arena Arena to allocate the struct from. NULL allocates from the heap.
  *
  * @return Pointer to a default `ReencoderUnicodeStruct`.
  *
  * @note The returned `ReencoderUnicodeStruct` must be freed using `reencoder_unicode_struct_free()`.
  */
-ReencoderUnicodeStruct* _reencoder_unicode_struct_init(enum ReencoderEncodeType string_type);
+ReencoderUnicodeStruct* _reencoder_unicode_struct_init(enum ReencoderEncodeType string_type, ReencoderArena* arena);
 
 /**
  * @brief Initialises a `ReencoderUnicodeStruct` dynamically based on provided parameters.
@@ -258,7 +415,7 @@ ReencoderUnicodeStruct* _reencoder_unicode_struct_init(enum ReencoderEncodeType
  * string_type is copied as-is.
  * string_buffer is updated dynamically based on string_type; UTF_8 is copied directly while UTF_16 and UTF_32 undergo any needed endianness conversion.
  * string_validity is copied as-is.
- * num_chars is populated to the provided value IF the string is valid, otherwise it is left as default 0.
+ * num_chars and char_flags are populated to the provided values IF the string is valid, otherwise they are left as default 0.
  * num_bytes is copied as-is (from string_buffer_bytes).
  *
  * @param[in] string_type The type of the string to be parsed. Must be one of the `ReencoderEncodeType` enum values.
@@ -266,12 +423,14 @@ ReencoderUnicodeStruct* _reencoder_unicode_struct_init(enum ReencoderEncodeType
  * @param[in] string_buffer_bytes Byte size of string buffer.
  * @param[in] string_validity String validity parsed value.
  * @param[in] num_chars Number of characters present in string buffer. Only populated if string_validity is valid.
+ * @param[in] char_flags REENCODER_CHARS_* flags found while validating the string buffer. Only populated if string_validity is valid.
+ * @param[in] arena Arena to allocate the struct and its string buffer from. NULL allocates from the heap.
  *
  * @return Pointer to a default `ReencoderUnicodeStruct`.
  *
  * @note The returned `ReencoderUnicodeStruct` must be freed using `reencoder_unicode_struct_free()`.
  */
-ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum ReencoderEncodeType string_type, const void* string_buffer, size_t string_buffer_bytes, unsigned int string_validity, size_t num_chars);
+ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum ReencoderEncodeType string_type, const void* string_buffer, size_t string_buffer_bytes, unsigned int string_validity, size_t num_chars, unsigned int char_flags, ReencoderArena* arena);
 
 /**
  * @brief Initialises or grows a buffer for UTF-8/16/32 encoding. Always increases size of buffer.
@@ -312,6 +471,103 @@ void* _reencoder_grow_buffer(void* buffer, size_t* buffer_size_bytes, unsigned i
  */
 void* _reencoder_grow_buffer_dynamic(enum ReencoderEncodeType string_type, void* buffer, size_t* buffer_size_bytes, size_t buffer_current_index, unsigned int allocate_only_one_unit);
 
+/**
+ * @brief Moves the output scratch buffer of a `ReencoderContext` into a buffer owned by a struct.
+ *
+ * A transient context, or a REENCODER_MEMORY_POLICY_COMPACT context, gives up its heap buffer so no copy is made.
+ * The buffer is placed in arena via `_reencoder_adopt_buffer()` if needed. Otherwise it is trimmed to buffer_bytes first under REENCODER_MEMORY_POLICY_COMPACT,
+ * or if it is more than _REENCODER_CONTEXT_GROW_RATE times buffer_bytes.
+ * A REENCODER_MEMORY_POLICY_FAST context keeps its scratch buffer for the next call, and the first buffer_bytes bytes are copied instead.
+ *
+ * @param[in] ctx Context whose scratch_output holds the data.
+ * @param[in] arena Arena owning the destination struct. Can be NULL.
+ * @param[in] buffer_bytes Number of bytes to keep, including the null-terminator.
+ * @param[out] buffer_capacity Pointer to where the number of bytes actually allocated for the returned buffer will be stored.
+ *
+ * @return Pointer to a buffer owned by the destination struct.
+ * @retval NULL If memory allocation fails.
+ */
+void* _reencoder_context_detach_output(ReencoderContext* ctx, ReencoderArena* arena, size_t buffer_bytes, size_t* buffer_capacity);
+
+/**
+ * @brief Ensures a `ReencoderUnicodeStruct` is the only owner of its string buffer before it is modified.
+ *
+ * If the buffer is shared and other references remain, it is copied (at its exact size) and the shared reference is dropped.
+ * If the struct turns out to hold the last reference, the control block is dropped and the buffer kept as-is.
+ *
+ * @param[in] unicode_struct Pointer to the `ReencoderUnicodeStruct` about to be modified.
+ *
+ * @return 1 if the struct now owns its buffer, 0 if memory allocation fails (the struct is left untouched).
+ */
+unsigned int _reencoder_unicode_struct_make_unique(ReencoderUnicodeStruct* unicode_struct);
+
+/**
+ * @brief Releases the string buffer of a `ReencoderUnicodeStruct`, whether it is owned, shared, or in an arena.
+ *
+ * string_buffer and shared are set to NULL afterwards.
+ *
+ * @param[in] unicode_struct Pointer to the `ReencoderUnicodeStruct` whose buffer is released.
+ *
+ * @return void
+ */
+void _reencoder_unicode_struct_release_buffer(ReencoderUnicodeStruct* unicode_struct);
+
+/**
+ * @brief Returns the size in bytes of a single code unit (and so of the null-terminator) of a string type.
+ *
+ * @param[in] string_type Encoding type of the string.
+ *
+ * @return 1 (UTF-8), 2 (UTF-16), or 4 (UTF-32).
+ * @retval 0 If an invalid string_type is provided.
+ */
+size_t _reencoder_code_unit_size(enum ReencoderEncodeType string_type);
+
+/**
+ * @brief Returns the string type with the same code unit width as the given one, but in system byte order.
+ *
+ * @param[in] string_type Encoding type of the string.
+ *
+ * @return UTF_16BE/UTF_16LE or UTF_32BE/UTF_32LE matching system endianness, or string_type itself for UTF-8.
+ */
+enum ReencoderEncodeType _reencoder_host_order_type(enum ReencoderEncodeType string_type);
+
+/**
+ * @brief Returns the byte order the string buffer of a `ReencoderUnicodeStruct` is physically stored in.
+ *
+ * @param[in] unicode_struct Pointer to the `ReencoderUnicodeStruct`.
+ *
+ * @return string_type, or its system byte order counterpart if the struct is stored in host order.
+ */
+enum ReencoderEncodeType _reencoder_unicode_struct_storage_type(const ReencoderUnicodeStruct* unicode_struct);
+
+/**
+ * @brief Marks a freshly created `ReencoderUnicodeStruct` as holding host-order data for the given logical string type.
+ *
+ * Intended for structs whose buffer was populated using `_reencoder_host_order_type()` of logical_type.
+ * UTF-8 structs and NULL are passed through unchanged.
+ *
+ * @param[in,out] unicode_struct Pointer to the `ReencoderUnicodeStruct` to be tagged. Can be NULL.
+ * @param[in] logical_type String type the struct represents.
+ *
+ * @return unicode_struct.
+ */
+ReencoderUnicodeStruct* _reencoder_unicode_struct_tag_host_order(ReencoderUnicodeStruct* unicode_struct, enum ReencoderEncodeType logical_type);
+
+/**
+ * @brief Hands a heap buffer produced by `_reencoder_change_encoding_dynamic()` over to a struct's owner.
+ *
+ * If arena is NULL, the heap buffer is returned as-is.
+ * Otherwise, the first buffer_bytes bytes are copied into the arena and the heap buffer is freed.
+ *
+ * @param[in] arena Arena owning the destination struct. Can be NULL.
+ * @param[in] heap_buffer Heap buffer to be adopted. Always consumed by this function.
+ * @param[in] buffer_bytes Number of bytes to keep, including the null-terminator.
+ *
+ * @return Pointer to the adopted buffer.
+ * @retval NULL If memory allocation fails (heap_buffer is freed).
+ */
+void* _reencoder_adopt_buffer(ReencoderArena* arena, void* heap_buffer, size_t buffer_bytes);
+
 /**
  * @brief Writes a provided source string to an output buffer, converting it to the target encoding type.
  *
@@ -326,12 +582,14 @@ void* _reencoder_grow_buffer_dynamic(enum ReencoderEncodeType string_type, void*
  * @param[in,out] output_buffer_size Pointer to the size of the output buffer. Should be initialised to 0 and is updated during conversion.
  * @param[in] source_buffer Pointer to the source string buffer.
  * @param[out] output_buffer Pointer to a pointer that will hold the address of the output buffer after conversion. Should be initialised to NULL.
+ * @param[in] max_output_bytes Largest output allowed in bytes, excluding the null-terminator. SIZE_MAX if unlimited.
  *
  * @return REENCODER_CONVERT_SUCCESS if the conversion was successful.
  * @retval REENCODER_CONVERT_FAILURE_NULL_ARGS if any of the required pointers are NULL.
  * @retval REENCODER_CONVERT_FAILURE_OOM if memory allocation fails during the conversion process.
+ * @retval REENCODER_CONVERT_FAILURE_TOO_LARGE if the output grew past max_output_bytes. Conversion stops as soon as this is detected.
  */
-unsigned int _reencoder_change_encoding_dynamic(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer);
+unsigned int _reencoder_change_encoding_dynamic(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer, size_t max_output_bytes);
 
 /**
  * @brief Checks if a given Unicode code point is valid.
@@ -344,32 +602,52 @@ unsigned int _reencoder_change_encoding_dynamic(enum ReencoderEncodeType source_
  */
 unsigned int _reencoder_code_point_is_valid(const uint32_t code_point);
 
-// Below are declared extern functions present in reencoder_utf_8.h, reencoder_utf_16.h, and reencoder_utf_32.h.
+/**
+ * @brief Returns the REENCODER_CHARS_* flags of a well-formed string from the largest code point it contains.
+ *
+ * @param[in] max_code_point Largest code point in the string, or any code point in the same range. 0 for an empty string.
+ *
+ * @return REENCODER_CHARS_* flags, 0 if max_code_point is above the BMP.
+ */
+unsigned int _reencoder_char_flags_from_max_code_point(uint32_t max_code_point);
+
+// Below are declared extern functions present in reencoder_utf_8.h, reencoder_utf_16.h, reencoder_utf_32.h, and reencoder_kernel.h.
 // Separated by file for clarity.
 // Look at all those ~chickens~ externs!
 
 extern ReencoderUnicodeStruct* reencoder_utf8_parse(const uint8_t* string);
+extern ReencoderUnicodeStruct* reencoder_utf8_parse_arena(ReencoderArena* arena, const uint8_t* string);
 extern size_t _reencoder_utf8_determine_num_chars(const uint8_t* string);
 extern unsigned int _reencoder_utf8_buffer_idx0_is_valid(const uint8_t* ptr, size_t units_left, unsigned int* units_actual);
-extern unsigned int _reencoder_utf8_seq_is_valid(const uint8_t* string);
+extern size_t _reencoder_utf8_valid_span(const uint8_t* string, size_t units_left, size_t* num_chars, uint8_t* max_leading_byte);
+extern unsigned int _reencoder_utf8_seq_is_valid(const uint8_t* string, unsigned int* char_flags);
 extern uint32_t _reencoder_utf8_decode_to_code_point(const uint8_t* ptr, unsigned int* units_read);
 extern unsigned int _reencoder_utf8_encode_from_code_point(uint8_t* buffer, size_t index, uint32_t code_point);
+extern unsigned int _reencoder_utf8_repair_to_buffer(const uint8_t* string, size_t num_bytes, void** output_buffer, size_t* output_buffer_size, size_t* output_buffer_index, size_t* num_chars, unsigned int* char_flags, size_t max_output_bytes);
 
 extern ReencoderUnicodeStruct* reencoder_utf16_parse_uint16(const uint16_t* string, enum ReencoderEncodeType target_endian);
+extern ReencoderUnicodeStruct* reencoder_utf16_parse_uint16_arena(ReencoderArena* arena, const uint16_t* string, enum ReencoderEncodeType target_endian);
 extern size_t _reencoder_utf16_strlen(const uint16_t* string);
 extern size_t _reencoder_utf16_determine_num_chars(const uint16_t* string);
 extern unsigned int _reencoder_utf16_buffer_idx0_is_valid(const uint16_t* ptr, size_t units_left, unsigned int* units_actual);
-extern unsigned int _reencoder_utf16_seq_is_valid(const uint16_t* string, size_t length);
+extern unsigned int _reencoder_utf16_seq_is_valid(const uint16_t* string, size_t length, unsigned int* char_flags);
 extern void _reencoder_utf16_uint16_from_uint8(uint16_t* dest, const uint8_t* src, size_t bytes, enum ReencoderEncodeType source_endian);
 extern uint32_t _reencoder_utf16_decode_to_code_point(const uint16_t* ptr, unsigned int* char_units);
 extern unsigned int _reencoder_utf16_encode_from_code_point(uint16_t* buffer, size_t index, uint32_t code_point);
 extern void _reencoder_utf16_write_buffer_swap_endian(uint8_t* dest, const uint16_t* src, size_t length);
+extern size_t _reencoder_utf16_repair_in_place(uint8_t* buffer, size_t length, enum ReencoderEncodeType endian, unsigned int* char_flags);
 
 extern ReencoderUnicodeStruct* reencoder_utf32_parse_uint32(const uint32_t* string, enum ReencoderEncodeType target_endian);
+extern ReencoderUnicodeStruct* reencoder_utf32_parse_uint32_arena(ReencoderArena* arena, const uint32_t* string, enum ReencoderEncodeType target_endian);
 extern size_t _reencoder_utf32_strlen(const uint32_t* string);
 extern unsigned int _reencoder_utf32_buffer_idx0_is_valid(const uint32_t* ptr);
-extern unsigned int _reencoder_utf32_seq_is_valid(const uint32_t* string, size_t length);
+extern unsigned int _reencoder_utf32_seq_is_valid(const uint32_t* string, size_t length, unsigned int* char_flags);
 extern void _reencoder_utf32_uint32_from_uint8(uint32_t* dest, const uint8_t* src, size_t bytes, enum ReencoderEncodeType source_endian);
 extern uint32_t _reencoder_utf32_decode_to_code_point(const uint32_t* ptr, unsigned int* units_read);
 extern unsigned int _reencoder_utf32_encode_from_code_point(uint32_t* buffer, size_t index, uint32_t code_point);
 extern void _reencoder_utf32_write_buffer_swap_endian(uint8_t* dest, const uint32_t* src, size_t length);
+extern size_t _reencoder_utf32_repair_in_place(uint8_t* buffer, size_t length, enum ReencoderEncodeType endian, unsigned int* char_flags);
+
+extern unsigned int _reencoder_kernel_convert(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer, size_t max_output_bytes, unsigned int* kernel);
+extern unsigned int _reencoder_kernel_has_trivial_path(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, unsigned int char_flags);
+extern unsigned int _reencoder_kernel_convert_trivial(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, unsigned int char_flags, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer, size_t max_output_bytes);
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "reencoder_utf_common.h"
+#include "reencoder_utf_8.h"
+#include "reencoder_thread_pool.h"
+
+#define _REENCODER_VALIDATE_CHUNK_BYTES 1048576
+#define _REENCODER_SCAN_BASE_SPAN_CAPACITY 16
+#define _REENCODER_SCAN_HISTOGRAM_SIZE 10
+
+/**
+ * @brief A single malformed sequence found by `reencoder_scan_errors()`.
+ *
+ * Contains the byte offset of the sequence (offset), its length in bytes (length), and its outcome (outcome).
+ * The length is what a repair replaces with one U+FFFD.
+ */
+typedef struct {
+	size_t offset;
+	size_t length;
+	unsigned int outcome;
+} ReencoderErrorSpan;
+
+/**
+ * @brief Every malformation found in a buffer by `reencoder_scan_errors()`.
+ *
+ * Contains the encoding type of the buffer (string_type), the total number of malformed sequences (num_errors),
+ * the malformed sequences in buffer order (spans, NULL for summary-only reports), and the number of malformed sequences per outcome (histogram).
+ * histogram is indexed like the outcome arrays, by outcome minus the parse offset of string_type, so index 0 and 1 (valid outcomes) are always 0.
+ */
+typedef struct {
+	enum ReencoderEncodeType string_type;
+	size_t num_errors;
+	ReencoderErrorSpan* spans;
+	size_t histogram[_REENCODER_SCAN_HISTOGRAM_SIZE];
+} ReencoderErrorReport;
+
+/**
+ * @brief Shared state of one `reencoder_validate_parallel()` call, handed to every task run by the pool.
+ *
+ * Contains the buffer being validated with its encoding type and length in code units, the number of code units per task (chunk_units),
+ * and for every task its outcome (outcomes) and the code unit index of its first error (error_indices).
+ */
+typedef struct {
+	enum ReencoderEncodeType string_type;
+	const void* buffer;
+	size_t num_code_units;
+	size_t chunk_units;
+	unsigned int* outcomes;
+	size_t* error_indices;
+} _ReencoderValidateJob;
+
+/**
+ * @brief Checks if a buffer of UTF code units is well-formed, and finds its first malformed sequence.
+ *
+ * Unlike parsing, no `ReencoderUnicodeStruct` is created and nothing is allocated or copied, so this is the cheapest way to accept or reject an input.
+ * Clean runs are skipped several code units at a time: ASCII for UTF-8 and non-surrogates for UTF-16.
+ * Every one of num_code_units code units is checked, null code units are treated as ordinary characters.
+ *
+ * @param[in] string_type Encoding type of the buffer (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE). Code units should follow system endianness.
+ * @param[in] buffer Buffer to be checked. Must be represented as a uint8_t* (UTF-8), uint16_t* (UTF-16), or uint32_t* (UTF-32) and cast to const void*.
+ * @param[in] num_code_units Length of the buffer in code units (not bytes).
+ * @param[out] error_offset Pointer to where the byte offset of the first malformed sequence will be stored, or the length of the buffer in bytes if it is well-formed. Can be NULL if not needed.
+ *
+ * @return REENCODER_UTF8_VALID, REENCODER_UTF16_VALID, or REENCODER_UTF32_VALID if the buffer is well-formed.
+ * @retval REENCODER_*_ERR_* Outcome of the first malformed sequence.
+ * @retval REENCODER_VALIDATE_FAILURE_NULL_ARGS If buffer is NULL while num_code_units is not 0.
+ * @retval REENCODER_VALIDATE_FAILURE_INVALID_TYPE If an invalid `string_type` is provided.
+ */
+unsigned int reencoder_validate(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t* error_offset);
+
+/**
+ * @brief Checks if a buffer of UTF code units is well-formed, splitting the work across the workers of a `ReencoderThreadPool`.
+ *
+ * The buffer is cut into chunks of _REENCODER_VALIDATE_CHUNK_BYTES at arbitrary offsets. Each worker re-synchronises to the first character
+ * that starts at or after its chunk: the code unit after the character containing the last byte before the chunk for UTF-8,
+ * the unit after a high surrogate ending the previous chunk for UTF-16, and the chunk start itself for UTF-32.
+ * That is exactly where a serial check would be if nothing before the chunk was malformed, so the earliest error reported by any chunk
+ * is the first error of the whole buffer, with the same outcome and offset a serial check gives.
+ * Every one of num_code_units code units is checked, null code units are treated as ordinary characters.
+ *
+ * @param[in] pool Pool to run the check on. NULL, or a pool with a single worker, checks on the calling thread like `reencoder_validate()`.
+ * @param[in] string_type Encoding type of the buffer (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE). Code units should follow system endianness.
+ * @param[in] buffer Buffer to be checked. Must be represented as a uint8_t* (UTF-8), uint16_t* (UTF-16), or uint32_t* (UTF-32) and cast to const void*.
+ * @param[in] num_code_units Length of the buffer in code units (not bytes).
+ * @param[out] error_offset Pointer to where the byte offset of the first malformed sequence will be stored, or the length of the buffer in bytes if it is well-formed. Can be NULL if not needed.
+ *
+ * @return REENCODER_UTF8_VALID, REENCODER_UTF16_VALID, or REENCODER_UTF32_VALID if the buffer is well-formed.
+ * @retval REENCODER_*_ERR_* Outcome of the first malformed sequence.
+ * @retval REENCODER_VALIDATE_FAILURE_NULL_ARGS If buffer is NULL while num_code_units is not 0.
+ * @retval REENCODER_VALIDATE_FAILURE_INVALID_TYPE If an invalid `string_type` is provided.
+ */
+unsigned int reencoder_validate_parallel(ReencoderThreadPool* pool, enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t* error_offset);
+
+/**
+ * @brief Finds every malformed sequence in a buffer of UTF code units in one pass.
+ *
+ * Well-formed runs are skipped as quickly as by `reencoder_validate()`, so scanning a clean buffer costs about the same as validating it.
+ * After each malformed sequence the scan resumes right after it, the same way a repair does.
+ * Every one of num_code_units code units is checked, null code units are treated as ordinary characters.
+ *
+ * The returned `ReencoderErrorReport` must be freed using `reencoder_error_report_free()` once it is no longer needed.
+ *
+ * @param[in] string_type Encoding type of the buffer (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE). Code units should follow system endianness.
+ * @param[in] buffer Buffer to be scanned. Must be represented as a uint8_t* (UTF-8), uint16_t* (UTF-16), or uint32_t* (UTF-32) and cast to const void*.
+ * @param[in] num_code_units Length of the buffer in code units (not bytes).
+ * @param[in] summary_only 1 to only count malformed sequences in histogram, 0 to also record each of them in spans.
+ *
+ * @return Pointer to a `ReencoderErrorReport`.
+ * @retval NULL If memory allocation fails, buffer is NULL while num_code_units is not 0, or an invalid `string_type` is provided.
+ */
+ReencoderErrorReport* reencoder_scan_errors(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, unsigned int summary_only);
+
+/**
+ * @brief Frees a `ReencoderErrorReport` and its spans.
+ *
+ * @param[in] report Address of the pointer to the `ReencoderErrorReport` to be freed.
+ *
+ * @return void
+ */
+void reencoder_error_report_free(ReencoderErrorReport** report);
+
+/**
+ * @brief Checks the characters of a buffer that start within [range_start, range_end).
+ *
+ * range_start must be the start of a character. May read past range_end to finish the last character. Stops at the first malformed sequence.
+ *
+ * @param[in] string_type Encoding type of the buffer.
+ * @param[in] buffer Buffer to be checked, in system endianness for UTF-16/UTF-32.
+ * @param[in] num_code_units Length of the whole buffer in code units.
+ * @param[in] range_start Index of the first code unit of the range.
+ * @param[in] range_end Index one past the last code unit of the range.
+ * @param[out] error_index Pointer to where the code unit index of the first malformed sequence will be stored. Only updated if one is found.
+ *
+ * @return REENCODER_UTF8_VALID, REENCODER_UTF16_VALID, or REENCODER_UTF32_VALID if the range is well-formed.
+ * @retval REENCODER_*_ERR_* Outcome of the first malformed sequence in the range.
+ */
+unsigned int _reencoder_validate_range(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t range_start, size_t range_end, size_t* error_index);
@@ -0,0 +1,175 @@
+#include "../headers/reencoder_arena.h"
+
+/**
+ * @brief Rounds a byte count up to the next multiple of _REENCODER_ARENA_ALIGNMENT.
+ *
+ * @param[in] bytes Byte count to be rounded.
+ *
+ * @return Rounded byte count.
+ */
+static inline size_t _reencoder_arena_align(size_t bytes);
+
+/**
+ * @brief Allocates a new chunk able to hold at least capacity bytes.
+ *
+ * @param[in] capacity Usable size of the chunk in bytes.
+ *
+ * @return Pointer to the new chunk.
+ * @retval NULL If memory allocation fails.
+ */
+static _ReencoderArenaChunk* _reencoder_arena_chunk_create(size_t capacity);
+
+/**
+ * @brief Returns the start of the usable memory of a chunk.
+ *
+ * @param[in] chunk Pointer to the chunk.
+ *
+ * @return Pointer to the first usable byte of the chunk.
+ */
+static inline uint8_t* _reencoder_arena_chunk_data(_ReencoderArenaChunk* chunk);
+
+ReencoderArena* reencoder_arena_create(size_t chunk_size) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	ReencoderArena* arena = (ReencoderArena*)malloc(sizeof(ReencoderArena));
+	if (arena == NULL) {
+		return NULL;
+	}
+
+	arena->head = NULL;
+	arena->current = NULL;
+	arena->chunk_size = _reencoder_arena_align(chunk_size == 0 ? _REENCODER_ARENA_DEFAULT_CHUNK_SIZE : chunk_size);
+
+	return arena;
+}
+
+void reencoder_arena_reset(ReencoderArena* arena) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (arena == NULL) {
+		return;
+	}
+
+	for (_ReencoderArenaChunk* chunk = arena->head; chunk != NULL; chunk = chunk->next) {
+		chunk->used = 0;
+	}
+	arena->current = arena->head;
+}
+
+void reencoder_arena_destroy(ReencoderArena** arena) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (arena == NULL || *arena == NULL) {
+		return;
+	}
+
+	_ReencoderArenaChunk* chunk = (*arena)->head;
+	while (chunk != NULL) {
+		_ReencoderArenaChunk* next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+	free(*arena);
+
+	*arena = NULL;
+}
+
+void* _reencoder_arena_alloc(ReencoderArena* arena, size_t bytes) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (arena == NULL) {
+		return NULL;
+	}
+
+	size_t bytes_aligned = _reencoder_arena_align(bytes == 0 ? 1 : bytes);
+	if (bytes_aligned < bytes) {
+		return NULL; // overflow
+	}
+
+	// bump the current chunk if possible, otherwise move on to a chunk kept from before the last reset
+	_ReencoderArenaChunk* chunk = arena->current;
+	if (chunk != NULL && chunk->capacity - chunk->used < bytes_aligned) {
+		chunk = chunk->next;
+		if (chunk != NULL && chunk->capacity - chunk->used < bytes_aligned) {
+			chunk = NULL;
+		}
+	}
+
+	// no kept chunk fits, link a new one right after the current chunk so that kept chunks stay reachable
+	if (chunk == NULL) {
+		chunk = _reencoder_arena_chunk_create(bytes_aligned > arena->chunk_size ? bytes_aligned : arena->chunk_size);
+		if (chunk == NULL) {
+			return NULL;
+		}
+
+		if (arena->current == NULL) {
+			chunk->next = arena->head;
+			arena->head = chunk;
+		}
+		else {
+			chunk->next = arena->current->next;
+			arena->current->next = chunk;
+		}
+	}
+
+	arena->current = chunk;
+
+	void* block = _reencoder_arena_chunk_data(chunk) + chunk->used;
+	chunk->used += bytes_aligned;
+
+	return block;
+}
+
+void* _reencoder_alloc(ReencoderArena* arena, size_t bytes) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (arena == NULL) {
+		return malloc(bytes);
+	}
+
+	return _reencoder_arena_alloc(arena, bytes);
+}
+
+void _reencoder_free(ReencoderArena* arena, void* ptr) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (arena == NULL) {
+		free(ptr);
+	}
+}
+
+static inline size_t _reencoder_arena_align(size_t bytes) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	return (bytes + (_REENCODER_ARENA_ALIGNMENT - 1)) & ~((size_t)_REENCODER_ARENA_ALIGNMENT - 1);
+}
+
+static _ReencoderArenaChunk* _reencoder_arena_chunk_create(size_t capacity) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	_ReencoderArenaChunk* chunk = (_ReencoderArenaChunk*)malloc(_reencoder_arena_align(sizeof(_ReencoderArenaChunk)) + capacity);
+	if (chunk == NULL) {
+		return NULL;
+	}
+
+	chunk->next = NULL;
+	chunk->capacity = capacity;
+	chunk->used = 0;
+
+	return chunk;
+}
+
+static inline uint8_t* _reencoder_arena_chunk_data(_ReencoderArenaChunk* chunk) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	return (uint8_t*)chunk + _reencoder_arena_align(sizeof(_ReencoderArenaChunk));
+}
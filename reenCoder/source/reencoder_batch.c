@@ -0,0 +1,427 @@
+#include "../headers/reencoder_batch.h"
+
+/**
+ * @brief Allocates a `ReencoderBatch` together with its per-string arrays, leaving the buffer empty.
+ *
+ * @param[in] target_encoding Encoding type of the output strings.
+ * @param[in] num_strings Number of strings in the batch.
+ *
+ * @return Pointer to a `ReencoderBatch`.
+ * @retval NULL If memory allocation fails.
+ */
+static ReencoderBatch* _reencoder_batch_create(enum ReencoderEncodeType target_encoding, size_t num_strings);
+
+/**
+ * @brief Validates and converts a single batch input, appending it to an output buffer in target_encoding byte order.
+ *
+ * @param[in] source_encoding Encoding type of the input.
+ * @param[in] target_encoding Encoding type of the output.
+ * @param[in] string Input string, in system endianness for UTF-16/UTF-32. Can be NULL.
+ * @param[in] length Pointer to the length of the input in code units. NULL if the input is null-terminated.
+ * @param[in,out] output_buffer Address of the output buffer pointer. Grown as needed, freed on allocation failure.
+ * @param[in,out] output_buffer_size Current size of the output buffer in bytes.
+ * @param[in,out] output_buffer_index Index in target code units to write at. Is updated to point past the null-terminator of the string.
+ * @param[out] num_bytes Pointer to where the length of the output in bytes, excluding the null-terminator, will be stored.
+ * @param[out] num_chars Pointer to where the number of characters will be stored.
+ * @param[out] validity Pointer to where the outcome of the string will be stored.
+ *
+ * @return 1 if successful, 0 if memory allocation fails.
+ */
+static unsigned int _reencoder_batch_convert_string(
+	enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* string, const size_t* length,
+	void** output_buffer, size_t* output_buffer_size, size_t* output_buffer_index, size_t* num_bytes, size_t* num_chars, unsigned int* validity
+);
+
+/**
+ * @brief Converts every string of one task into the scratch buffer of the worker running it. Matches `_ReencoderTaskFunction`.
+ *
+ * @param[in] job Pointer to the `_ReencoderBatchJob` of the call.
+ * @param[in] worker_index Index of the worker running the task.
+ * @param[in] task_index Index of the task.
+ *
+ * @return void
+ */
+static void _reencoder_batch_run_task(void* job, size_t worker_index, size_t task_index);
+
+/**
+ * @brief Validates a single batch input and counts its characters in one pass.
+ *
+ * Validation stops at the first null code unit, so string_num_code_units is updated to the length actually used.
+ *
+ * @param[in] source_encoding Encoding type of the input.
+ * @param[in] string Input string, in system endianness for UTF-16/UTF-32.
+ * @param[in,out] string_num_code_units Maximum number of code units to examine. Is updated to the number of code units before the first null code unit.
+ * @param[out] num_chars Pointer to where the number of characters will be stored. Only meaningful if the input is valid.
+ *
+ * @return REENCODER_UTF8_VALID, REENCODER_UTF16_VALID, or REENCODER_UTF32_VALID.
+ * @retval The first error outcome of source_encoding found in the input.
+ */
+static unsigned int _reencoder_batch_validate(enum ReencoderEncodeType source_encoding, const void* string, size_t* string_num_code_units, size_t* num_chars);
+
+/**
+ * @brief Returns the outcome of a well-formed string of the given encoding type.
+ *
+ * @param[in] string_type Encoding type of the string.
+ *
+ * @return REENCODER_UTF8_VALID, REENCODER_UTF16_VALID, or REENCODER_UTF32_VALID.
+ */
+static unsigned int _reencoder_batch_valid_outcome(enum ReencoderEncodeType string_type);
+
+ReencoderBatch* reencoder_convert_batch(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* const* inputs, const size_t* lengths, size_t num_strings) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	size_t target_unit_size = _reencoder_code_unit_size(target_encoding);
+	if (_reencoder_code_unit_size(source_encoding) == 0 || target_unit_size == 0 || (inputs == NULL && num_strings != 0)) {
+		return NULL;
+	}
+
+	ReencoderBatch* batch = _reencoder_batch_create(target_encoding, num_strings);
+	if (batch == NULL) {
+		return NULL;
+	}
+
+	// reserve a first estimate up front (exact for same-width conversions), so that most batches never reallocate
+	size_t output_buffer_size = 0;
+	if (lengths != NULL) {
+		size_t estimated_bytes = 0;
+		for (size_t i = 0; i < num_strings; i++) {
+			estimated_bytes += (lengths[i] + 1) * target_unit_size;
+		}
+		if (_reencoder_context_reserve((void**)&batch->buffer, &output_buffer_size, estimated_bytes) == NULL) {
+			reencoder_batch_free(&batch);
+			return NULL;
+		}
+	}
+
+	// output_buffer_index counts target code units, same as _reencoder_kernel_convert()
+	size_t output_buffer_index = 0;
+	for (size_t i = 0; i < num_strings; i++) {
+		batch->offsets[i] = output_buffer_index * target_unit_size;
+
+		if (!_reencoder_batch_convert_string(
+			source_encoding, target_encoding, inputs[i], lengths == NULL ? NULL : &lengths[i],
+			(void**)&batch->buffer, &output_buffer_size, &output_buffer_index, &batch->num_bytes[i], &batch->num_chars[i], &batch->validity[i]
+		)) {
+			reencoder_batch_free(&batch);
+			return NULL;
+		}
+	}
+	batch->buffer_bytes = output_buffer_index * target_unit_size;
+
+	return batch;
+}
+
+ReencoderBatch* reencoder_convert_batch_pool(ReencoderThreadPool* pool, enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* const* inputs, const size_t* lengths, size_t num_strings) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (pool == NULL || pool->num_workers <= 1) {
+		return reencoder_convert_batch(source_encoding, target_encoding, inputs, lengths, num_strings);
+	}
+
+	size_t target_unit_size = _reencoder_code_unit_size(target_encoding);
+	if (_reencoder_code_unit_size(source_encoding) == 0 || target_unit_size == 0 || (inputs == NULL && num_strings != 0)) {
+		return NULL;
+	}
+
+	ReencoderBatch* batch = _reencoder_batch_create(target_encoding, num_strings);
+	if (batch == NULL || num_strings == 0) {
+		return batch;
+	}
+
+	// task_starts (num_strings + 1), task_workers (num_strings) and worker_units (num_workers) share one block
+	size_t* task_starts = (size_t*)malloc(((2 * num_strings) + 1 + pool->num_workers) * sizeof(size_t));
+	if (task_starts == NULL) {
+		reencoder_batch_free(&batch);
+		return NULL;
+	}
+
+	// cut a task once it holds enough strings or enough known code units, so that a single long string forms a task of its own
+	size_t num_tasks = 0;
+	size_t task_units = 0;
+	task_starts[0] = 0;
+	for (size_t i = 0; i < num_strings; i++) {
+		if (lengths != NULL) {
+			task_units += lengths[i];
+		}
+		if ((i + 1) - task_starts[num_tasks] == _REENCODER_BATCH_TASK_MAX_STRINGS || task_units >= _REENCODER_BATCH_TASK_MAX_UNITS) {
+			task_starts[++num_tasks] = i + 1;
+			task_units = 0;
+		}
+	}
+	if (task_starts[num_tasks] != num_strings) {
+		task_starts[++num_tasks] = num_strings;
+	}
+
+	_ReencoderBatchJob job;
+	job.pool = pool;
+	job.source_encoding = source_encoding;
+	job.target_encoding = target_encoding;
+	job.inputs = inputs;
+	job.lengths = lengths;
+	job.batch = batch;
+	job.task_starts = task_starts;
+	job.task_workers = task_starts + num_strings + 1;
+	job.worker_units = job.task_workers + num_strings;
+	job.has_failed = 0;
+	memset(job.worker_units, 0x00, pool->num_workers * sizeof(size_t));
+
+	_reencoder_thread_pool_run(pool, num_tasks, _reencoder_batch_run_task, &job);
+
+	size_t total_units = 0;
+	for (size_t i = 0; i < pool->num_workers; i++) {
+		total_units += job.worker_units[i];
+	}
+	if (_reencoder_atomic_load(&job.has_failed) == 0) {
+		batch->buffer = (uint8_t*)malloc(total_units * target_unit_size);
+	}
+	if (batch->buffer == NULL) {
+		free(task_starts);
+		reencoder_batch_free(&batch);
+		return NULL;
+	}
+
+	// stitch the worker buffers together, worker_units becomes the unit offset of each worker's part
+	size_t worker_start = 0;
+	for (size_t i = 0; i < pool->num_workers; i++) {
+		size_t worker_units = job.worker_units[i];
+		if (worker_units != 0) {
+			memcpy(batch->buffer + (worker_start * target_unit_size), pool->workers[i].scratch, worker_units * target_unit_size);
+		}
+		job.worker_units[i] = worker_start;
+		worker_start += worker_units;
+	}
+	for (size_t i = 0; i < num_tasks; i++) {
+		size_t worker_offset = job.worker_units[job.task_workers[i]] * target_unit_size;
+		for (size_t j = task_starts[i]; j < task_starts[i + 1]; j++) {
+			batch->offsets[j] += worker_offset;
+		}
+	}
+	batch->buffer_bytes = total_units * target_unit_size;
+
+	free(task_starts);
+
+	return batch;
+}
+
+void reencoder_batch_free(ReencoderBatch** batch) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (batch == NULL || *batch == NULL) {
+		return;
+	}
+
+	free((*batch)->buffer);
+	free(*batch);
+
+	*batch = NULL;
+}
+
+static ReencoderBatch* _reencoder_batch_create(enum ReencoderEncodeType target_encoding, size_t num_strings) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// the batch and all of its per-string arrays live in one block, size_t arrays first so that every array stays aligned
+	size_t arrays_bytes = num_strings * ((3 * sizeof(size_t)) + sizeof(unsigned int));
+	ReencoderBatch* batch = (ReencoderBatch*)malloc(sizeof(ReencoderBatch) + arrays_bytes);
+	if (batch == NULL) {
+		return NULL;
+	}
+
+	batch->string_type = target_encoding;
+	batch->buffer = NULL;
+	batch->buffer_bytes = 0;
+	batch->num_strings = num_strings;
+	batch->offsets = (size_t*)(batch + 1);
+	batch->num_bytes = batch->offsets + num_strings;
+	batch->num_chars = batch->num_bytes + num_strings;
+	batch->validity = (unsigned int*)(batch->num_chars + num_strings);
+
+	return batch;
+}
+
+static unsigned int _reencoder_batch_convert_string(
+	enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* string, const size_t* length,
+	void** output_buffer, size_t* output_buffer_size, size_t* output_buffer_index, size_t* num_bytes, size_t* num_chars, unsigned int* validity
+) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	size_t target_unit_size = _reencoder_code_unit_size(target_encoding);
+
+	size_t string_num_code_units = 0;
+	if (string != NULL) {
+		if (length != NULL) {
+			string_num_code_units = *length;
+		}
+		else if (source_encoding == UTF_8) {
+			string_num_code_units = strlen((const char*)string);
+		}
+		else if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
+			string_num_code_units = _reencoder_utf16_strlen((const uint16_t*)string);
+		}
+		else {
+			string_num_code_units = _reencoder_utf32_strlen((const uint32_t*)string);
+		}
+	}
+
+	*num_chars = 0;
+	*validity = string_num_code_units == 0 ?
+		_reencoder_batch_valid_outcome(source_encoding) : _reencoder_batch_validate(source_encoding, string, &string_num_code_units, num_chars);
+	_REENCODER_STATS_VALIDATED(source_encoding, string_num_code_units * _reencoder_code_unit_size(source_encoding), *validity);
+
+	// invalid strings are stored empty, their outcome tells the caller to handle them separately
+	if (*validity != _reencoder_batch_valid_outcome(source_encoding)) {
+		string_num_code_units = 0;
+		*num_chars = 0;
+	}
+	else {
+		*validity = _reencoder_batch_valid_outcome(target_encoding);
+	}
+
+	size_t string_start_index = *output_buffer_index;
+	unsigned int kernel = REENCODER_STATS_TIER_COPY;
+	if (_reencoder_code_unit_size(source_encoding) == target_unit_size) {
+		// same code unit width, the validated units are copied as-is
+		if (_reencoder_context_reserve(output_buffer, output_buffer_size, (*output_buffer_index + string_num_code_units + 1) * target_unit_size) == NULL) {
+			return 0;
+		}
+
+		if (string_num_code_units != 0) {
+			memcpy((uint8_t*)*output_buffer + (*output_buffer_index * target_unit_size), string, string_num_code_units * target_unit_size);
+			*output_buffer_index += string_num_code_units;
+		}
+		memset((uint8_t*)*output_buffer + (*output_buffer_index * target_unit_size), 0x00, target_unit_size);
+	}
+	else if (_reencoder_kernel_convert(
+		source_encoding, target_encoding, string_num_code_units,
+		output_buffer_index, output_buffer_size, string == NULL ? (const void*)"" : string, output_buffer, SIZE_MAX, &kernel
+	) != REENCODER_CONVERT_SUCCESS) {
+		return 0;
+	}
+
+	// the string was written in system endianness, the null-terminator reads the same either way
+	size_t string_units_written = *output_buffer_index - string_start_index;
+	if (target_encoding != _reencoder_host_order_type(target_encoding) && string_units_written != 0) {
+		uint8_t* string_start = (uint8_t*)*output_buffer + (string_start_index * target_unit_size);
+		if (target_unit_size == sizeof(uint16_t)) {
+			_reencoder_utf16_write_buffer_swap_endian(string_start, (const uint16_t*)string_start, string_units_written);
+		}
+		else {
+			_reencoder_utf32_write_buffer_swap_endian(string_start, (const uint32_t*)string_start, string_units_written);
+		}
+	}
+
+	_REENCODER_STATS_ADD(tier_calls[kernel], 1);
+	_REENCODER_STATS_ADD(bytes_converted[source_encoding][target_encoding], string_num_code_units * _reencoder_code_unit_size(source_encoding));
+	*num_bytes = string_units_written * target_unit_size;
+	(*output_buffer_index)++; // step over the null-terminator
+
+	return 1;
+}
+
+static void _reencoder_batch_run_task(void* job, size_t worker_index, size_t task_index) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	_ReencoderBatchJob* batch_job = (_ReencoderBatchJob*)job;
+	_ReencoderWorker* worker = &batch_job->pool->workers[worker_index];
+	ReencoderBatch* batch = batch_job->batch;
+	size_t target_unit_size = _reencoder_code_unit_size(batch_job->target_encoding);
+
+	// kept in a local so that workers do not keep writing to neighbouring entries of worker_units
+	size_t worker_units = batch_job->worker_units[worker_index];
+	for (size_t i = batch_job->task_starts[task_index]; i < batch_job->task_starts[task_index + 1]; i++) {
+		if (_reencoder_atomic_load(&batch_job->has_failed) != 0) {
+			break;
+		}
+
+		batch->offsets[i] = worker_units * target_unit_size;
+
+		if (!_reencoder_batch_convert_string(
+			batch_job->source_encoding, batch_job->target_encoding, batch_job->inputs[i], batch_job->lengths == NULL ? NULL : &batch_job->lengths[i],
+			&worker->scratch, &worker->scratch_size, &worker_units, &batch->num_bytes[i], &batch->num_chars[i], &batch->validity[i]
+		)) {
+			// the scratch buffer has been freed, nothing written to it so far is usable
+			_reencoder_atomic_increment(&batch_job->has_failed);
+			worker_units = 0;
+			break;
+		}
+	}
+
+	batch_job->worker_units[worker_index] = worker_units;
+	batch_job->task_workers[task_index] = worker_index;
+}
+
+static unsigned int _reencoder_batch_validate(enum ReencoderEncodeType source_encoding, const void* string, size_t* string_num_code_units, size_t* num_chars) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	size_t length = *string_num_code_units;
+
+	if (source_encoding == UTF_8) {
+		const uint8_t* string_uint8 = (const uint8_t*)string;
+
+		// the span only ends early at a null byte or at the first malformed sequence
+		size_t span = _reencoder_utf8_valid_span(string_uint8, length, num_chars, NULL);
+		if (span == length || string_uint8[span] == 0x00) {
+			*string_num_code_units = span;
+			return REENCODER_UTF8_VALID;
+		}
+
+		return _reencoder_utf8_buffer_idx0_is_valid(string_uint8 + span, length - span, NULL);
+	}
+
+	if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
+		const uint16_t* string_uint16 = (const uint16_t*)string;
+
+		size_t i = 0;
+		size_t chars_counted = 0;
+		while (i < length && string_uint16[i] != 0x0000) {
+			unsigned int units_read = 0;
+			unsigned int return_code = _reencoder_utf16_buffer_idx0_is_valid(string_uint16 + i, length - i, &units_read);
+			if (return_code != REENCODER_UTF16_VALID) {
+				return return_code;
+			}
+
+			i += units_read;
+			chars_counted++;
+		}
+
+		*string_num_code_units = i;
+		*num_chars = chars_counted;
+		return REENCODER_UTF16_VALID;
+	}
+
+	const uint32_t* string_uint32 = (const uint32_t*)string;
+
+	size_t i = 0;
+	for (; i < length && string_uint32[i] != 0x00000000; i++) {
+		unsigned int return_code = _reencoder_utf32_buffer_idx0_is_valid(string_uint32 + i);
+		if (return_code != REENCODER_UTF32_VALID) {
+			return return_code;
+		}
+	}
+
+	// every UTF-32 code unit is one character
+	*string_num_code_units = i;
+	*num_chars = i;
+	return REENCODER_UTF32_VALID;
+}
+
+static unsigned int _reencoder_batch_valid_outcome(enum ReencoderEncodeType string_type) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	switch (string_type) {
+	case UTF_8:
+		return REENCODER_UTF8_VALID;
+	case UTF_16BE:
+	case UTF_16LE:
+		return REENCODER_UTF16_VALID;
+	default:
+		return REENCODER_UTF32_VALID;
+	}
+}
@@ -0,0 +1,138 @@
+#include "../headers/reencoder_context.h"
+
+ReencoderContext* reencoder_context_create(ReencoderArena* arena) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	ReencoderContext* ctx = (ReencoderContext*)malloc(sizeof(ReencoderContext));
+	if (ctx == NULL) {
+		return NULL;
+	}
+
+	_reencoder_context_init_transient(ctx, arena);
+	ctx->is_transient = 0;
+
+	return ctx;
+}
+
+void reencoder_context_destroy(ReencoderContext** ctx) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (ctx == NULL || *ctx == NULL) {
+		return;
+	}
+
+	_reencoder_context_release(*ctx);
+	free(*ctx);
+
+	*ctx = NULL;
+}
+
+void reencoder_context_set_memory_policy(ReencoderContext* ctx, enum ReencoderMemoryPolicy memory_policy) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (ctx == NULL) {
+		return;
+	}
+
+	ctx->memory_policy = memory_policy;
+}
+
+void reencoder_context_set_host_order_storage(ReencoderContext* ctx, unsigned int host_order_storage) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (ctx == NULL) {
+		return;
+	}
+
+	ctx->host_order_storage = host_order_storage ? 1 : 0;
+}
+
+void reencoder_context_set_max_expansion(ReencoderContext* ctx, size_t max_expansion_percent) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (ctx == NULL) {
+		return;
+	}
+
+	ctx->max_expansion_percent = max_expansion_percent;
+}
+
+void _reencoder_context_init_transient(ReencoderContext* ctx, ReencoderArena* arena) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	ctx->scratch_source = NULL;
+	ctx->scratch_source_size = 0;
+	ctx->scratch_output = NULL;
+	ctx->scratch_output_size = 0;
+	ctx->arena = arena;
+	ctx->is_transient = 1;
+	ctx->memory_policy = REENCODER_MEMORY_POLICY_FAST;
+	ctx->host_order_storage = 0;
+	ctx->max_expansion_percent = 0;
+}
+
+void _reencoder_context_release(ReencoderContext* ctx) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	free(ctx->scratch_source);
+	free(ctx->scratch_output);
+
+	ctx->scratch_source = NULL;
+	ctx->scratch_source_size = 0;
+	ctx->scratch_output = NULL;
+	ctx->scratch_output_size = 0;
+}
+
+void* _reencoder_context_reserve(void** buffer, size_t* buffer_size_bytes, size_t bytes_needed) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (*buffer != NULL && *buffer_size_bytes >= bytes_needed) {
+		return *buffer;
+	}
+
+	// grow at least geometrically so that slowly increasing inputs do not realloc every call
+	size_t new_size = *buffer_size_bytes * _REENCODER_CONTEXT_GROW_RATE;
+	if (new_size < bytes_needed) {
+		new_size = bytes_needed;
+	}
+
+	void* new_buffer = realloc(*buffer, new_size);
+	if (new_buffer == NULL) {
+		free(*buffer);
+		*buffer = NULL;
+		*buffer_size_bytes = 0;
+		return NULL;
+	}
+
+	*buffer = new_buffer;
+	*buffer_size_bytes = new_size;
+	_REENCODER_STATS_GROW(new_size);
+
+	return new_buffer;
+}
+
+size_t _reencoder_context_output_limit(const ReencoderContext* ctx, size_t input_bytes) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (ctx == NULL || ctx->max_expansion_percent == 0) {
+		return SIZE_MAX;
+	}
+
+	// split the input so that input_bytes * max_expansion_percent cannot overflow before the division
+	size_t whole_hundreds = input_bytes / 100;
+	size_t remainder = input_bytes % 100;
+	if (whole_hundreds != 0 && ctx->max_expansion_percent > (SIZE_MAX / 2) / whole_hundreds) {
+		return SIZE_MAX / 2; // larger than any buffer that could ever be allocated, but still a cap
+	}
+
+	return (whole_hundreds * ctx->max_expansion_percent) + ((remainder * ctx->max_expansion_percent) / 100);
+}
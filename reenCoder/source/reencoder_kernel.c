@@ -0,0 +1,585 @@
+#include "../headers/reencoder_kernel.h"
+
+// running character distribution of the calling thread, per source encoding
+// zero-initialised, so a thread starts out on _REENCODER_KERNEL_GENERAL
+static _REENCODER_STATS_THREAD_LOCAL _ReencoderKernelHistory _reencoder_kernel_histories[REENCODER_STATS_NUM_ENCODINGS];
+
+/**
+ * @brief Counts the characters of one window of well-formed code units, along with how many of them are ASCII and how many are above U+FFFF.
+ *
+ * A window may start or end in the middle of a character. Trailing code units at its start are skipped, and a character is counted by its first code unit.
+ */
+static void _reencoder_kernel_sample_window(enum ReencoderEncodeType source_encoding, const void* source_buffer, size_t window_start, size_t window_units, size_t* num_chars, size_t* num_ascii, size_t* num_supplementary);
+
+/**
+ * @brief Returns the largest number of target code units a single well-formed source code unit can turn into.
+ */
+static size_t _reencoder_kernel_max_units_per_unit(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding);
+
+/**
+ * @brief Copies runs of _REENCODER_KERNEL_ASCII_RUN ASCII code units from the start of source, widening or narrowing them to the target code unit size.
+ *
+ * Stops at the first run that is not entirely ASCII, or that would not fit in either buffer.
+ *
+ * @return Number of code units copied, which is also the number written.
+ */
+static size_t _reencoder_kernel_copy_ascii_runs(size_t source_unit_size, size_t target_unit_size, const uint8_t* source, uint8_t* output, size_t units_left, size_t output_units_left);
+
+/**
+ * @brief Widens or narrows num_units code units from source to output one for one, for text where every unit is the same value in both sizes.
+ */
+static void _reencoder_kernel_copy_units(size_t source_unit_size, size_t target_unit_size, const void* source, void* output, size_t num_units);
+
+/**
+ * @brief Reads the code unit at the given index (in code units) of a buffer of the given code unit size.
+ */
+static inline uint32_t _reencoder_kernel_load_unit(size_t unit_size, const void* buffer, size_t index);
+
+/**
+ * @brief Writes a code unit at the given index (in code units) of a buffer of the given code unit size.
+ */
+static inline void _reencoder_kernel_store_unit(size_t unit_size, void* buffer, size_t index, uint32_t unit);
+
+/**
+ * @brief Decodes one well-formed character to a code point, without checking it again.
+ */
+static inline uint32_t _reencoder_kernel_decode(enum ReencoderEncodeType source_encoding, const uint8_t* ptr, unsigned int* units_read);
+
+/**
+ * @brief Encodes one code point at the given index (in code units) of the output buffer.
+ *
+ * @return Number of code units written.
+ */
+static inline unsigned int _reencoder_kernel_encode(enum ReencoderEncodeType target_encoding, void* output_buffer, size_t index, uint32_t code_point);
+
+/**
+ * @brief Decodes one well-formed character if it is above U+FFFF (a 4-byte sequence, a surrogate pair, or a UTF-32 unit past the BMP).
+ *
+ * @return 1 if the character was decoded, 0 if it is in the BMP and was left alone.
+ */
+static inline unsigned int _reencoder_kernel_decode_supplementary(enum ReencoderEncodeType source_encoding, const uint8_t* ptr, uint32_t* code_point, unsigned int* units_read);
+
+/**
+ * @brief Encodes one valid code point above U+FFFF at the given index (in code units) of the output buffer.
+ *
+ * @return Number of code units written.
+ */
+static inline unsigned int _reencoder_kernel_encode_supplementary(enum ReencoderEncodeType target_encoding, void* output_buffer, size_t index, uint32_t code_point);
+
+unsigned int _reencoder_kernel_select(enum ReencoderEncodeType source_encoding, const void* source_buffer, size_t string_num_code_units) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if ((unsigned int)source_encoding >= REENCODER_STATS_NUM_ENCODINGS || source_buffer == NULL) {
+		return _REENCODER_KERNEL_GENERAL;
+	}
+
+	// short inputs are sampled whole, longer ones at their start and at evenly strided windows up to their end
+	size_t num_chars = 0;
+	size_t num_ascii = 0;
+	size_t num_supplementary = 0;
+	if (string_num_code_units <= _REENCODER_KERNEL_SAMPLE_WINDOWS * _REENCODER_KERNEL_SAMPLE_UNITS) {
+		_reencoder_kernel_sample_window(source_encoding, source_buffer, 0, string_num_code_units, &num_chars, &num_ascii, &num_supplementary);
+	}
+	else {
+		size_t stride = (string_num_code_units - _REENCODER_KERNEL_SAMPLE_UNITS) / (_REENCODER_KERNEL_SAMPLE_WINDOWS - 1);
+		for (size_t i = 0; i < _REENCODER_KERNEL_SAMPLE_WINDOWS; i++) {
+			_reencoder_kernel_sample_window(source_encoding, source_buffer, i * stride, _REENCODER_KERNEL_SAMPLE_UNITS, &num_chars, &num_ascii, &num_supplementary);
+		}
+	}
+
+	_ReencoderKernelHistory* history = &_reencoder_kernel_histories[source_encoding];
+	if (num_chars == 0) {
+		return history->kernel;
+	}
+
+	int32_t ascii_permille = (int32_t)((num_ascii * 1000) / num_chars);
+	int32_t supplementary_permille = (int32_t)((num_supplementary * 1000) / num_chars);
+	if (!history->has_samples) {
+		history->ascii_permille = ascii_permille;
+		history->supplementary_permille = supplementary_permille;
+		history->has_samples = 1;
+	}
+	else {
+		history->ascii_permille += (ascii_permille - history->ascii_permille) / (1 << _REENCODER_KERNEL_HISTORY_SHIFT);
+		history->supplementary_permille += (supplementary_permille - history->supplementary_permille) / (1 << _REENCODER_KERNEL_HISTORY_SHIFT);
+	}
+
+	// the kernel in use is only left once its share falls clearly below the threshold that chose it, so inputs near a threshold do not flip-flop
+	int32_t ascii_threshold = _REENCODER_KERNEL_ASCII_PERMILLE - (history->kernel == _REENCODER_KERNEL_ASCII ? _REENCODER_KERNEL_HYSTERESIS_PERMILLE : 0);
+	int32_t supplementary_threshold = _REENCODER_KERNEL_SUPPLEMENTARY_PERMILLE - (history->kernel == _REENCODER_KERNEL_SUPPLEMENTARY ? _REENCODER_KERNEL_HYSTERESIS_PERMILLE : 0);
+	if (history->ascii_permille >= ascii_threshold) {
+		history->kernel = _REENCODER_KERNEL_ASCII;
+	}
+	else if (history->supplementary_permille >= supplementary_threshold) {
+		history->kernel = _REENCODER_KERNEL_SUPPLEMENTARY;
+	}
+	else {
+		history->kernel = _REENCODER_KERNEL_GENERAL;
+	}
+
+	return history->kernel;
+}
+
+unsigned int _reencoder_kernel_convert(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer, size_t max_output_bytes, unsigned int* kernel) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (source_buffer == NULL || output_buffer_index == NULL || output_buffer_size == NULL || output_buffer == NULL) {
+		return REENCODER_CONVERT_FAILURE_NULL_ARGS;
+	}
+
+	size_t source_unit_size = _reencoder_code_unit_size(source_encoding);
+	size_t target_unit_size = _reencoder_code_unit_size(target_encoding);
+
+	// compare in target code units, so the loop does not multiply on every character
+	size_t max_output_units = max_output_bytes == SIZE_MAX ? SIZE_MAX : max_output_bytes / target_unit_size;
+
+	// reserve the worst case once, or up to the cap if that is smaller, plus one character past the cap (at most 4 code units) and the null-terminator
+	size_t reserve_units = string_num_code_units * _reencoder_kernel_max_units_per_unit(source_encoding, target_encoding);
+	if (reserve_units > max_output_units) {
+		reserve_units = max_output_units;
+	}
+	if (_reencoder_context_reserve(output_buffer, output_buffer_size, (*output_buffer_index + reserve_units + 4 + 1) * target_unit_size) == NULL) {
+		return REENCODER_CONVERT_FAILURE_OOM;
+	}
+
+	unsigned int selected_kernel = _reencoder_kernel_select(source_encoding, source_buffer, string_num_code_units);
+
+	const uint8_t* ptr_read = (const uint8_t*)source_buffer;
+	size_t units_processed = 0;
+	while (units_processed < string_num_code_units) {
+		if (selected_kernel == _REENCODER_KERNEL_ASCII) {
+			size_t units_copied = _reencoder_kernel_copy_ascii_runs(
+				source_unit_size, target_unit_size, ptr_read, (uint8_t*)*output_buffer + (*output_buffer_index * target_unit_size),
+				string_num_code_units - units_processed, max_output_units - *output_buffer_index
+			);
+			ptr_read += units_copied * source_unit_size;
+			units_processed += units_copied;
+			*output_buffer_index += units_copied;
+			if (units_processed == string_num_code_units) {
+				break;
+			}
+		}
+
+		// one character, whichever kernel is in use, up to the next ASCII run or until the end
+		unsigned int units_read = 0;
+		unsigned int units_written = 0;
+		uint32_t code_point = 0x00000000;
+		if (selected_kernel == _REENCODER_KERNEL_SUPPLEMENTARY && _reencoder_kernel_decode_supplementary(source_encoding, ptr_read, &code_point, &units_read)) {
+			units_written = _reencoder_kernel_encode_supplementary(target_encoding, *output_buffer, *output_buffer_index, code_point);
+		}
+		else {
+			code_point = _reencoder_kernel_decode(source_encoding, ptr_read, &units_read);
+			units_written = _reencoder_kernel_encode(target_encoding, *output_buffer, *output_buffer_index, code_point);
+		}
+		ptr_read += units_read * source_unit_size;
+		units_processed += units_read;
+		(*output_buffer_index) += units_written;
+		if (*output_buffer_index > max_output_units) {
+			return REENCODER_CONVERT_FAILURE_TOO_LARGE;
+		}
+	}
+
+	// null-terminate output
+	// DO NOT increment output_buffer_index here, it will be used to be count bytes of actual characters only
+	memset((uint8_t*)*output_buffer + (*output_buffer_index * target_unit_size), 0x00, target_unit_size);
+
+	if (kernel != NULL) {
+		*kernel = selected_kernel;
+	}
+
+	return REENCODER_CONVERT_SUCCESS;
+}
+
+unsigned int _reencoder_kernel_has_trivial_path(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, unsigned int char_flags) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	size_t source_unit_size = _reencoder_code_unit_size(source_encoding);
+	size_t target_unit_size = _reencoder_code_unit_size(target_encoding);
+	if (source_unit_size == 0 || target_unit_size == 0 || source_unit_size == target_unit_size) {
+		return 0;
+	}
+
+	// UTF-8 on either side needs Latin-1 (ASCII included), between UTF-16 and UTF-32 it is enough to have no surrogate pairs
+	if (source_encoding == UTF_8 || target_encoding == UTF_8) {
+		return (char_flags & REENCODER_CHARS_LATIN1) != 0;
+	}
+
+	return (char_flags & REENCODER_CHARS_BMP) != 0;
+}
+
+unsigned int _reencoder_kernel_convert_trivial(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, unsigned int char_flags, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer, size_t max_output_bytes) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (source_buffer == NULL || output_buffer_index == NULL || output_buffer_size == NULL || output_buffer == NULL) {
+		return REENCODER_CONVERT_FAILURE_NULL_ARGS;
+	}
+
+	size_t source_unit_size = _reencoder_code_unit_size(source_encoding);
+	size_t target_unit_size = _reencoder_code_unit_size(target_encoding);
+	size_t max_output_units = max_output_bytes == SIZE_MAX ? SIZE_MAX : max_output_bytes / target_unit_size;
+
+	// outside ASCII, Latin-1 takes two bytes in UTF-8 and a single unit anywhere else
+	unsigned int is_latin1_to_utf8 = target_encoding == UTF_8 && !(char_flags & REENCODER_CHARS_ASCII);
+	unsigned int is_latin1_from_utf8 = source_encoding == UTF_8 && !(char_flags & REENCODER_CHARS_ASCII);
+
+	// reserve the worst case once, or up to the cap if that is smaller, plus one character past the cap (at most 2 code units) and the null-terminator
+	size_t reserve_units = string_num_code_units * (is_latin1_to_utf8 ? 2 : 1);
+	if (reserve_units > max_output_units) {
+		reserve_units = max_output_units;
+	}
+	if (_reencoder_context_reserve(output_buffer, output_buffer_size, (*output_buffer_index + reserve_units + 2 + 1) * target_unit_size) == NULL) {
+		return REENCODER_CONVERT_FAILURE_OOM;
+	}
+
+	if (is_latin1_to_utf8) {
+		// 110000xx 10xxxxxx
+		uint8_t* output = (uint8_t*)*output_buffer;
+		for (size_t i = 0; i < string_num_code_units; i++) {
+			uint32_t unit = _reencoder_kernel_load_unit(source_unit_size, source_buffer, i);
+			if (unit < 0x80) {
+				output[(*output_buffer_index)++] = (uint8_t)unit;
+			}
+			else {
+				output[(*output_buffer_index)++] = (uint8_t)(0xC0 | (unit >> 6));
+				output[(*output_buffer_index)++] = (uint8_t)(0x80 | (unit & 0x3F));
+			}
+			if (*output_buffer_index > max_output_units) {
+				return REENCODER_CONVERT_FAILURE_TOO_LARGE;
+			}
+		}
+	}
+	else if (is_latin1_from_utf8) {
+		const uint8_t* source = (const uint8_t*)source_buffer;
+		for (size_t i = 0; i < string_num_code_units;) {
+			uint32_t unit = source[i];
+			if (unit < 0x80) {
+				i++;
+			}
+			else {
+				unit = ((unit & 0x1F) << 6) | (source[i + 1] & 0x3F);
+				i += 2;
+			}
+			_reencoder_kernel_store_unit(target_unit_size, *output_buffer, (*output_buffer_index)++, unit);
+			if (*output_buffer_index > max_output_units) {
+				return REENCODER_CONVERT_FAILURE_TOO_LARGE;
+			}
+		}
+	}
+	else {
+		// one unit in, one unit out, so the cap is checked once up front
+		if (string_num_code_units > max_output_units - *output_buffer_index) {
+			return REENCODER_CONVERT_FAILURE_TOO_LARGE;
+		}
+		_reencoder_kernel_copy_units(
+			source_unit_size, target_unit_size, source_buffer, (uint8_t*)*output_buffer + (*output_buffer_index * target_unit_size), string_num_code_units
+		);
+		*output_buffer_index += string_num_code_units;
+	}
+
+	// null-terminate output
+	// DO NOT increment output_buffer_index here, it will be used to be count bytes of actual characters only
+	memset((uint8_t*)*output_buffer + (*output_buffer_index * target_unit_size), 0x00, target_unit_size);
+
+	return REENCODER_CONVERT_SUCCESS;
+}
+
+static void _reencoder_kernel_sample_window(enum ReencoderEncodeType source_encoding, const void* source_buffer, size_t window_start, size_t window_units, size_t* num_chars, size_t* num_ascii, size_t* num_supplementary) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (source_encoding == UTF_8) {
+		const uint8_t* window = (const uint8_t*)source_buffer + window_start;
+		for (size_t i = 0; i < window_units;) {
+			// continuation bytes have no length of their own, step over them until the next lead byte
+			unsigned int char_len = _reencoder_utf8_determine_length_from_first_byte(window[i]);
+			if (char_len == 0) {
+				i++;
+				continue;
+			}
+
+			(*num_chars)++;
+			(*num_ascii) += char_len == 1;
+			(*num_supplementary) += char_len == 4;
+			i += char_len;
+		}
+	}
+	else if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
+		const uint16_t* window = (const uint16_t*)source_buffer + window_start;
+		for (size_t i = 0; i < window_units; i++) {
+			// a low surrogate was already counted with the high surrogate before it
+			if (window[i] >= 0xDC00 && window[i] <= 0xDFFF) {
+				continue;
+			}
+
+			(*num_chars)++;
+			(*num_ascii) += window[i] < 0x80;
+			(*num_supplementary) += window[i] >= 0xD800 && window[i] <= 0xDBFF;
+		}
+	}
+	else if (source_encoding == UTF_32BE || source_encoding == UTF_32LE) {
+		const uint32_t* window = (const uint32_t*)source_buffer + window_start;
+		for (size_t i = 0; i < window_units; i++) {
+			(*num_chars)++;
+			(*num_ascii) += window[i] < 0x80;
+			(*num_supplementary) += window[i] > 0xFFFF;
+		}
+	}
+}
+
+static size_t _reencoder_kernel_max_units_per_unit(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	size_t source_unit_size = _reencoder_code_unit_size(source_encoding);
+
+	if (target_encoding == UTF_8) {
+		// a BMP character takes at most 3 bytes from 1 UTF-16 unit, anything else at most 1 byte per source byte
+		return source_unit_size == sizeof(uint16_t) ? 3 : source_unit_size;
+	}
+	if (target_encoding == UTF_16BE || target_encoding == UTF_16LE) {
+		// only UTF-32 can turn a single unit into a surrogate pair
+		return source_unit_size == sizeof(uint32_t) ? 2 : 1;
+	}
+
+	return 1;
+}
+
+static size_t _reencoder_kernel_copy_ascii_runs(size_t source_unit_size, size_t target_unit_size, const uint8_t* source, uint8_t* output, size_t units_left, size_t output_units_left) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	size_t units_copied = 0;
+	while (units_left - units_copied >= _REENCODER_KERNEL_ASCII_RUN && output_units_left - units_copied >= _REENCODER_KERNEL_ASCII_RUN) {
+		const uint8_t* run = source + (units_copied * source_unit_size);
+
+		// OR the whole run together through machine words, it is only ASCII if no bit above 0x7F is set in any code unit
+		uint64_t words[_REENCODER_KERNEL_ASCII_RUN * sizeof(uint32_t) / sizeof(uint64_t)];
+		size_t num_words = (_REENCODER_KERNEL_ASCII_RUN * source_unit_size) / sizeof(uint64_t);
+		memcpy(words, run, num_words * sizeof(uint64_t));
+		uint64_t combined = 0;
+		for (size_t i = 0; i < num_words; i++) {
+			combined |= words[i];
+		}
+		if (source_unit_size == sizeof(uint8_t)) {
+			combined &= 0x8080808080808080ULL;
+		}
+		else if (source_unit_size == sizeof(uint16_t)) {
+			combined &= 0xFF80FF80FF80FF80ULL;
+		}
+		else {
+			combined &= 0xFFFFFF80FFFFFF80ULL;
+		}
+		if (combined != 0) {
+			break;
+		}
+
+		// every unit of the run is below 0x80, so it is the same value in any code unit size
+		uint32_t units[_REENCODER_KERNEL_ASCII_RUN];
+		if (source_unit_size == sizeof(uint8_t)) {
+			for (size_t i = 0; i < _REENCODER_KERNEL_ASCII_RUN; i++) {
+				units[i] = run[i];
+			}
+		}
+		else if (source_unit_size == sizeof(uint16_t)) {
+			uint16_t source_units[_REENCODER_KERNEL_ASCII_RUN];
+			memcpy(source_units, run, sizeof(source_units));
+			for (size_t i = 0; i < _REENCODER_KERNEL_ASCII_RUN; i++) {
+				units[i] = source_units[i];
+			}
+		}
+		else {
+			memcpy(units, run, sizeof(units));
+		}
+
+		uint8_t* destination = output + (units_copied * target_unit_size);
+		if (target_unit_size == sizeof(uint8_t)) {
+			for (size_t i = 0; i < _REENCODER_KERNEL_ASCII_RUN; i++) {
+				destination[i] = (uint8_t)units[i];
+			}
+		}
+		else if (target_unit_size == sizeof(uint16_t)) {
+			uint16_t target_units[_REENCODER_KERNEL_ASCII_RUN];
+			for (size_t i = 0; i < _REENCODER_KERNEL_ASCII_RUN; i++) {
+				target_units[i] = (uint16_t)units[i];
+			}
+			memcpy(destination, target_units, sizeof(target_units));
+		}
+		else {
+			memcpy(destination, units, sizeof(units));
+		}
+
+		units_copied += _REENCODER_KERNEL_ASCII_RUN;
+	}
+
+	return units_copied;
+}
+
+static void _reencoder_kernel_copy_units(size_t source_unit_size, size_t target_unit_size, const void* source, void* output, size_t num_units) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// one plain loop per pair of code unit sizes, so that each one can be vectorised
+	if (source_unit_size == sizeof(uint8_t)) {
+		const uint8_t* source_units = (const uint8_t*)source;
+		if (target_unit_size == sizeof(uint16_t)) {
+			uint16_t* output_units = (uint16_t*)output;
+			for (size_t i = 0; i < num_units; i++) {
+				output_units[i] = source_units[i];
+			}
+		}
+		else {
+			uint32_t* output_units = (uint32_t*)output;
+			for (size_t i = 0; i < num_units; i++) {
+				output_units[i] = source_units[i];
+			}
+		}
+	}
+	else if (source_unit_size == sizeof(uint16_t)) {
+		const uint16_t* source_units = (const uint16_t*)source;
+		if (target_unit_size == sizeof(uint8_t)) {
+			uint8_t* output_units = (uint8_t*)output;
+			for (size_t i = 0; i < num_units; i++) {
+				output_units[i] = (uint8_t)source_units[i];
+			}
+		}
+		else {
+			uint32_t* output_units = (uint32_t*)output;
+			for (size_t i = 0; i < num_units; i++) {
+				output_units[i] = source_units[i];
+			}
+		}
+	}
+	else {
+		const uint32_t* source_units = (const uint32_t*)source;
+		if (target_unit_size == sizeof(uint8_t)) {
+			uint8_t* output_units = (uint8_t*)output;
+			for (size_t i = 0; i < num_units; i++) {
+				output_units[i] = (uint8_t)source_units[i];
+			}
+		}
+		else {
+			uint16_t* output_units = (uint16_t*)output;
+			for (size_t i = 0; i < num_units; i++) {
+				output_units[i] = (uint16_t)source_units[i];
+			}
+		}
+	}
+}
+
+static inline uint32_t _reencoder_kernel_load_unit(size_t unit_size, const void* buffer, size_t index) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (unit_size == sizeof(uint8_t)) {
+		return ((const uint8_t*)buffer)[index];
+	}
+	if (unit_size == sizeof(uint16_t)) {
+		return ((const uint16_t*)buffer)[index];
+	}
+
+	return ((const uint32_t*)buffer)[index];
+}
+
+static inline void _reencoder_kernel_store_unit(size_t unit_size, void* buffer, size_t index, uint32_t unit) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (unit_size == sizeof(uint8_t)) {
+		((uint8_t*)buffer)[index] = (uint8_t)unit;
+	}
+	else if (unit_size == sizeof(uint16_t)) {
+		((uint16_t*)buffer)[index] = (uint16_t)unit;
+	}
+	else {
+		((uint32_t*)buffer)[index] = unit;
+	}
+}
+
+static inline uint32_t _reencoder_kernel_decode(enum ReencoderEncodeType source_encoding, const uint8_t* ptr, unsigned int* units_read) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (source_encoding == UTF_8) {
+		return _reencoder_utf8_decode_to_code_point(ptr, units_read);
+	}
+	if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
+		return _reencoder_utf16_decode_to_code_point((const uint16_t*)ptr, units_read);
+	}
+
+	return _reencoder_utf32_decode_to_code_point((const uint32_t*)ptr, units_read);
+}
+
+static inline unsigned int _reencoder_kernel_encode(enum ReencoderEncodeType target_encoding, void* output_buffer, size_t index, uint32_t code_point) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (target_encoding == UTF_8) {
+		return _reencoder_utf8_encode_from_code_point((uint8_t*)output_buffer, index, code_point);
+	}
+	if (target_encoding == UTF_16BE || target_encoding == UTF_16LE) {
+		return _reencoder_utf16_encode_from_code_point((uint16_t*)output_buffer, index, code_point);
+	}
+
+	return _reencoder_utf32_encode_from_code_point((uint32_t*)output_buffer, index, code_point);
+}
+
+static inline unsigned int _reencoder_kernel_decode_supplementary(enum ReencoderEncodeType source_encoding, const uint8_t* ptr, uint32_t* code_point, unsigned int* units_read) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (source_encoding == UTF_8) {
+		// 11110uvv 10vvwwww 10xxxxyy 10yyzzzz
+		if (ptr[0] < 0xF0) {
+			return 0;
+		}
+		*code_point = ((uint32_t)(ptr[0] & 0x07) << 18) | ((uint32_t)(ptr[1] & 0x3F) << 12) | ((uint32_t)(ptr[2] & 0x3F) << 6) | (uint32_t)(ptr[3] & 0x3F);
+		*units_read = 4;
+		return 1;
+	}
+	if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
+		// high surrogate, always followed by a low surrogate in well-formed input
+		const uint16_t* units = (const uint16_t*)ptr;
+		if (units[0] < 0xD800 || units[0] > 0xDBFF) {
+			return 0;
+		}
+		*code_point = 0x10000 + (((uint32_t)(units[0] - 0xD800) << 10) | (uint32_t)(units[1] - 0xDC00));
+		*units_read = 2;
+		return 1;
+	}
+
+	const uint32_t* units = (const uint32_t*)ptr;
+	if (units[0] <= 0xFFFF) {
+		return 0;
+	}
+	*code_point = units[0];
+	*units_read = 1;
+	return 1;
+}
+
+static inline unsigned int _reencoder_kernel_encode_supplementary(enum ReencoderEncodeType target_encoding, void* output_buffer, size_t index, uint32_t code_point) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (target_encoding == UTF_8) {
+		uint8_t* output = (uint8_t*)output_buffer + index;
+		output[0] = (uint8_t)(0xF0 | (code_point >> 18));
+		output[1] = (uint8_t)(0x80 | ((code_point >> 12) & 0x3F));
+		output[2] = (uint8_t)(0x80 | ((code_point >> 6) & 0x3F));
+		output[3] = (uint8_t)(0x80 | (code_point & 0x3F));
+		return 4;
+	}
+	if (target_encoding == UTF_16BE || target_encoding == UTF_16LE) {
+		uint16_t* output = (uint16_t*)output_buffer + index;
+		code_point -= 0x10000;
+		output[0] = (uint16_t)(0xD800 | (code_point >> 10));
+		output[1] = (uint16_t)(0xDC00 | (code_point & 0x3FF));
+		return 2;
+	}
+
+	((uint32_t*)output_buffer)[index] = code_point;
+	return 1;
+}
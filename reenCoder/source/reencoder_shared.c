@@ -0,0 +1,78 @@
+#include "../headers/reencoder_shared.h"
+
+_ReencoderSharedBuffer* _reencoder_shared_buffer_create(uint8_t* buffer, long refcount) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	_ReencoderSharedBuffer* shared_buffer = (_ReencoderSharedBuffer*)malloc(sizeof(_ReencoderSharedBuffer));
+	if (shared_buffer == NULL) {
+		return NULL;
+	}
+
+	shared_buffer->refcount = refcount;
+	shared_buffer->buffer = buffer;
+
+	return shared_buffer;
+}
+
+void _reencoder_shared_buffer_retain(_ReencoderSharedBuffer* shared_buffer) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	_reencoder_atomic_increment(&shared_buffer->refcount);
+}
+
+unsigned int _reencoder_shared_buffer_release(_ReencoderSharedBuffer* shared_buffer) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (_reencoder_atomic_decrement(&shared_buffer->refcount) != 0) {
+		return 0;
+	}
+
+	free(shared_buffer->buffer);
+	free(shared_buffer);
+
+	return 1;
+}
+
+long _reencoder_shared_buffer_refcount(_ReencoderSharedBuffer* shared_buffer) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	return _reencoder_atomic_load(&shared_buffer->refcount);
+}
+
+long _reencoder_atomic_increment(volatile long* value) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	return _InterlockedIncrement(value);
+#else
+	return __atomic_add_fetch(value, 1, __ATOMIC_ACQ_REL);
+#endif
+}
+
+long _reencoder_atomic_decrement(volatile long* value) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	return _InterlockedDecrement(value);
+#else
+	return __atomic_sub_fetch(value, 1, __ATOMIC_ACQ_REL);
+#endif
+}
+
+long _reencoder_atomic_load(volatile long* value) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	// adding 0 doubles as a full-barrier read
+	return _InterlockedExchangeAdd(value, 0);
+#else
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif
+}
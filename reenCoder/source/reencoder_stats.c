@@ -0,0 +1,762 @@
+#include "../headers/reencoder_stats.h"
+
+static const char* _REENCODER_STATS_ENCODING_NAMES[REENCODER_STATS_NUM_ENCODINGS] = { "UTF-8", "UTF-16BE", "UTF-16LE", "UTF-32BE", "UTF-32LE" };
+static const char* _REENCODER_STATS_TIER_NAMES[REENCODER_STATS_NUM_TIERS] = { "scalar", "word", "copy", "ascii", "supplementary" };
+static const char* _REENCODER_STATS_CALL_NAMES[REENCODER_STATS_NUM_CALLS] = { "parse", "convert", "repair", "write" };
+
+/**
+ * @brief Writes counters in the Prometheus text exposition format. See `reencoder_stats_dump()`.
+ */
+static void _reencoder_stats_dump_text(const ReencoderStats* stats, FILE* fp_write);
+
+/**
+ * @brief Writes counters as a single JSON object. See `reencoder_stats_dump()`.
+ */
+static void _reencoder_stats_dump_json(const ReencoderStats* stats, FILE* fp_write);
+
+/**
+ * @brief Writes one histogram as cumulative Prometheus buckets, followed by its sum and count.
+ */
+static void _reencoder_stats_dump_text_histogram(FILE* fp_write, const char* metric, const char* call, const uint64_t* histogram, uint64_t sum, uint64_t count);
+
+/**
+ * @brief Writes the non-empty buckets of one histogram as a JSON object, keyed by their lower bound.
+ */
+static void _reencoder_stats_dump_json_histogram(FILE* fp_write, const uint64_t* histogram);
+
+#if defined(REENCODER_ENABLE_STATS)
+/**
+ * @brief Counters of the calling thread, NULL until it first counts something.
+ */
+static _REENCODER_STATS_THREAD_LOCAL _ReencoderStatsBlock* _reencoder_stats_thread_block = NULL;
+
+/**
+ * @brief Head of the list of every thread's counters. Blocks are only ever pushed to the front.
+ */
+static _ReencoderStatsBlock* volatile _reencoder_stats_blocks = NULL;
+
+/**
+ * @brief Current reset generation, incremented by every `reencoder_stats_reset()`.
+ */
+static volatile long _reencoder_stats_generation = 0;
+
+/**
+ * @brief Thread-exit hook that frees the block of the exiting thread, created once by the first thread to count something.
+ */
+#if defined(_WIN32)
+static INIT_ONCE _reencoder_stats_exit_hook_once = INIT_ONCE_STATIC_INIT;
+static DWORD _reencoder_stats_exit_hook = FLS_OUT_OF_INDEXES;
+#else
+static pthread_once_t _reencoder_stats_exit_hook_once = PTHREAD_ONCE_INIT;
+static pthread_key_t _reencoder_stats_exit_hook;
+static unsigned int _reencoder_stats_has_exit_hook = 0;
+#endif
+
+/**
+ * @brief Number of public entry points the calling thread is currently inside of.
+ */
+static _REENCODER_STATS_THREAD_LOCAL unsigned int _reencoder_stats_call_depth = 0;
+
+/**
+ * @brief Start time of the outermost call in progress on the calling thread, in nanoseconds.
+ */
+static _REENCODER_STATS_THREAD_LOCAL uint64_t _reencoder_stats_call_start_ns = 0;
+
+/**
+ * @brief Input size of the outermost call in progress on the calling thread, valid once _reencoder_stats_call_has_input is set.
+ */
+static _REENCODER_STATS_THREAD_LOCAL uint64_t _reencoder_stats_call_input_bytes = 0;
+static _REENCODER_STATS_THREAD_LOCAL unsigned int _reencoder_stats_call_has_input = 0;
+
+/**
+ * @brief Reads a clock with nanosecond resolution, the performance counter on Windows and the ISO C timespec_get() elsewhere.
+ *
+ * timespec_get() reads the wall clock, which may be stepped backwards, so latencies computed from it are clamped at 0.
+ *
+ * @return Current time in nanoseconds, from an arbitrary starting point.
+ */
+static uint64_t _reencoder_stats_now_ns(void);
+
+/**
+ * @brief Loads a counter that may be written by another thread.
+ */
+static inline uint64_t _reencoder_stats_load(const uint64_t* counter);
+
+/**
+ * @brief Stores to a counter of the calling thread, so that other threads never read a torn value.
+ */
+static inline void _reencoder_stats_store(uint64_t* counter, uint64_t value);
+
+/**
+ * @brief Loads a reset generation, either the current one or the one a block was counted in.
+ */
+static inline long _reencoder_stats_load_generation(const volatile long* generation);
+
+/**
+ * @brief Stores the reset generation a block of the calling thread is counted in.
+ */
+static inline void _reencoder_stats_store_generation(volatile long* generation, long value);
+
+/**
+ * @brief Loads the head of the list of every thread's counters.
+ */
+static inline _ReencoderStatsBlock* _reencoder_stats_load_blocks(void);
+
+/**
+ * @brief Pushes a block to the front of the list of every thread's counters.
+ */
+static void _reencoder_stats_push_block(_ReencoderStatsBlock* block);
+
+/**
+ * @brief Claims the block of a thread that has exited, keeping the counts in it.
+ *
+ * @return Pointer to the claimed block.
+ * @retval NULL If every block is in use.
+ */
+static _ReencoderStatsBlock* _reencoder_stats_claim_block(void);
+
+/**
+ * @brief Registers the block of the calling thread to be freed when the thread exits. If the hook could not be created, the block is never freed.
+ */
+static void _reencoder_stats_register_exit(_ReencoderStatsBlock* block);
+
+/**
+ * @brief Creates the thread-exit hook, runs once.
+ */
+#if defined(_WIN32)
+static BOOL CALLBACK _reencoder_stats_create_exit_hook(PINIT_ONCE once, PVOID parameter, PVOID* context);
+#else
+static void _reencoder_stats_create_exit_hook(void);
+#endif
+
+/**
+ * @brief Runs on the exiting thread, marks its block free so that the next thread to count something can claim it.
+ */
+#if defined(_WIN32)
+static VOID WINAPI _reencoder_stats_thread_exit(PVOID block);
+#else
+static void _reencoder_stats_thread_exit(void* block);
+#endif
+#endif
+
+unsigned int reencoder_stats_get(ReencoderStats* stats) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (stats == NULL) {
+		return 0;
+	}
+
+	memset(stats, 0x00, sizeof(ReencoderStats));
+
+#if defined(REENCODER_ENABLE_STATS)
+	long generation = _reencoder_stats_load_generation(&_reencoder_stats_generation);
+
+	// every member is a uint64_t, so blocks are summed as flat arrays, except for the peak which is a maximum
+	size_t peak_index = offsetof(ReencoderStats, peak_buffer_bytes) / sizeof(uint64_t);
+	uint64_t* totals = (uint64_t*)stats;
+	for (_ReencoderStatsBlock* block = _reencoder_stats_load_blocks(); block != NULL; block = block->next) {
+		// a thread that has not counted anything since the last reset still holds counts from before it
+		if (_reencoder_stats_load_generation(&block->generation) != generation) {
+			continue;
+		}
+
+		uint64_t* counters = (uint64_t*)&block->stats;
+		for (size_t i = 0; i < sizeof(ReencoderStats) / sizeof(uint64_t); i++) {
+			uint64_t value = _reencoder_stats_load(&counters[i]);
+			if (i == peak_index) {
+				totals[i] = value > totals[i] ? value : totals[i];
+			}
+			else {
+				totals[i] += value;
+			}
+		}
+	}
+
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+void reencoder_stats_reset(void) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+#if defined(REENCODER_ENABLE_STATS)
+#if defined(_WIN32)
+	_InterlockedIncrement(&_reencoder_stats_generation);
+#else
+	__atomic_add_fetch(&_reencoder_stats_generation, 1, __ATOMIC_ACQ_REL);
+#endif
+#endif
+}
+
+size_t reencoder_stats_bucket_index(uint64_t value) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (value < (1u << REENCODER_STATS_SUB_BUCKET_BITS)) {
+		return (size_t)value;
+	}
+
+	// index of the highest set bit, found by halving the search range, so it needs no compiler intrinsics
+	unsigned int msb = 0;
+	for (unsigned int shift = 32; shift != 0; shift >>= 1) {
+		if ((value >> (msb + shift)) != 0) {
+			msb += shift;
+		}
+	}
+
+	// the bits right below the highest one pick the sub-bucket
+	size_t sub_bucket = (size_t)((value >> (msb - REENCODER_STATS_SUB_BUCKET_BITS)) & ((1u << REENCODER_STATS_SUB_BUCKET_BITS) - 1));
+
+	return ((size_t)(msb - REENCODER_STATS_SUB_BUCKET_BITS + 1) << REENCODER_STATS_SUB_BUCKET_BITS) + sub_bucket;
+}
+
+uint64_t reencoder_stats_bucket_lower_bound(size_t bucket) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (bucket < (1u << REENCODER_STATS_SUB_BUCKET_BITS)) {
+		return (uint64_t)bucket;
+	}
+	if (bucket >= REENCODER_STATS_NUM_BUCKETS) {
+		return UINT64_MAX;
+	}
+
+	size_t power = bucket >> REENCODER_STATS_SUB_BUCKET_BITS;
+	uint64_t sub_bucket = (uint64_t)(bucket & ((1u << REENCODER_STATS_SUB_BUCKET_BITS) - 1));
+
+	return (((uint64_t)1 << REENCODER_STATS_SUB_BUCKET_BITS) | sub_bucket) << (power - 1);
+}
+
+uint64_t reencoder_stats_percentile(const uint64_t* histogram, double percentile) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (histogram == NULL) {
+		return 0;
+	}
+
+	uint64_t total = 0;
+	for (size_t i = 0; i < REENCODER_STATS_NUM_BUCKETS; i++) {
+		total += histogram[i];
+	}
+	if (total == 0) {
+		return 0;
+	}
+
+	// rank of the percentile among all counted values (rounded up), the 0th percentile being the smallest
+	double rank = percentile > 0.0 ? (percentile / 100.0) * (double)total : 0.0;
+	uint64_t target = total;
+	if (rank < (double)total) {
+		target = (uint64_t)rank;
+		if ((double)target < rank) {
+			target++;
+		}
+	}
+	if (target == 0) {
+		target = 1;
+	}
+
+	uint64_t seen = 0;
+	for (size_t i = 0; i < REENCODER_STATS_NUM_BUCKETS; i++) {
+		seen += histogram[i];
+		if (seen >= target) {
+			return i + 1 < REENCODER_STATS_NUM_BUCKETS ? reencoder_stats_bucket_lower_bound(i + 1) - 1 : UINT64_MAX;
+		}
+	}
+
+	return UINT64_MAX;
+}
+
+unsigned int reencoder_stats_dump(const ReencoderStats* stats, FILE* fp_write, unsigned int format) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (stats == NULL || fp_write == NULL || (format != REENCODER_STATS_DUMP_TEXT && format != REENCODER_STATS_DUMP_JSON)) {
+		return 0;
+	}
+
+	if (format == REENCODER_STATS_DUMP_TEXT) {
+		_reencoder_stats_dump_text(stats, fp_write);
+	}
+	else {
+		_reencoder_stats_dump_json(stats, fp_write);
+	}
+
+	return ferror(fp_write) ? 0 : 1;
+}
+
+ReencoderStats* _reencoder_stats_local(void) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(REENCODER_ENABLE_STATS)
+	_ReencoderStatsBlock* block = _reencoder_stats_thread_block;
+	long generation = _reencoder_stats_load_generation(&_reencoder_stats_generation);
+
+	if (block == NULL) {
+		// take over the block of an exited thread before growing the list
+		block = _reencoder_stats_claim_block();
+		if (block == NULL) {
+			block = (_ReencoderStatsBlock*)calloc(1, sizeof(_ReencoderStatsBlock));
+			if (block == NULL) {
+				return NULL;
+			}
+
+			block->generation = generation;
+			_reencoder_stats_push_block(block);
+		}
+
+		_reencoder_stats_thread_block = block;
+		_reencoder_stats_register_exit(block);
+	}
+
+	if (block->generation != generation) {
+		// a reset happened since this thread last counted, so start over before counting again
+		uint64_t* counters = (uint64_t*)&block->stats;
+		for (size_t i = 0; i < sizeof(ReencoderStats) / sizeof(uint64_t); i++) {
+			_reencoder_stats_store(&counters[i], 0);
+		}
+		_reencoder_stats_store_generation(&block->generation, generation);
+	}
+
+	return &block->stats;
+#else
+	return NULL;
+#endif
+}
+
+void _reencoder_stats_add(uint64_t* counter, uint64_t amount) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(REENCODER_ENABLE_STATS)
+	_reencoder_stats_store(counter, _reencoder_stats_load(counter) + amount);
+#else
+	(void)counter;
+	(void)amount;
+#endif
+}
+
+void _reencoder_stats_count_outcome(unsigned int outcome) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(REENCODER_ENABLE_STATS)
+	// outcome families start at 800 (UTF-8), 1600 (UTF-16) and 3200 (UTF-32), the first two of each are the valid and repaired outcomes
+	size_t family = outcome >= 3200 ? 2 : (outcome >= 1600 ? 1 : 0);
+	size_t index = outcome - (800u << family);
+	if (outcome < 800 || index < 2 || index >= REENCODER_STATS_NUM_OUTCOMES) {
+		return;
+	}
+
+	ReencoderStats* stats = _reencoder_stats_local();
+	if (stats != NULL) {
+		_reencoder_stats_add(&stats->malformed_inputs[family][index], 1);
+	}
+#else
+	(void)outcome;
+#endif
+}
+
+void _reencoder_stats_count_grow(size_t buffer_bytes) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(REENCODER_ENABLE_STATS)
+	ReencoderStats* stats = _reencoder_stats_local();
+	if (stats == NULL) {
+		return;
+	}
+
+	_reencoder_stats_add(&stats->buffer_grows, 1);
+	if ((uint64_t)buffer_bytes > _reencoder_stats_load(&stats->peak_buffer_bytes)) {
+		_reencoder_stats_store(&stats->peak_buffer_bytes, (uint64_t)buffer_bytes);
+	}
+#else
+	(void)buffer_bytes;
+#endif
+}
+
+size_t _reencoder_stats_num_blocks(void) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	size_t num_blocks = 0;
+#if defined(REENCODER_ENABLE_STATS)
+	for (_ReencoderStatsBlock* block = _reencoder_stats_load_blocks(); block != NULL; block = block->next) {
+		num_blocks++;
+	}
+#endif
+
+	return num_blocks;
+}
+
+void _reencoder_stats_call_begin(void) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(REENCODER_ENABLE_STATS)
+	if (_reencoder_stats_call_depth++ == 0) {
+		_reencoder_stats_call_has_input = 0;
+		_reencoder_stats_call_start_ns = _reencoder_stats_now_ns();
+	}
+#endif
+}
+
+void _reencoder_stats_call_input(size_t input_bytes) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(REENCODER_ENABLE_STATS)
+	if (_reencoder_stats_call_depth != 0 && !_reencoder_stats_call_has_input) {
+		_reencoder_stats_call_input_bytes = (uint64_t)input_bytes;
+		_reencoder_stats_call_has_input = 1;
+	}
+#else
+	(void)input_bytes;
+#endif
+}
+
+void _reencoder_stats_call_end(unsigned int call) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(REENCODER_ENABLE_STATS)
+	if (_reencoder_stats_call_depth == 0 || --_reencoder_stats_call_depth != 0 || call >= REENCODER_STATS_NUM_CALLS) {
+		return;
+	}
+
+	uint64_t now_ns = _reencoder_stats_now_ns();
+	// the clock may have been stepped backwards during the call
+	uint64_t latency_ns = now_ns > _reencoder_stats_call_start_ns ? now_ns - _reencoder_stats_call_start_ns : 0;
+	uint64_t input_bytes = _reencoder_stats_call_has_input ? _reencoder_stats_call_input_bytes : 0;
+
+	ReencoderStats* stats = _reencoder_stats_local();
+	if (stats == NULL) {
+		return;
+	}
+
+	_reencoder_stats_add(&stats->call_count[call], 1);
+	_reencoder_stats_add(&stats->call_latency_sum_ns[call], latency_ns);
+	_reencoder_stats_add(&stats->call_input_bytes_sum[call], input_bytes);
+	_reencoder_stats_add(&stats->call_latency_ns[call][reencoder_stats_bucket_index(latency_ns)], 1);
+	_reencoder_stats_add(&stats->call_input_bytes[call][reencoder_stats_bucket_index(input_bytes)], 1);
+#else
+	(void)call;
+#endif
+}
+
+static void _reencoder_stats_dump_text(const ReencoderStats* stats, FILE* fp_write) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	fprintf(fp_write, "# TYPE reencoder_bytes_validated_total counter\n");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_ENCODINGS; i++) {
+		fprintf(fp_write, "reencoder_bytes_validated_total{encoding=\"%s\"} %llu\n", _REENCODER_STATS_ENCODING_NAMES[i], (unsigned long long)stats->bytes_validated[i]);
+	}
+
+	fprintf(fp_write, "# TYPE reencoder_bytes_converted_total counter\n");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_ENCODINGS; i++) {
+		for (size_t j = 0; j < REENCODER_STATS_NUM_ENCODINGS; j++) {
+			fprintf(fp_write, "reencoder_bytes_converted_total{source=\"%s\",target=\"%s\"} %llu\n",
+				_REENCODER_STATS_ENCODING_NAMES[i], _REENCODER_STATS_ENCODING_NAMES[j], (unsigned long long)stats->bytes_converted[i][j]);
+		}
+	}
+
+	fprintf(fp_write, "# TYPE reencoder_replacements_inserted_total counter\n");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_ENCODINGS; i++) {
+		fprintf(fp_write, "reencoder_replacements_inserted_total{encoding=\"%s\"} %llu\n", _REENCODER_STATS_ENCODING_NAMES[i], (unsigned long long)stats->replacements_inserted[i]);
+	}
+
+	// outcomes are labelled with their numeric value, the first two of each family are never malformed
+	fprintf(fp_write, "# TYPE reencoder_malformed_inputs_total counter\n");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_FAMILIES; i++) {
+		for (size_t j = 2; j < REENCODER_STATS_NUM_OUTCOMES; j++) {
+			if (stats->malformed_inputs[i][j] != 0) {
+				fprintf(fp_write, "reencoder_malformed_inputs_total{outcome=\"%u\"} %llu\n", (800u << i) + (unsigned int)j, (unsigned long long)stats->malformed_inputs[i][j]);
+			}
+		}
+	}
+
+	fprintf(fp_write, "# TYPE reencoder_buffer_grows_total counter\n");
+	fprintf(fp_write, "reencoder_buffer_grows_total %llu\n", (unsigned long long)stats->buffer_grows);
+	fprintf(fp_write, "# TYPE reencoder_peak_buffer_bytes gauge\n");
+	fprintf(fp_write, "reencoder_peak_buffer_bytes %llu\n", (unsigned long long)stats->peak_buffer_bytes);
+
+	fprintf(fp_write, "# TYPE reencoder_tier_calls_total counter\n");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_TIERS; i++) {
+		fprintf(fp_write, "reencoder_tier_calls_total{tier=\"%s\"} %llu\n", _REENCODER_STATS_TIER_NAMES[i], (unsigned long long)stats->tier_calls[i]);
+	}
+
+	fprintf(fp_write, "# TYPE reencoder_call_latency_ns histogram\n");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_CALLS; i++) {
+		_reencoder_stats_dump_text_histogram(
+			fp_write, "reencoder_call_latency_ns", _REENCODER_STATS_CALL_NAMES[i], stats->call_latency_ns[i], stats->call_latency_sum_ns[i], stats->call_count[i]
+		);
+	}
+
+	fprintf(fp_write, "# TYPE reencoder_call_input_bytes histogram\n");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_CALLS; i++) {
+		_reencoder_stats_dump_text_histogram(
+			fp_write, "reencoder_call_input_bytes", _REENCODER_STATS_CALL_NAMES[i], stats->call_input_bytes[i], stats->call_input_bytes_sum[i], stats->call_count[i]
+		);
+	}
+}
+
+static void _reencoder_stats_dump_json(const ReencoderStats* stats, FILE* fp_write) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	fprintf(fp_write, "{\"bytes_validated\":{");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_ENCODINGS; i++) {
+		fprintf(fp_write, "%s\"%s\":%llu", i == 0 ? "" : ",", _REENCODER_STATS_ENCODING_NAMES[i], (unsigned long long)stats->bytes_validated[i]);
+	}
+
+	fprintf(fp_write, "},\"bytes_converted\":{");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_ENCODINGS; i++) {
+		fprintf(fp_write, "%s\"%s\":{", i == 0 ? "" : ",", _REENCODER_STATS_ENCODING_NAMES[i]);
+		for (size_t j = 0; j < REENCODER_STATS_NUM_ENCODINGS; j++) {
+			fprintf(fp_write, "%s\"%s\":%llu", j == 0 ? "" : ",", _REENCODER_STATS_ENCODING_NAMES[j], (unsigned long long)stats->bytes_converted[i][j]);
+		}
+		fprintf(fp_write, "}");
+	}
+
+	fprintf(fp_write, "},\"replacements_inserted\":{");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_ENCODINGS; i++) {
+		fprintf(fp_write, "%s\"%s\":%llu", i == 0 ? "" : ",", _REENCODER_STATS_ENCODING_NAMES[i], (unsigned long long)stats->replacements_inserted[i]);
+	}
+
+	fprintf(fp_write, "},\"malformed_inputs\":{");
+	unsigned int first = 1;
+	for (size_t i = 0; i < REENCODER_STATS_NUM_FAMILIES; i++) {
+		for (size_t j = 2; j < REENCODER_STATS_NUM_OUTCOMES; j++) {
+			if (stats->malformed_inputs[i][j] != 0) {
+				fprintf(fp_write, "%s\"%u\":%llu", first ? "" : ",", (800u << i) + (unsigned int)j, (unsigned long long)stats->malformed_inputs[i][j]);
+				first = 0;
+			}
+		}
+	}
+
+	fprintf(fp_write, "},\"buffer_grows\":%llu,\"peak_buffer_bytes\":%llu,\"tier_calls\":{", (unsigned long long)stats->buffer_grows, (unsigned long long)stats->peak_buffer_bytes);
+	for (size_t i = 0; i < REENCODER_STATS_NUM_TIERS; i++) {
+		fprintf(fp_write, "%s\"%s\":%llu", i == 0 ? "" : ",", _REENCODER_STATS_TIER_NAMES[i], (unsigned long long)stats->tier_calls[i]);
+	}
+
+	fprintf(fp_write, "},\"calls\":{");
+	for (size_t i = 0; i < REENCODER_STATS_NUM_CALLS; i++) {
+		fprintf(fp_write, "%s\"%s\":{\"count\":%llu,\"latency_sum_ns\":%llu,\"input_bytes_sum\":%llu,\"latency_ns\":",
+			i == 0 ? "" : ",", _REENCODER_STATS_CALL_NAMES[i],
+			(unsigned long long)stats->call_count[i], (unsigned long long)stats->call_latency_sum_ns[i], (unsigned long long)stats->call_input_bytes_sum[i]);
+		_reencoder_stats_dump_json_histogram(fp_write, stats->call_latency_ns[i]);
+		fprintf(fp_write, ",\"input_bytes\":");
+		_reencoder_stats_dump_json_histogram(fp_write, stats->call_input_bytes[i]);
+		fprintf(fp_write, "}");
+	}
+	fprintf(fp_write, "}}\n");
+}
+
+static void _reencoder_stats_dump_text_histogram(FILE* fp_write, const char* metric, const char* call, const uint64_t* histogram, uint64_t sum, uint64_t count) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// Prometheus buckets count every value up to and including their bound, so each non-empty bucket is written with its largest value
+	uint64_t cumulative = 0;
+	for (size_t i = 0; i + 1 < REENCODER_STATS_NUM_BUCKETS; i++) {
+		if (histogram[i] == 0) {
+			continue;
+		}
+		cumulative += histogram[i];
+		fprintf(fp_write, "%s_bucket{call=\"%s\",le=\"%llu\"} %llu\n", metric, call, (unsigned long long)(reencoder_stats_bucket_lower_bound(i + 1) - 1), (unsigned long long)cumulative);
+	}
+	fprintf(fp_write, "%s_bucket{call=\"%s\",le=\"+Inf\"} %llu\n", metric, call, (unsigned long long)count);
+	fprintf(fp_write, "%s_sum{call=\"%s\"} %llu\n", metric, call, (unsigned long long)sum);
+	fprintf(fp_write, "%s_count{call=\"%s\"} %llu\n", metric, call, (unsigned long long)count);
+}
+
+static void _reencoder_stats_dump_json_histogram(FILE* fp_write, const uint64_t* histogram) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	fprintf(fp_write, "{");
+	unsigned int first = 1;
+	for (size_t i = 0; i < REENCODER_STATS_NUM_BUCKETS; i++) {
+		if (histogram[i] != 0) {
+			fprintf(fp_write, "%s\"%llu\":%llu", first ? "" : ",", (unsigned long long)reencoder_stats_bucket_lower_bound(i), (unsigned long long)histogram[i]);
+			first = 0;
+		}
+	}
+	fprintf(fp_write, "}");
+}
+
+#if defined(REENCODER_ENABLE_STATS)
+static uint64_t _reencoder_stats_now_ns(void) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+
+	// split into whole seconds and the remainder, so that the multiplication cannot overflow
+	uint64_t seconds = (uint64_t)(counter.QuadPart / frequency.QuadPart);
+	uint64_t remainder = (uint64_t)(counter.QuadPart % frequency.QuadPart);
+	return (seconds * 1000000000ULL) + ((remainder * 1000000000ULL) / (uint64_t)frequency.QuadPart);
+#else
+	struct timespec now;
+	if (timespec_get(&now, TIME_UTC) != TIME_UTC) {
+		return 0;
+	}
+	return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+#endif
+}
+
+static inline uint64_t _reencoder_stats_load(const uint64_t* counter) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	return *(const volatile uint64_t*)counter;
+#else
+	return __atomic_load_n(counter, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline void _reencoder_stats_store(uint64_t* counter, uint64_t value) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	*(volatile uint64_t*)counter = value;
+#else
+	__atomic_store_n(counter, value, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline long _reencoder_stats_load_generation(const volatile long* generation) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	return *generation;
+#else
+	return __atomic_load_n(generation, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void _reencoder_stats_store_generation(volatile long* generation, long value) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	*generation = value;
+#else
+	__atomic_store_n(generation, value, __ATOMIC_RELEASE);
+#endif
+}
+
+static inline _ReencoderStatsBlock* _reencoder_stats_load_blocks(void) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	return _reencoder_stats_blocks;
+#else
+	return __atomic_load_n(&_reencoder_stats_blocks, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static void _reencoder_stats_push_block(_ReencoderStatsBlock* block) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	_ReencoderStatsBlock* head = _reencoder_stats_blocks;
+	do {
+		block->next = head;
+#if defined(_WIN32)
+	} while ((head = (_ReencoderStatsBlock*)_InterlockedCompareExchangePointer((void* volatile*)&_reencoder_stats_blocks, block, block->next)) != block->next);
+#else
+	} while (!__atomic_compare_exchange_n(&_reencoder_stats_blocks, &head, block, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+#endif
+}
+
+static _ReencoderStatsBlock* _reencoder_stats_claim_block(void) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	for (_ReencoderStatsBlock* block = _reencoder_stats_load_blocks(); block != NULL; block = block->next) {
+		// several threads may start at once, only the one that flips is_free back gets the block
+#if defined(_WIN32)
+		if (block->is_free && _InterlockedCompareExchange(&block->is_free, 0, 1) == 1) {
+			return block;
+		}
+#else
+		long is_free = 1;
+		if (__atomic_load_n(&block->is_free, __ATOMIC_RELAXED) && __atomic_compare_exchange_n(&block->is_free, &is_free, 0, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+			return block;
+		}
+#endif
+	}
+
+	return NULL;
+}
+
+static void _reencoder_stats_register_exit(_ReencoderStatsBlock* block) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	if (InitOnceExecuteOnce(&_reencoder_stats_exit_hook_once, _reencoder_stats_create_exit_hook, NULL, NULL) && _reencoder_stats_exit_hook != FLS_OUT_OF_INDEXES) {
+		FlsSetValue(_reencoder_stats_exit_hook, block);
+	}
+#else
+	if (pthread_once(&_reencoder_stats_exit_hook_once, _reencoder_stats_create_exit_hook) == 0 && _reencoder_stats_has_exit_hook) {
+		pthread_setspecific(_reencoder_stats_exit_hook, block);
+	}
+#endif
+}
+
+#if defined(_WIN32)
+static BOOL CALLBACK _reencoder_stats_create_exit_hook(PINIT_ONCE once, PVOID parameter, PVOID* context) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	(void)once;
+	(void)parameter;
+	(void)context;
+
+	_reencoder_stats_exit_hook = FlsAlloc(_reencoder_stats_thread_exit);
+	return TRUE;
+}
+
+static VOID WINAPI _reencoder_stats_thread_exit(PVOID block) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// anything counted after this point (by other exit callbacks) claims a block again
+	_reencoder_stats_thread_block = NULL;
+	_InterlockedExchange(&((_ReencoderStatsBlock*)block)->is_free, 1);
+}
+#else
+static void _reencoder_stats_create_exit_hook(void) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	_reencoder_stats_has_exit_hook = pthread_key_create(&_reencoder_stats_exit_hook, _reencoder_stats_thread_exit) == 0;
+}
+
+static void _reencoder_stats_thread_exit(void* block) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// anything counted after this point (by other key destructors) claims a block again
+	_reencoder_stats_thread_block = NULL;
+	__atomic_store_n(&((_ReencoderStatsBlock*)block)->is_free, 1, __ATOMIC_RELEASE);
+}
+#endif
+#endif
@@ -0,0 +1,528 @@
+#include "../headers/reencoder_thread_pool.h"
+
+/**
+ * @brief Runs tasks until neither the worker's own deque nor any other deque has tasks left.
+ *
+ * @param[in] pool Pointer to the `ReencoderThreadPool` being run.
+ * @param[in] worker_index Index of the worker running the tasks.
+ *
+ * @return void
+ */
+static void _reencoder_thread_pool_work(ReencoderThreadPool* pool, size_t worker_index);
+
+/**
+ * @brief Takes the task at the bottom of a worker's own deque.
+ *
+ * @param[in] deque Pointer to the deque of the worker.
+ * @param[out] task_index Pointer to where the task index will be stored.
+ *
+ * @return 1 if a task was taken, 0 if the deque is empty.
+ */
+static unsigned int _reencoder_task_deque_pop(_ReencoderTaskDeque* deque, size_t* task_index);
+
+/**
+ * @brief Takes the task at the top of another worker's deque.
+ *
+ * @param[in] deque Pointer to the deque to steal from.
+ * @param[out] task_index Pointer to where the task index will be stored.
+ *
+ * @return 1 if a task was taken, 0 if the deque is empty.
+ */
+static unsigned int _reencoder_task_deque_steal(_ReencoderTaskDeque* deque, size_t* task_index);
+
+/**
+ * @brief Main loop of a background worker thread. Waits for a run, works on it, and reports back until the pool shuts down.
+ *
+ * @param[in] worker Pointer to the `_ReencoderWorker` of the thread.
+ *
+ * @return void
+ */
+static void _reencoder_thread_pool_worker_loop(_ReencoderWorker* worker);
+
+/**
+ * @brief Platform entry point of a background worker thread, forwards to `_reencoder_thread_pool_worker_loop()`.
+ */
+#if defined(_WIN32)
+static DWORD WINAPI _reencoder_thread_pool_thread_main(LPVOID worker);
+#else
+static void* _reencoder_thread_pool_thread_main(void* worker);
+#endif
+
+/**
+ * @brief Initialises a platform mutex (critical section on Windows, pthread mutex elsewhere).
+ *
+ * @return 1 on success, 0 on failure.
+ */
+static unsigned int _reencoder_mutex_init(_ReencoderMutex* mutex);
+
+/**
+ * @brief Releases the resources held by a mutex initialised with `_reencoder_mutex_init()`.
+ */
+static void _reencoder_mutex_destroy(_ReencoderMutex* mutex);
+
+/**
+ * @brief Blocks until the calling thread holds the mutex.
+ */
+static void _reencoder_mutex_lock(_ReencoderMutex* mutex);
+
+/**
+ * @brief Releases a mutex held by the calling thread.
+ */
+static void _reencoder_mutex_unlock(_ReencoderMutex* mutex);
+
+/**
+ * @brief Initialises a platform condition variable.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+static unsigned int _reencoder_condition_init(_ReencoderCondition* condition);
+
+/**
+ * @brief Releases the resources held by a condition variable initialised with `_reencoder_condition_init()`.
+ */
+static void _reencoder_condition_destroy(_ReencoderCondition* condition);
+
+/**
+ * @brief Atomically releases mutex and waits on the condition variable, holding mutex again on return. Wakeups can be spurious.
+ */
+static void _reencoder_condition_wait(_ReencoderCondition* condition, _ReencoderMutex* mutex);
+
+/**
+ * @brief Wakes one thread waiting on the condition variable, if any.
+ */
+static void _reencoder_condition_signal(_ReencoderCondition* condition);
+
+/**
+ * @brief Wakes every thread waiting on the condition variable.
+ */
+static void _reencoder_condition_broadcast(_ReencoderCondition* condition);
+
+/**
+ * @brief Starts a background thread running `_reencoder_thread_pool_thread_main()` for worker.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+static unsigned int _reencoder_thread_start(_ReencoderThread* thread, _ReencoderWorker* worker);
+
+/**
+ * @brief Waits for a thread started with `_reencoder_thread_start()` to exit, and releases its handle.
+ */
+static void _reencoder_thread_join(_ReencoderThread* thread);
+
+ReencoderThreadPool* reencoder_thread_pool_create(size_t num_workers) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (num_workers == 0) {
+		num_workers = _reencoder_thread_pool_num_processors();
+	}
+	if (num_workers > _REENCODER_THREAD_POOL_MAX_WORKERS) {
+		num_workers = _REENCODER_THREAD_POOL_MAX_WORKERS;
+	}
+
+	ReencoderThreadPool* pool = (ReencoderThreadPool*)malloc(sizeof(ReencoderThreadPool));
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->workers = (_ReencoderWorker*)malloc(num_workers * sizeof(_ReencoderWorker));
+	if (pool->workers == NULL) {
+		free(pool);
+		return NULL;
+	}
+
+	if (!_reencoder_mutex_init(&pool->lock)) {
+		free(pool->workers);
+		free(pool);
+		return NULL;
+	}
+	if (!_reencoder_condition_init(&pool->work_ready)) {
+		_reencoder_mutex_destroy(&pool->lock);
+		free(pool->workers);
+		free(pool);
+		return NULL;
+	}
+	if (!_reencoder_condition_init(&pool->work_done)) {
+		_reencoder_condition_destroy(&pool->work_ready);
+		_reencoder_mutex_destroy(&pool->lock);
+		free(pool->workers);
+		free(pool);
+		return NULL;
+	}
+
+	pool->num_workers = 0;
+	pool->generation = 0;
+	pool->workers_busy = 0;
+	pool->is_shutting_down = 0;
+	pool->task_function = NULL;
+	pool->job = NULL;
+
+	// worker 0 is the calling thread, every other worker gets a thread of its own
+	for (size_t i = 0; i < num_workers; i++) {
+		_ReencoderWorker* worker = &pool->workers[i];
+		worker->pool = pool;
+		worker->worker_index = i;
+		worker->deque.top = 0;
+		worker->deque.bottom = 0;
+		worker->scratch = NULL;
+		worker->scratch_size = 0;
+
+		if (!_reencoder_mutex_init(&worker->deque.lock)) {
+			break;
+		}
+		if (i != 0 && !_reencoder_thread_start(&worker->thread, worker)) {
+			_reencoder_mutex_destroy(&worker->deque.lock);
+			break;
+		}
+
+		pool->num_workers++;
+	}
+
+	if (pool->num_workers == 0) {
+		reencoder_thread_pool_destroy(&pool);
+		return NULL;
+	}
+
+	return pool;
+}
+
+void reencoder_thread_pool_destroy(ReencoderThreadPool** pool) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (pool == NULL || *pool == NULL) {
+		return;
+	}
+
+	ReencoderThreadPool* pool_ptr = *pool;
+
+	_reencoder_mutex_lock(&pool_ptr->lock);
+	pool_ptr->is_shutting_down = 1;
+	_reencoder_condition_broadcast(&pool_ptr->work_ready);
+	_reencoder_mutex_unlock(&pool_ptr->lock);
+
+	for (size_t i = 0; i < pool_ptr->num_workers; i++) {
+		if (i != 0) {
+			_reencoder_thread_join(&pool_ptr->workers[i].thread);
+		}
+		_reencoder_mutex_destroy(&pool_ptr->workers[i].deque.lock);
+		free(pool_ptr->workers[i].scratch);
+	}
+
+	_reencoder_condition_destroy(&pool_ptr->work_done);
+	_reencoder_condition_destroy(&pool_ptr->work_ready);
+	_reencoder_mutex_destroy(&pool_ptr->lock);
+	free(pool_ptr->workers);
+	free(pool_ptr);
+
+	*pool = NULL;
+}
+
+void _reencoder_thread_pool_run(ReencoderThreadPool* pool, size_t num_tasks, _ReencoderTaskFunction task_function, void* job) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (num_tasks == 0) {
+		return;
+	}
+
+	// background workers are all waiting at this point, the pool lock below publishes the deques to them
+	for (size_t i = 0; i < pool->num_workers; i++) {
+		pool->workers[i].deque.top = (num_tasks * i) / pool->num_workers;
+		pool->workers[i].deque.bottom = (num_tasks * (i + 1)) / pool->num_workers;
+	}
+
+	_reencoder_mutex_lock(&pool->lock);
+	pool->task_function = task_function;
+	pool->job = job;
+	pool->workers_busy = pool->num_workers - 1;
+	pool->generation++;
+	_reencoder_condition_broadcast(&pool->work_ready);
+	_reencoder_mutex_unlock(&pool->lock);
+
+	_reencoder_thread_pool_work(pool, 0);
+
+	_reencoder_mutex_lock(&pool->lock);
+	while (pool->workers_busy != 0) {
+		_reencoder_condition_wait(&pool->work_done, &pool->lock);
+	}
+	_reencoder_mutex_unlock(&pool->lock);
+}
+
+size_t _reencoder_thread_pool_num_processors(void) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+#if defined(_WIN32)
+	SYSTEM_INFO system_info;
+	GetSystemInfo(&system_info);
+	return system_info.dwNumberOfProcessors == 0 ? 1 : (size_t)system_info.dwNumberOfProcessors;
+#else
+	long num_processors = sysconf(_SC_NPROCESSORS_ONLN);
+	return num_processors < 1 ? 1 : (size_t)num_processors;
+#endif
+}
+
+static void _reencoder_thread_pool_work(ReencoderThreadPool* pool, size_t worker_index) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	size_t task_index = 0;
+	for (;;) {
+		if (_reencoder_task_deque_pop(&pool->workers[worker_index].deque, &task_index)) {
+			pool->task_function(pool->job, worker_index, task_index);
+			continue;
+		}
+
+		// own deque is empty, go round the other workers once, starting with the next one so that thieves spread out
+		unsigned int stolen = 0;
+		for (size_t i = 1; i < pool->num_workers && !stolen; i++) {
+			stolen = _reencoder_task_deque_steal(&pool->workers[(worker_index + i) % pool->num_workers].deque, &task_index);
+		}
+		if (!stolen) {
+			// no task is ever added during a run, so every deque being empty once means the run is finished for this worker
+			return;
+		}
+
+		pool->task_function(pool->job, worker_index, task_index);
+	}
+}
+
+static unsigned int _reencoder_task_deque_pop(_ReencoderTaskDeque* deque, size_t* task_index) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	unsigned int taken = 0;
+
+	_reencoder_mutex_lock(&deque->lock);
+	if (deque->top < deque->bottom) {
+		deque->bottom--;
+		*task_index = deque->bottom;
+		taken = 1;
+	}
+	_reencoder_mutex_unlock(&deque->lock);
+
+	return taken;
+}
+
+static unsigned int _reencoder_task_deque_steal(_ReencoderTaskDeque* deque, size_t* task_index) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	unsigned int taken = 0;
+
+	_reencoder_mutex_lock(&deque->lock);
+	if (deque->top < deque->bottom) {
+		*task_index = deque->top;
+		deque->top++;
+		taken = 1;
+	}
+	_reencoder_mutex_unlock(&deque->lock);
+
+	return taken;
+}
+
+static void _reencoder_thread_pool_worker_loop(_ReencoderWorker* worker) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	ReencoderThreadPool* pool = worker->pool;
+	unsigned long generation_seen = 0;
+
+	_reencoder_mutex_lock(&pool->lock);
+	for (;;) {
+		while (!pool->is_shutting_down && pool->generation == generation_seen) {
+			_reencoder_condition_wait(&pool->work_ready, &pool->lock);
+		}
+		if (pool->is_shutting_down) {
+			break;
+		}
+		generation_seen = pool->generation;
+		_reencoder_mutex_unlock(&pool->lock);
+
+		_reencoder_thread_pool_work(pool, worker->worker_index);
+
+		_reencoder_mutex_lock(&pool->lock);
+		pool->workers_busy--;
+		if (pool->workers_busy == 0) {
+			_reencoder_condition_signal(&pool->work_done);
+		}
+	}
+	_reencoder_mutex_unlock(&pool->lock);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI _reencoder_thread_pool_thread_main(LPVOID worker) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	_reencoder_thread_pool_worker_loop((_ReencoderWorker*)worker);
+	return 0;
+}
+
+static unsigned int _reencoder_mutex_init(_ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	InitializeCriticalSection(mutex);
+	return 1;
+}
+
+static void _reencoder_mutex_destroy(_ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	DeleteCriticalSection(mutex);
+}
+
+static void _reencoder_mutex_lock(_ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	EnterCriticalSection(mutex);
+}
+
+static void _reencoder_mutex_unlock(_ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	LeaveCriticalSection(mutex);
+}
+
+static unsigned int _reencoder_condition_init(_ReencoderCondition* condition) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	InitializeConditionVariable(condition);
+	return 1;
+}
+
+static void _reencoder_condition_destroy(_ReencoderCondition* condition) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// Windows condition variables hold no resources
+	(void)condition;
+}
+
+static void _reencoder_condition_wait(_ReencoderCondition* condition, _ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	SleepConditionVariableCS(condition, mutex, INFINITE);
+}
+
+static void _reencoder_condition_signal(_ReencoderCondition* condition) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	WakeConditionVariable(condition);
+}
+
+static void _reencoder_condition_broadcast(_ReencoderCondition* condition) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	WakeAllConditionVariable(condition);
+}
+
+static unsigned int _reencoder_thread_start(_ReencoderThread* thread, _ReencoderWorker* worker) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	*thread = CreateThread(NULL, 0, _reencoder_thread_pool_thread_main, worker, 0, NULL);
+	return *thread != NULL;
+}
+
+static void _reencoder_thread_join(_ReencoderThread* thread) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	WaitForSingleObject(*thread, INFINITE);
+	CloseHandle(*thread);
+}
+#else
+static void* _reencoder_thread_pool_thread_main(void* worker) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	_reencoder_thread_pool_worker_loop((_ReencoderWorker*)worker);
+	return NULL;
+}
+
+static unsigned int _reencoder_mutex_init(_ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	return pthread_mutex_init(mutex, NULL) == 0;
+}
+
+static void _reencoder_mutex_destroy(_ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	pthread_mutex_destroy(mutex);
+}
+
+static void _reencoder_mutex_lock(_ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	pthread_mutex_lock(mutex);
+}
+
+static void _reencoder_mutex_unlock(_ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	pthread_mutex_unlock(mutex);
+}
+
+static unsigned int _reencoder_condition_init(_ReencoderCondition* condition) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	return pthread_cond_init(condition, NULL) == 0;
+}
+
+static void _reencoder_condition_destroy(_ReencoderCondition* condition) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	pthread_cond_destroy(condition);
+}
+
+static void _reencoder_condition_wait(_ReencoderCondition* condition, _ReencoderMutex* mutex) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	pthread_cond_wait(condition, mutex);
+}
+
+static void _reencoder_condition_signal(_ReencoderCondition* condition) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	pthread_cond_signal(condition);
+}
+
+static void _reencoder_condition_broadcast(_ReencoderCondition* condition) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	pthread_cond_broadcast(condition);
+}
+
+static unsigned int _reencoder_thread_start(_ReencoderThread* thread, _ReencoderWorker* worker) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	return pthread_create(thread, NULL, _reencoder_thread_pool_thread_main, worker) == 0;
+}
+
+static void _reencoder_thread_join(_ReencoderThread* thread) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	pthread_join(*thread, NULL);
+}
+#endif
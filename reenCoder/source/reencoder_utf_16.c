@@ -44,6 +44,51 @@ static inline unsigned int _reencoder_utf16_validity_check_2_is_high_surrogate(u
  */
 static inline unsigned int _reencoder_utf16_validity_check_3_is_low_surrogate(uint32_t code_unit);
 
+/**
+ * @brief Reads a single UTF-16 code unit from a byte buffer in the given byte order.
+ *
+ * The unit is assembled byte by byte, so ptr does not need to be aligned.
+ *
+ * @param[in] ptr Pointer to the first byte of the code unit.
+ * @param[in] endian Byte order of the code unit (UTF_16BE or UTF_16LE).
+ *
+ * @return Code unit in system endianness.
+ */
+static inline uint16_t _reencoder_utf16_read_unit(const uint8_t* ptr, enum ReencoderEncodeType endian);
+
+/**
+ * @brief Writes a single UTF-16 code unit to a byte buffer in the given byte order.
+ *
+ * @param[out] ptr Pointer to the first byte of the code unit.
+ * @param[in] code_unit Code unit in system endianness.
+ * @param[in] endian Byte order to write in (UTF_16BE or UTF_16LE).
+ *
+ * @return void
+ */
+static inline void _reencoder_utf16_write_unit(uint8_t* ptr, uint16_t code_unit, enum ReencoderEncodeType endian);
+
+/**
+ * @brief Parses an even-length UTF-16 byte sequence straight into a new `ReencoderUnicodeStruct`.
+ *
+ * Code units are read in source_endian, validated and counted in a single pass, and written to the struct buffer in target_endian.
+ * Parsing stops at the first null code unit or after bytes bytes, whichever comes first.
+ *
+ * @param[in] string Input UTF-16 string. Does not need to be aligned.
+ * @param[in] bytes Number of bytes in the input string. Must be a multiple of 2.
+ * @param[in] source_endian Byte order of the input string (UTF_16BE or UTF_16LE).
+ * @param[in] target_endian Byte order of the struct buffer (UTF_16BE or UTF_16LE).
+ * @param[in] arena Arena to allocate from. Can be NULL.
+ *
+ * @return Pointer to a `ReencoderUnicodeStruct` containing parsed string data.
+ * @retval NULL If memory allocation fails.
+ */
+static ReencoderUnicodeStruct* _reencoder_utf16_parse_uint8_direct(const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian, ReencoderArena* arena);
+
+/**
+ * @brief Body of `reencoder_utf16_parse_uint8_ctx()` once its arguments are checked, so that the call can be timed as a whole.
+ */
+static ReencoderUnicodeStruct* _reencoder_utf16_parse_uint8_ctx_run(ReencoderContext* ctx, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian);
+
 // ##### //
 // https://datatracker.ietf.org/doc/html/rfc2781/
 // ##### //
@@ -52,46 +97,93 @@ ReencoderUnicodeStruct* reencoder_utf16_parse_uint16(const uint16_t* string, enu
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] Yes
 
+	return reencoder_utf16_parse_uint16_arena(NULL, string, target_endian);
+}
+
+ReencoderUnicodeStruct* reencoder_utf16_parse_uint16_arena(ReencoderArena* arena, const uint16_t* string, enum ReencoderEncodeType target_endian) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
 	if (target_endian != UTF_16BE && target_endian != UTF_16LE) {
 		return NULL;
 	}
 
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_TRACE2(parse_entry, target_endian, string);
+
 	size_t string_length_uint16 = _reencoder_utf16_strlen(string);
 	size_t string_size_bytes = string_length_uint16 * sizeof(uint16_t);
+	_REENCODER_STATS_CALL_INPUT(string_size_bytes);
+
+	// characters are only counted in well-formed strings, counting skips whole surrogate pairs and would step over the null-terminator after a lone high surrogate
+	// without surrogate pairs every unit is one character, so it is not counted at all
+	unsigned int char_flags = 0;
+	unsigned int string_validity = _reencoder_utf16_seq_is_valid(string, string_length_uint16, &char_flags);
+	size_t num_chars = 0;
+	if (string_validity == REENCODER_UTF16_VALID) {
+		num_chars = (char_flags & REENCODER_CHARS_BMP) ? string_length_uint16 : _reencoder_utf16_determine_num_chars(string);
+	}
+	_REENCODER_STATS_VALIDATED(target_endian, string_size_bytes, string_validity);
 
-	return _reencoder_unicode_struct_express_populate(
-		target_endian, (const void*)string, string_size_bytes,
-		_reencoder_utf16_seq_is_valid(string, string_length_uint16), _reencoder_utf16_determine_num_chars(string)
+	ReencoderUnicodeStruct* struct_utf16_str = _reencoder_unicode_struct_express_populate(
+		target_endian, (const void*)string, string_size_bytes, string_validity, num_chars, char_flags, arena
 	);
+
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_PARSE);
+	_REENCODER_TRACE3(parse_return, target_endian, string_size_bytes, string_validity);
+
+	return struct_utf16_str;
 }
 
 ReencoderUnicodeStruct* reencoder_utf16_parse_uint8(const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian) {
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] Yes
 
-	if (target_endian != UTF_16BE && target_endian != UTF_16LE) {
-		return NULL;
+	return reencoder_utf16_parse_uint8_arena(NULL, string, bytes, source_endian, target_endian);
+}
+
+ReencoderUnicodeStruct* reencoder_utf16_parse_uint8_arena(ReencoderArena* arena, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_STATS_CALL_INPUT(bytes);
+
+	ReencoderContext ctx;
+	_reencoder_context_init_transient(&ctx, arena);
+
+	ReencoderUnicodeStruct* struct_utf16_str = reencoder_utf16_parse_uint8_ctx(&ctx, string, bytes, source_endian, target_endian);
+
+	_reencoder_context_release(&ctx);
+
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_PARSE);
+
+	return struct_utf16_str;
+}
+
+ReencoderUnicodeStruct* reencoder_utf16_parse_uint8_ctx(ReencoderContext* ctx, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (ctx == NULL) {
+		return reencoder_utf16_parse_uint8_arena(NULL, string, bytes, source_endian, target_endian);
 	}
 
-	// always malloc a multiple of 2 bytes, going higher if needed
-	size_t bytes_adjusted = bytes + (bytes % sizeof(uint16_t));
-	uint16_t* string_uint16 = (uint16_t*)malloc(bytes_adjusted + sizeof(uint16_t));
-	if (string_uint16 == NULL) {
+	if (target_endian != UTF_16BE && target_endian != UTF_16LE) {
 		return NULL;
 	}
-	_reencoder_utf16_uint16_from_uint8(string_uint16, string, bytes, source_endian);
-
-	// odd number of bytes is impossible for UTF-16
-	if (bytes % 2 != 0) {
-		return _reencoder_unicode_struct_express_populate(
-			reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE, (const void*)string_uint16, bytes_adjusted, REENCODER_UTF16_ERR_ODD_LENGTH, 0
-		);
+	if (source_endian != UTF_16BE && source_endian != UTF_16LE) {
+		return NULL;
 	}
 
-	ReencoderUnicodeStruct* struct_utf16_str = reencoder_utf16_parse_uint16(string_uint16, target_endian);
-
-	// clean up other allocated memory
-	free(string_uint16);
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_STATS_CALL_INPUT(bytes);
+	_REENCODER_TRACE2(parse_entry, source_endian, string);
+	ReencoderUnicodeStruct* struct_utf16_str = _reencoder_utf16_parse_uint8_ctx_run(ctx, string, bytes, source_endian, target_endian);
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_PARSE);
+	_REENCODER_TRACE3(
+		parse_return, target_endian, struct_utf16_str == NULL ? 0 : struct_utf16_str->num_bytes, struct_utf16_str == NULL ? 0 : struct_utf16_str->string_validity
+	);
 
 	return struct_utf16_str;
 }
@@ -143,10 +235,12 @@ unsigned int _reencoder_utf16_buffer_idx0_is_valid(const uint16_t* ptr, size_t u
 	return _reencoder_utf16_char_is_valid(code_unit_1, code_unit_2, is_potential_surrogate_pair ? 2 : 1, units_actual);
 }
 
-unsigned int _reencoder_utf16_seq_is_valid(const uint16_t* string, size_t length) {
+unsigned int _reencoder_utf16_seq_is_valid(const uint16_t* string, size_t length, unsigned int* char_flags) {
 	// [Use Case] Internal Function (Non-static, Extern @ _common)
 	// [End-user Function Tested?] NA
 
+	// the largest unit tells the range of BMP characters, any surrogate pair takes the string past the BMP
+	uint32_t max_code_point = 0x0000;
 	for (size_t i = 0; i < length;) {
 		unsigned int units_actual = 0;
 
@@ -155,9 +249,17 @@ unsigned int _reencoder_utf16_seq_is_valid(const uint16_t* string, size_t length
 			return return_code;
 		}
 
+		uint32_t code_point_bound = units_actual == 2 ? 0x10000 : string[i];
+		if (code_point_bound > max_code_point) {
+			max_code_point = code_point_bound;
+		}
 		i += units_actual;
 	}
 
+	if (char_flags != NULL) {
+		*char_flags = _reencoder_char_flags_from_max_code_point(max_code_point);
+	}
+
 	return REENCODER_UTF16_VALID;
 }
 
@@ -172,7 +274,7 @@ void _reencoder_utf16_uint16_from_uint8(uint16_t* dest, const uint8_t* src, size
 	size_t bytes_adjusted = bytes + (bytes % sizeof(uint16_t));
 	size_t code_units = bytes_adjusted / sizeof(uint16_t);
 
-	if (reencoder_is_system_little_endian() == (source_endian == UTF_16LE)) {
+	if (_REENCODER_IS_SYSTEM_LITTLE_ENDIAN() == (source_endian == UTF_16LE)) {
 		memcpy(dest, src, bytes);
 	}
 	else {
@@ -266,6 +368,60 @@ void _reencoder_utf16_write_buffer_swap_endian(uint8_t* dest, const uint16_t* sr
 	}
 }
 
+size_t _reencoder_utf16_repair_in_place(uint8_t* buffer, size_t length, enum ReencoderEncodeType endian, unsigned int* char_flags) {
+	// [Use Case] Internal Function (Non-static, Extern @ _common)
+	// [End-user Function Tested?] NA
+
+	// index of the most significant byte within a unit
+	unsigned int msb = endian == UTF_16LE ? 1 : 0;
+	unsigned int lsb = 1 - msb;
+
+	size_t num_chars = 0;
+	unsigned int null_found = 0;
+	uint32_t max_code_point = 0x0000;
+
+	for (size_t i = 0; i < length;) {
+		uint8_t* unit = buffer + (i * sizeof(uint16_t));
+
+		// load up to 2 units in system endianness so the usual validity check can be reused
+		uint16_t code_units[2] = {
+			(uint16_t)((unit[msb] << 8) | unit[lsb]),
+			i + 1 < length ? (uint16_t)((unit[sizeof(uint16_t) + msb] << 8) | unit[sizeof(uint16_t) + lsb]) : 0x0000
+		};
+
+		// any surrogate pair is above the BMP, its exact code point does not matter for the flags
+		unsigned int units_read = 0;
+		uint32_t code_point = code_units[0];
+		if (_reencoder_utf16_buffer_idx0_is_valid(code_units, length - i, &units_read) != REENCODER_UTF16_VALID) {
+			unit[msb] = (uint8_t)(_REENCODER_UTF16_REPLACEMENT_CHARACTER >> 8);
+			unit[lsb] = (uint8_t)(_REENCODER_UTF16_REPLACEMENT_CHARACTER & 0xFF);
+			code_point = _REENCODER_UTF16_REPLACEMENT_CHARACTER;
+			_REENCODER_STATS_ADD(replacements_inserted[endian], 1);
+		}
+		else if (units_read == 2) {
+			code_point = 0x10000;
+		}
+		else if (code_units[0] == 0x0000) {
+			null_found = 1;
+		}
+		if (code_point > max_code_point) {
+			max_code_point = code_point;
+		}
+
+		if (!null_found) {
+			num_chars++;
+		}
+		i += units_read;
+	}
+
+	buffer[length * sizeof(uint16_t)] = 0x00;
+	buffer[(length * sizeof(uint16_t)) + 1] = 0x00;
+
+	*char_flags = _reencoder_char_flags_from_max_code_point(max_code_point);
+
+	return num_chars;
+}
+
 static inline unsigned int _reencoder_utf16_char_is_valid(uint32_t code_unit_1, uint32_t code_unit_2, unsigned int units_expected, unsigned int* units_actual) {
 	// [Use Case] Internal Function (Static)
 	// [End-user Function Tested?] NA
@@ -313,3 +469,127 @@ static inline unsigned int _reencoder_utf16_validity_check_3_is_low_surrogate(ui
 
 	return code_unit >= 0xDC00 && code_unit <= 0xDFFF; // low surrogates (0xDC00-0xDFFF)
 }
+
+
+static inline uint16_t _reencoder_utf16_read_unit(const uint8_t* ptr, enum ReencoderEncodeType endian) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (endian == UTF_16LE) {
+		return (uint16_t)((ptr[1] << 8) | ptr[0]);
+	}
+
+	return (uint16_t)((ptr[0] << 8) | ptr[1]);
+}
+
+static inline void _reencoder_utf16_write_unit(uint8_t* ptr, uint16_t code_unit, enum ReencoderEncodeType endian) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (endian == UTF_16LE) {
+		ptr[0] = (uint8_t)(code_unit & 0xFF);
+		ptr[1] = (uint8_t)(code_unit >> 8);
+	}
+	else {
+		ptr[0] = (uint8_t)(code_unit >> 8);
+		ptr[1] = (uint8_t)(code_unit & 0xFF);
+	}
+}
+
+static ReencoderUnicodeStruct* _reencoder_utf16_parse_uint8_direct(const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian, ReencoderArena* arena) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	ReencoderUnicodeStruct* unicode_struct = _reencoder_unicode_struct_init(target_endian, arena);
+	if (unicode_struct == NULL) {
+		return NULL;
+	}
+
+	// the string can only get shorter (null found early), so the input size is enough
+	unicode_struct->string_buffer = (uint8_t*)_reencoder_alloc(arena, bytes + sizeof(uint16_t));
+	if (unicode_struct->string_buffer == NULL) {
+		reencoder_unicode_struct_free(&unicode_struct);
+		return NULL;
+	}
+
+	size_t length = bytes / sizeof(uint16_t);
+	size_t num_chars = 0;
+	uint32_t max_code_point = 0x0000;
+	unsigned int string_validity = REENCODER_UTF16_VALID;
+
+	size_t i = 0;
+	while (i < length) {
+		const uint8_t* unit = string + (i * sizeof(uint16_t));
+
+		// load up to 2 units in system endianness so the usual validity check can be reused
+		uint16_t code_units[2] = {
+			_reencoder_utf16_read_unit(unit, source_endian),
+			i + 1 < length ? _reencoder_utf16_read_unit(unit + sizeof(uint16_t), source_endian) : 0x0000
+		};
+		if (code_units[0] == 0x0000) {
+			break;
+		}
+
+		unsigned int units_read = 0;
+		unsigned int return_code = _reencoder_utf16_buffer_idx0_is_valid(code_units, length - i, &units_read);
+		if (return_code != REENCODER_UTF16_VALID && string_validity == REENCODER_UTF16_VALID) {
+			string_validity = return_code; // keep only the first error, same as _reencoder_utf16_seq_is_valid()
+		}
+
+		uint32_t code_point_bound = units_read == 2 ? 0x10000 : code_units[0];
+		if (code_point_bound > max_code_point) {
+			max_code_point = code_point_bound;
+		}
+
+		for (unsigned int j = 0; j < units_read; j++) {
+			_reencoder_utf16_write_unit(unicode_struct->string_buffer + ((i + j) * sizeof(uint16_t)), code_units[j], target_endian);
+		}
+
+		num_chars++;
+		i += units_read;
+	}
+
+	unicode_struct->string_buffer[i * sizeof(uint16_t)] = 0x00;
+	unicode_struct->string_buffer[(i * sizeof(uint16_t)) + 1] = 0x00;
+
+	_REENCODER_STATS_VALIDATED(source_endian, i * sizeof(uint16_t), string_validity);
+
+	unicode_struct->string_validity = string_validity;
+	if (string_validity == REENCODER_UTF16_VALID) {
+		unicode_struct->num_chars = num_chars;
+		unicode_struct->char_flags = _reencoder_char_flags_from_max_code_point(max_code_point);
+	}
+	unicode_struct->num_bytes = i * sizeof(uint16_t);
+	unicode_struct->capacity = bytes + sizeof(uint16_t);
+
+	return unicode_struct;
+}
+
+static ReencoderUnicodeStruct* _reencoder_utf16_parse_uint8_ctx_run(ReencoderContext* ctx, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// well-formed lengths skip the native copy entirely
+	// host-order storage writes the struct buffer in system byte order and tags it with target_endian afterwards
+	if (bytes % sizeof(uint16_t) == 0) {
+		if (ctx->host_order_storage) {
+			return _reencoder_unicode_struct_tag_host_order(
+				_reencoder_utf16_parse_uint8_direct(string, bytes, source_endian, _reencoder_host_order_type(target_endian), ctx->arena), target_endian
+			);
+		}
+
+		return _reencoder_utf16_parse_uint8_direct(string, bytes, source_endian, target_endian, ctx->arena);
+	}
+
+	// odd number of bytes is impossible for UTF-16, go through a padded native copy instead
+	size_t bytes_adjusted = bytes + (bytes % sizeof(uint16_t));
+	uint16_t* string_uint16 = (uint16_t*)_reencoder_context_reserve(&ctx->scratch_source, &ctx->scratch_source_size, bytes_adjusted + sizeof(uint16_t));
+	if (string_uint16 == NULL) {
+		return NULL;
+	}
+	_reencoder_utf16_uint16_from_uint8(string_uint16, string, bytes, source_endian);
+
+	return _reencoder_unicode_struct_express_populate(
+		_REENCODER_IS_SYSTEM_LITTLE_ENDIAN() ? UTF_16LE : UTF_16BE, (const void*)string_uint16, bytes_adjusted, REENCODER_UTF16_ERR_ODD_LENGTH, 0, 0, ctx->arena
+	);
+}
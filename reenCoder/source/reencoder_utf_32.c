@@ -31,6 +31,51 @@ static inline unsigned int _reencoder_utf32_validity_check_1_is_valid_range(uint
  */
 static unsigned int _reencoder_utf32_validity_check_2_is_not_surrogate(uint32_t code_unit);
 
+/**
+ * @brief Reads a single UTF-32 code unit from a byte buffer in the given byte order.
+ *
+ * The unit is assembled byte by byte, so ptr does not need to be aligned.
+ *
+ * @param[in] ptr Pointer to the first byte of the code unit.
+ * @param[in] endian Byte order of the code unit (UTF_32BE or UTF_32LE).
+ *
+ * @return Code unit in system endianness.
+ */
+static inline uint32_t _reencoder_utf32_read_unit(const uint8_t* ptr, enum ReencoderEncodeType endian);
+
+/**
+ * @brief Writes a single UTF-32 code unit to a byte buffer in the given byte order.
+ *
+ * @param[out] ptr Pointer to the first byte of the code unit.
+ * @param[in] code_unit Code unit in system endianness.
+ * @param[in] endian Byte order to write in (UTF_32BE or UTF_32LE).
+ *
+ * @return void
+ */
+static inline void _reencoder_utf32_write_unit(uint8_t* ptr, uint32_t code_unit, enum ReencoderEncodeType endian);
+
+/**
+ * @brief Parses a UTF-32 byte sequence with a length divisible by 4 straight into a new `ReencoderUnicodeStruct`.
+ *
+ * Code units are read in source_endian, validated and counted in a single pass, and written to the struct buffer in target_endian.
+ * Parsing stops at the first null code unit or after bytes bytes, whichever comes first.
+ *
+ * @param[in] string Input UTF-32 string. Does not need to be aligned.
+ * @param[in] bytes Number of bytes in the input string. Must be a multiple of 4.
+ * @param[in] source_endian Byte order of the input string (UTF_32BE or UTF_32LE).
+ * @param[in] target_endian Byte order of the struct buffer (UTF_32BE or UTF_32LE).
+ * @param[in] arena Arena to allocate from. Can be NULL.
+ *
+ * @return Pointer to a `ReencoderUnicodeStruct` containing parsed string data.
+ * @retval NULL If memory allocation fails.
+ */
+static ReencoderUnicodeStruct* _reencoder_utf32_parse_uint8_direct(const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian, ReencoderArena* arena);
+
+/**
+ * @brief Body of `reencoder_utf32_parse_uint8_ctx()` once its arguments are checked, so that the call can be timed as a whole.
+ */
+static ReencoderUnicodeStruct* _reencoder_utf32_parse_uint8_ctx_run(ReencoderContext* ctx, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian);
+
 // ##### //
 // No IETF lol
 // ##### //
@@ -39,21 +84,41 @@ ReencoderUnicodeStruct* reencoder_utf32_parse_uint32(const uint32_t* string, enu
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] Yes
 
+	return reencoder_utf32_parse_uint32_arena(NULL, string, target_endian);
+}
+
+ReencoderUnicodeStruct* reencoder_utf32_parse_uint32_arena(ReencoderArena* arena, const uint32_t* string, enum ReencoderEncodeType target_endian) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
 	if (target_endian != UTF_32BE && target_endian != UTF_32LE) {
 		return NULL;
 	}
 
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_TRACE2(parse_entry, target_endian, string);
+
 	size_t string_length_uint32 = _reencoder_utf32_strlen(string);
 	size_t string_size_bytes = string_length_uint32 * sizeof(uint32_t);
+	_REENCODER_STATS_CALL_INPUT(string_size_bytes);
+
+	unsigned int char_flags = 0;
+	unsigned int string_validity = _reencoder_utf32_seq_is_valid(string, string_length_uint32, &char_flags);
+	_REENCODER_STATS_VALIDATED(target_endian, string_size_bytes, string_validity);
 
 	ReencoderUnicodeStruct* struct_utf32_str = _reencoder_unicode_struct_express_populate(
 		target_endian,
 		(const void*)string,
 		string_size_bytes,
-		_reencoder_utf32_seq_is_valid(string, string_length_uint32),
-		string_length_uint32
+		string_validity,
+		string_length_uint32,
+		char_flags,
+		arena
 	);
 
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_PARSE);
+	_REENCODER_TRACE3(parse_return, target_endian, string_size_bytes, string_validity);
+
 	return struct_utf32_str;
 }
 
@@ -61,35 +126,51 @@ ReencoderUnicodeStruct* reencoder_utf32_parse_uint8(const uint8_t* string, size_
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] Yes
 
-	if (target_endian != UTF_32BE && target_endian != UTF_32LE) {
-		return NULL;
-	}
+	return reencoder_utf32_parse_uint8_arena(NULL, string, bytes, source_endian, target_endian);
+}
 
-	// always malloc a multiple of 2 bytes, going higher if needed
-	size_t bytes_adjusted = bytes + (bytes % sizeof(uint32_t));
-	uint32_t* string_uint32 = (uint32_t*)malloc(bytes_adjusted + sizeof(uint32_t));
-	if (string_uint32 == NULL) {
-		return NULL;
-	}
-	_reencoder_utf32_uint32_from_uint8(string_uint32, string, bytes, source_endian);
+ReencoderUnicodeStruct* reencoder_utf32_parse_uint8_arena(ReencoderArena* arena, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_STATS_CALL_INPUT(bytes);
+
+	ReencoderContext ctx;
+	_reencoder_context_init_transient(&ctx, arena);
 
-	// bytes not in multiples of 4 is impossible for UTF-32
-	if (bytes % sizeof(uint32_t) != 0) {
-		ReencoderUnicodeStruct* struct_utf32_str = _reencoder_unicode_struct_express_populate(
-			reencoder_is_system_little_endian() ? UTF_32LE : UTF_32BE,
-			(const void*)string_uint32,
-			bytes_adjusted,
-			REENCODER_UTF32_ERR_ODD_LENGTH,
-			0
-		);
+	ReencoderUnicodeStruct* struct_utf32_str = reencoder_utf32_parse_uint8_ctx(&ctx, string, bytes, source_endian, target_endian);
+
+	_reencoder_context_release(&ctx);
+
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_PARSE);
+
+	return struct_utf32_str;
+}
+
+ReencoderUnicodeStruct* reencoder_utf32_parse_uint8_ctx(ReencoderContext* ctx, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
 
-		return struct_utf32_str;
+	if (ctx == NULL) {
+		return reencoder_utf32_parse_uint8_arena(NULL, string, bytes, source_endian, target_endian);
 	}
 
-	ReencoderUnicodeStruct* struct_utf32_str = reencoder_utf32_parse_uint32(string_uint32, target_endian);
+	if (target_endian != UTF_32BE && target_endian != UTF_32LE) {
+		return NULL;
+	}
+	if (source_endian != UTF_32BE && source_endian != UTF_32LE) {
+		return NULL;
+	}
 
-	// clean up other allocated memory
-	free(string_uint32);
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_STATS_CALL_INPUT(bytes);
+	_REENCODER_TRACE2(parse_entry, source_endian, string);
+	ReencoderUnicodeStruct* struct_utf32_str = _reencoder_utf32_parse_uint8_ctx_run(ctx, string, bytes, source_endian, target_endian);
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_PARSE);
+	_REENCODER_TRACE3(
+		parse_return, target_endian, struct_utf32_str == NULL ? 0 : struct_utf32_str->num_bytes, struct_utf32_str == NULL ? 0 : struct_utf32_str->string_validity
+	);
 
 	return struct_utf32_str;
 }
@@ -115,15 +196,24 @@ unsigned int _reencoder_utf32_buffer_idx0_is_valid(const uint32_t* ptr) {
 	return _reencoder_utf32_char_is_valid(ptr[0]);
 }
 
-unsigned int _reencoder_utf32_seq_is_valid(const uint32_t* string, size_t length) {
+unsigned int _reencoder_utf32_seq_is_valid(const uint32_t* string, size_t length, unsigned int* char_flags) {
 	// [Use Case] Internal Function (Non-static, Extern @ _common)
 	// [End-user Function Tested?] NA
 
+	uint32_t max_code_point = 0x00000000;
 	for (size_t i = 0; i < length; i++) {
 		unsigned int return_code = _reencoder_utf32_buffer_idx0_is_valid(string + i);
 		if (return_code != REENCODER_UTF32_VALID) {
 			return return_code;
 		}
+
+		if (string[i] > max_code_point) {
+			max_code_point = string[i];
+		}
+	}
+
+	if (char_flags != NULL) {
+		*char_flags = _reencoder_char_flags_from_max_code_point(max_code_point);
 	}
 
 	return REENCODER_UTF32_VALID;
@@ -141,7 +231,7 @@ void _reencoder_utf32_uint32_from_uint8(uint32_t* dest, const uint8_t* src, size
 	size_t extra_bytes = bytes_adjusted - bytes;
 	size_t code_units = bytes_adjusted / sizeof(uint32_t);
 
-	if (reencoder_is_system_little_endian() == (source_endian == UTF_32LE)) {
+	if (_REENCODER_IS_SYSTEM_LITTLE_ENDIAN() == (source_endian == UTF_32LE)) {
 		memcpy(dest, src, bytes);
 	}
 	else {
@@ -212,6 +302,50 @@ void _reencoder_utf32_write_buffer_swap_endian(uint8_t* dest, const uint32_t* sr
 	}
 }
 
+size_t _reencoder_utf32_repair_in_place(uint8_t* buffer, size_t length, enum ReencoderEncodeType endian, unsigned int* char_flags) {
+	// [Use Case] Internal Function (Non-static, Extern @ _common)
+	// [End-user Function Tested?] NA
+
+	unsigned int is_little_endian = endian == UTF_32LE;
+
+	size_t num_chars = 0;
+	unsigned int null_found = 0;
+	uint32_t max_code_point = 0x00000000;
+
+	for (size_t i = 0; i < length; i++) {
+		uint8_t* unit = buffer + (i * sizeof(uint32_t));
+
+		uint32_t code_unit = is_little_endian ?
+			((uint32_t)unit[3] << 24) | ((uint32_t)unit[2] << 16) | ((uint32_t)unit[1] << 8) | unit[0] :
+			((uint32_t)unit[0] << 24) | ((uint32_t)unit[1] << 16) | ((uint32_t)unit[2] << 8) | unit[3];
+
+		if (_reencoder_utf32_char_is_valid(code_unit) != REENCODER_UTF32_VALID) {
+			for (unsigned int byte = 0; byte < sizeof(uint32_t); byte++) {
+				unsigned int shift = is_little_endian ? byte * 8 : (3 - byte) * 8;
+				unit[byte] = (uint8_t)(_REENCODER_UTF32_REPLACEMENT_CHARACTER >> shift);
+			}
+			code_unit = _REENCODER_UTF32_REPLACEMENT_CHARACTER;
+			_REENCODER_STATS_ADD(replacements_inserted[endian], 1);
+		}
+		else if (code_unit == 0x00000000) {
+			null_found = 1;
+		}
+		if (code_unit > max_code_point) {
+			max_code_point = code_unit;
+		}
+
+		if (!null_found) {
+			num_chars++;
+		}
+	}
+
+	memset(buffer + (length * sizeof(uint32_t)), 0x00, sizeof(uint32_t));
+
+	*char_flags = _reencoder_char_flags_from_max_code_point(max_code_point);
+
+	return num_chars;
+}
+
 static inline unsigned int _reencoder_utf32_char_is_valid(uint32_t code_unit) {
 	// [Use Case] Internal Function (Static)
 	// [End-user Function Tested?] NA
@@ -241,3 +375,114 @@ static unsigned int _reencoder_utf32_validity_check_2_is_not_surrogate(uint32_t
 	// surrogate pair check
 	return code_unit < 0xD800 || code_unit > 0xDFFF;
 }
+
+
+static inline uint32_t _reencoder_utf32_read_unit(const uint8_t* ptr, enum ReencoderEncodeType endian) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (endian == UTF_32LE) {
+		return ((uint32_t)ptr[3] << 24) | ((uint32_t)ptr[2] << 16) | ((uint32_t)ptr[1] << 8) | ptr[0];
+	}
+
+	return ((uint32_t)ptr[0] << 24) | ((uint32_t)ptr[1] << 16) | ((uint32_t)ptr[2] << 8) | ptr[3];
+}
+
+static inline void _reencoder_utf32_write_unit(uint8_t* ptr, uint32_t code_unit, enum ReencoderEncodeType endian) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	for (unsigned int byte = 0; byte < sizeof(uint32_t); byte++) {
+		unsigned int shift = endian == UTF_32LE ? byte * 8 : (3 - byte) * 8;
+		ptr[byte] = (uint8_t)(code_unit >> shift);
+	}
+}
+
+static ReencoderUnicodeStruct* _reencoder_utf32_parse_uint8_direct(const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian, ReencoderArena* arena) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	ReencoderUnicodeStruct* unicode_struct = _reencoder_unicode_struct_init(target_endian, arena);
+	if (unicode_struct == NULL) {
+		return NULL;
+	}
+
+	// the string can only get shorter (null found early), so the input size is enough
+	unicode_struct->string_buffer = (uint8_t*)_reencoder_alloc(arena, bytes + sizeof(uint32_t));
+	if (unicode_struct->string_buffer == NULL) {
+		reencoder_unicode_struct_free(&unicode_struct);
+		return NULL;
+	}
+
+	size_t length = bytes / sizeof(uint32_t);
+	uint32_t max_code_point = 0x00000000;
+	unsigned int string_validity = REENCODER_UTF32_VALID;
+
+	size_t i = 0;
+	for (; i < length; i++) {
+		uint32_t code_unit = _reencoder_utf32_read_unit(string + (i * sizeof(uint32_t)), source_endian);
+		if (code_unit == 0x00000000) {
+			break;
+		}
+
+		// keep only the first error, same as _reencoder_utf32_seq_is_valid()
+		if (string_validity == REENCODER_UTF32_VALID) {
+			string_validity = _reencoder_utf32_char_is_valid(code_unit);
+		}
+		if (code_unit > max_code_point) {
+			max_code_point = code_unit;
+		}
+
+		_reencoder_utf32_write_unit(unicode_struct->string_buffer + (i * sizeof(uint32_t)), code_unit, target_endian);
+	}
+
+	memset(unicode_struct->string_buffer + (i * sizeof(uint32_t)), 0x00, sizeof(uint32_t));
+
+	_REENCODER_STATS_VALIDATED(source_endian, i * sizeof(uint32_t), string_validity);
+
+	// every UTF-32 code unit is one character
+	unicode_struct->string_validity = string_validity;
+	if (string_validity == REENCODER_UTF32_VALID) {
+		unicode_struct->num_chars = i;
+		unicode_struct->char_flags = _reencoder_char_flags_from_max_code_point(max_code_point);
+	}
+	unicode_struct->num_bytes = i * sizeof(uint32_t);
+	unicode_struct->capacity = bytes + sizeof(uint32_t);
+
+	return unicode_struct;
+}
+
+static ReencoderUnicodeStruct* _reencoder_utf32_parse_uint8_ctx_run(ReencoderContext* ctx, const uint8_t* string, size_t bytes, enum ReencoderEncodeType source_endian, enum ReencoderEncodeType target_endian) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// well-formed lengths skip the native copy entirely
+	// host-order storage writes the struct buffer in system byte order and tags it with target_endian afterwards
+	if (bytes % sizeof(uint32_t) == 0) {
+		if (ctx->host_order_storage) {
+			return _reencoder_unicode_struct_tag_host_order(
+				_reencoder_utf32_parse_uint8_direct(string, bytes, source_endian, _reencoder_host_order_type(target_endian), ctx->arena), target_endian
+			);
+		}
+
+		return _reencoder_utf32_parse_uint8_direct(string, bytes, source_endian, target_endian, ctx->arena);
+	}
+
+	// bytes not in multiples of 4 is impossible for UTF-32, go through a padded native copy instead
+	size_t bytes_adjusted = bytes + (bytes % sizeof(uint32_t));
+	uint32_t* string_uint32 = (uint32_t*)_reencoder_context_reserve(&ctx->scratch_source, &ctx->scratch_source_size, bytes_adjusted + sizeof(uint32_t));
+	if (string_uint32 == NULL) {
+		return NULL;
+	}
+	_reencoder_utf32_uint32_from_uint8(string_uint32, string, bytes, source_endian);
+
+	return _reencoder_unicode_struct_express_populate(
+		_REENCODER_IS_SYSTEM_LITTLE_ENDIAN() ? UTF_32LE : UTF_32BE,
+		(const void*)string_uint32,
+		bytes_adjusted,
+		REENCODER_UTF32_ERR_ODD_LENGTH,
+		0,
+		0,
+		ctx->arena
+	);
+}
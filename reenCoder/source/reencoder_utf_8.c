@@ -74,6 +74,17 @@ static inline unsigned int _reencoder_utf8_validity_check_4_is_in_unicode_range(
  */
 static inline unsigned int _reencoder_utf8_validity_check_5_is_not_surrogate(uint8_t code_units[4], unsigned int num_units);
 
+/**
+ * @brief Given a well-formed UTF-8 starting byte, determines the largest code point its sequence can encode.
+ *
+ * Only the ranges that matter to REENCODER_CHARS_* are told apart, anything past the BMP is reported as U+10000.
+ *
+ * @param[in] first_byte UTF-8 starting byte.
+ *
+ * @return first_byte for ASCII, U+00FF for 0xC2-0xC3, U+FFFF for any other 2-byte or 3-byte sequence, U+10000 for 4-byte sequences.
+ */
+static inline uint32_t _reencoder_utf8_max_code_point_from_first_byte(uint8_t first_byte);
+
 // ##### //
 // https://datatracker.ietf.org/doc/html/rfc3629
 // ##### //
@@ -82,11 +93,37 @@ ReencoderUnicodeStruct* reencoder_utf8_parse(const uint8_t* string) {
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] Yes
 
+	return reencoder_utf8_parse_arena(NULL, string);
+}
+
+ReencoderUnicodeStruct* reencoder_utf8_parse_arena(ReencoderArena* arena, const uint8_t* string) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_TRACE2(parse_entry, UTF_8, string);
+
 	// okay to cast a uint8_t to a char* for strlen here, since we are only looking for NULLs and don't care about lost data due to the sign bit
+	size_t string_size_bytes = strlen((const char*)string);
+
+	// characters are only counted in well-formed strings, counting skips whole sequences and would step over the null-terminator of a truncated one
+	// pure ASCII is one byte per character, so it is not counted at all
+	unsigned int char_flags = 0;
+	unsigned int string_validity = _reencoder_utf8_seq_is_valid(string, &char_flags);
+	size_t num_chars = 0;
+	if (string_validity == REENCODER_UTF8_VALID) {
+		num_chars = (char_flags & REENCODER_CHARS_ASCII) ? string_size_bytes : _reencoder_utf8_determine_num_chars(string);
+	}
+	_REENCODER_STATS_VALIDATED(UTF_8, string_size_bytes, string_validity);
+	_REENCODER_STATS_CALL_INPUT(string_size_bytes);
+
 	ReencoderUnicodeStruct* struct_utf8_str = _reencoder_unicode_struct_express_populate(
-		UTF_8, (const void*)string, strlen((const char*)string), _reencoder_utf8_seq_is_valid(string), _reencoder_utf8_determine_num_chars(string)
+		UTF_8, (const void*)string, string_size_bytes, string_validity, num_chars, char_flags, arena
 	);
 
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_PARSE);
+	_REENCODER_TRACE3(parse_return, UTF_8, string_size_bytes, string_validity);
+
 	return struct_utf8_str;
 }
 
@@ -146,13 +183,56 @@ unsigned int _reencoder_utf8_buffer_idx0_is_valid(const uint8_t* ptr, size_t uni
 	return _reencoder_utf8_char_is_valid(char_bytes, units_expected, units_actual);
 }
 
-unsigned int _reencoder_utf8_seq_is_valid(const uint8_t* string) {
+size_t _reencoder_utf8_valid_span(const uint8_t* string, size_t units_left, size_t* num_chars, uint8_t* max_leading_byte) {
+	// [Use Case] Internal Function (Non-static, Extern @ _common)
+	// [End-user Function Tested?] NA
+
+	size_t units_processed = 0;
+	size_t chars_counted = 0;
+
+	while (units_processed < units_left) {
+		// word-at-a-time fast path: 8 ASCII bytes, none of them null, are always 8 valid characters
+		// (b - 0x01) only sets the high bit of an ASCII byte b if b is 0x00
+		if (units_left - units_processed >= sizeof(uint64_t)) {
+			uint64_t word;
+			memcpy(&word, string + units_processed, sizeof(uint64_t));
+			if (((word | (word - 0x0101010101010101ULL)) & 0x8080808080808080ULL) == 0) {
+				units_processed += sizeof(uint64_t);
+				chars_counted += sizeof(uint64_t);
+				continue;
+			}
+		}
+
+		if (string[units_processed] == 0x00) {
+			break;
+		}
+
+		unsigned int units_read = 0;
+		if (_reencoder_utf8_buffer_idx0_is_valid(string + units_processed, units_left - units_processed, &units_read) != REENCODER_UTF8_VALID) {
+			break;
+		}
+		// bytes skipped by the fast path are ASCII, so only leading bytes checked one at a time can raise the maximum
+		if (max_leading_byte != NULL && string[units_processed] > *max_leading_byte) {
+			*max_leading_byte = string[units_processed];
+		}
+		units_processed += units_read;
+		chars_counted++;
+	}
+
+	*num_chars = chars_counted;
+
+	return units_processed;
+}
+
+unsigned int _reencoder_utf8_seq_is_valid(const uint8_t* string, unsigned int* char_flags) {
 	// [Use Case] Internal Function (Non-static, Extern @ _common)
 	// [End-user Function Tested?] NA
 
 	// okay to cast a uint8_t to a char* for strlen here, since we are only looking for NULLs and don't care about lost data due to the sign bit
 	size_t input_string_len = strlen((const char*)string);
 
+	// in a well-formed string, the largest leading byte tells the range of every character
+	uint8_t max_leading_byte = 0x00;
 	for (size_t i = 0; i < input_string_len;) {
 		unsigned int units_actual = 0;
 
@@ -161,9 +241,16 @@ unsigned int _reencoder_utf8_seq_is_valid(const uint8_t* string) {
 			return return_code;
 		}
 
+		if (string[i] > max_leading_byte) {
+			max_leading_byte = string[i];
+		}
 		i += units_actual;
 	}
 
+	if (char_flags != NULL) {
+		*char_flags = _reencoder_char_flags_from_max_code_point(_reencoder_utf8_max_code_point_from_first_byte(max_leading_byte));
+	}
+
 	return REENCODER_UTF8_VALID;
 }
 
@@ -271,6 +358,94 @@ unsigned int _reencoder_utf8_encode_from_code_point(uint8_t* buffer, size_t inde
 	}
 }
 
+unsigned int _reencoder_utf8_repair_to_buffer(const uint8_t* string, size_t num_bytes, void** output_buffer, size_t* output_buffer_size, size_t* output_buffer_index, size_t* num_chars, unsigned int* char_flags, size_t max_output_bytes) {
+	// [Use Case] Internal Function (Non-static, Extern @ _common)
+	// [End-user Function Tested?] NA
+
+	// most broken strings only have a few bad bytes, so size for the input and grow only when replacements add up
+	// a capped repair instead reserves its worst case (every byte replaced, or the cap if lower) plus one replacement of slack, and never grows
+	size_t reserve_bytes = num_bytes + sizeof(uint8_t);
+	if (max_output_bytes != SIZE_MAX) {
+		size_t worst_case_bytes = max_output_bytes / sizeof(_REENCODER_UTF8_REPLACEMENT_CHARACTER) > num_bytes ? num_bytes * sizeof(_REENCODER_UTF8_REPLACEMENT_CHARACTER) : max_output_bytes;
+		reserve_bytes = worst_case_bytes + sizeof(_REENCODER_UTF8_REPLACEMENT_CHARACTER) + sizeof(uint8_t);
+	}
+	uint8_t* output = (uint8_t*)_reencoder_context_reserve(output_buffer, output_buffer_size, reserve_bytes);
+	if (output == NULL) {
+		return REENCODER_REPAIR_FAILURE_OOM;
+	}
+
+	size_t units_processed = 0;
+	size_t output_index = 0;
+	size_t chars_counted = 0;
+	unsigned int null_found = 0;
+	uint8_t max_leading_byte = 0x00;
+
+	while (units_processed < num_bytes) {
+		// block-copy the valid run up to the next error (or null)
+		size_t span_chars = 0;
+		size_t span_units = _reencoder_utf8_valid_span(string + units_processed, num_bytes - units_processed, &span_chars, &max_leading_byte);
+		if (output_index + span_units > max_output_bytes) {
+			return REENCODER_REPAIR_FAILURE_TOO_LARGE;
+		}
+
+		// span + the replacement character (3 bytes, never more than 4 bytes read) + null-terminator
+		if (output_index + span_units + sizeof(_REENCODER_UTF8_REPLACEMENT_CHARACTER) + sizeof(uint8_t) > *output_buffer_size) {
+			output = (uint8_t*)_reencoder_context_reserve(
+				output_buffer, output_buffer_size, output_index + span_units + sizeof(_REENCODER_UTF8_REPLACEMENT_CHARACTER) + sizeof(uint8_t)
+			);
+			if (output == NULL) {
+				return REENCODER_REPAIR_FAILURE_OOM;
+			}
+		}
+
+		memcpy(output + output_index, string + units_processed, span_units);
+		output_index += span_units;
+		units_processed += span_units;
+		if (!null_found) {
+			chars_counted += span_chars;
+		}
+
+		if (units_processed >= num_bytes) {
+			break;
+		}
+
+		// span stopped on a null, which is valid and kept as-is, but ends the character count
+		if (string[units_processed] == 0x00) {
+			output[output_index++] = 0x00;
+			units_processed++;
+			null_found = 1;
+			continue;
+		}
+
+		// span stopped on a malformed sequence, replace it
+		unsigned int units_read = 0;
+		_reencoder_utf8_buffer_idx0_is_valid(string + units_processed, num_bytes - units_processed, &units_read);
+		memcpy(output + output_index, _REENCODER_UTF8_REPLACEMENT_CHARACTER, sizeof(_REENCODER_UTF8_REPLACEMENT_CHARACTER));
+		output_index += sizeof(_REENCODER_UTF8_REPLACEMENT_CHARACTER);
+		units_processed += units_read;
+		if (_REENCODER_UTF8_REPLACEMENT_CHARACTER[0] > max_leading_byte) {
+			max_leading_byte = _REENCODER_UTF8_REPLACEMENT_CHARACTER[0];
+		}
+		_REENCODER_STATS_ADD(replacements_inserted[UTF_8], 1);
+		if (!null_found) {
+			chars_counted++;
+		}
+	}
+
+	// the last replacement is only checked here, every earlier one is covered by the check at the top of the loop
+	if (output_index > max_output_bytes) {
+		return REENCODER_REPAIR_FAILURE_TOO_LARGE;
+	}
+
+	output[output_index] = 0x00;
+
+	*output_buffer_index = output_index;
+	*num_chars = chars_counted;
+	*char_flags = _reencoder_char_flags_from_max_code_point(_reencoder_utf8_max_code_point_from_first_byte(max_leading_byte));
+
+	return REENCODER_REPAIR_SUCCESS;
+}
+
 static inline unsigned int _reencoder_utf8_char_is_valid(uint8_t code_units[4], unsigned int units_expected, unsigned int* units_actual) {
 	// [Use Case] Internal Function (Static)
 	// [End-user Function Tested?] NA
@@ -410,3 +585,22 @@ static inline unsigned int _reencoder_utf8_validity_check_5_is_not_surrogate(uin
 	}
 	return 1;
 }
+
+
+static inline uint32_t _reencoder_utf8_max_code_point_from_first_byte(uint8_t first_byte) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// 110000xx carries the top 2 bits of an 8-bit code point, so 0xC2-0xC3 are the only 2-byte sequences within Latin-1
+	if (first_byte < 0x80) {
+		return first_byte;
+	}
+	else if (first_byte <= 0xC3) {
+		return 0x00FF;
+	}
+	else if (first_byte < 0xF0) {
+		return 0xFFFF;
+	}
+
+	return 0x10000;
+}
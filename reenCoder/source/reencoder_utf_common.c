@@ -1,5 +1,39 @@
 #include "../headers/reencoder_utf_common.h"
 
+/**
+ * @brief Copies UTF-16/UTF-32 code units from one buffer to another, reversing the byte order of each unit.
+ *
+ * @param[out] dest Buffer to be written to.
+ * @param[in] src Buffer to be read from. Must be aligned to the code unit size.
+ * @param[in] num_bytes Number of bytes to be copied. Must be a multiple of the code unit size.
+ * @param[in] string_type Encoding type of the units (UTF_16BE/UTF_16LE or UTF_32BE/UTF_32LE).
+ *
+ * @return void
+ */
+static void _reencoder_copy_swapped(uint8_t* dest, const uint8_t* src, size_t num_bytes, enum ReencoderEncodeType string_type);
+
+/**
+ * @brief Counts the characters of a well-formed string, skipping the scan where its REENCODER_CHARS_* flags make every code unit one character.
+ *
+ * @param[in] string_type Encoding type of string_buffer (UTF-8, UTF_16BE, UTF_16LE, UTF_32BE, or UTF_32LE).
+ * @param[in] string_buffer Pointer to well-formed, null-terminated code units in system endianness.
+ * @param[in] string_num_code_units Number of code units in string_buffer, excluding the null-terminator.
+ * @param[in] char_flags REENCODER_CHARS_* flags found while validating string_buffer.
+ *
+ * @return Number of characters in string_buffer.
+ */
+static size_t _reencoder_count_validated_chars(enum ReencoderEncodeType string_type, const void* string_buffer, size_t string_num_code_units, unsigned int char_flags);
+
+/**
+ * @brief Body of `reencoder_convert_ctx()` once its arguments are checked, so that the call can be timed as a whole.
+ */
+static ReencoderUnicodeStruct* _reencoder_convert_ctx_run(ReencoderContext* ctx, enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* source_uint_buffer);
+
+/**
+ * @brief Body of `reencoder_repair_struct_ctx()` once its arguments are checked, so that the call can be timed as a whole.
+ */
+static unsigned int _reencoder_repair_struct_ctx_run(ReencoderContext* ctx, ReencoderUnicodeStruct* unicode_struct);
+
 void reencoder_unicode_struct_free(ReencoderUnicodeStruct** unicode_struct) {
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] Yes
@@ -8,10 +42,11 @@ void reencoder_unicode_struct_free(ReencoderUnicodeStruct** unicode_struct) {
 		return;
 	}
 
-	if ((*unicode_struct)->string_buffer != NULL) {
-		free((*unicode_struct)->string_buffer);
+	// arena memory is only reclaimed by reencoder_arena_reset() or reencoder_arena_destroy()
+	if ((*unicode_struct)->arena == NULL) {
+		_reencoder_unicode_struct_release_buffer(*unicode_struct);
+		free(*unicode_struct);
 	}
-	free(*unicode_struct);
 
 	*unicode_struct = NULL;
 }
@@ -25,35 +60,149 @@ ReencoderUnicodeStruct* reencoder_unicode_struct_duplicate(ReencoderUnicodeStruc
 	}
 
 	// cannot use _reencoder_unicode_struct_express_populate, since that expects a uint16_t/uint32_t input for UTF-16/32
-	ReencoderUnicodeStruct* new_unicode_struct = _reencoder_unicode_struct_init(unicode_struct->string_type);
+	ReencoderUnicodeStruct* new_unicode_struct = _reencoder_unicode_struct_init(unicode_struct->string_type, NULL);
 	if (new_unicode_struct == NULL) {
 		return NULL;
 	}
-	// accomodate for null-terminator of different sizes
-	size_t null_terminator_size = 0;
-	if (unicode_struct->string_type == UTF_8) {
-		null_terminator_size = sizeof(uint8_t);
-	}
-	else if (unicode_struct->string_type == UTF_16BE || unicode_struct->string_type == UTF_16LE) {
-		null_terminator_size = sizeof(uint16_t);
-	}
-	else if (unicode_struct->string_type == UTF_32BE || unicode_struct->string_type == UTF_32LE) {
-		null_terminator_size = sizeof(uint32_t);
+
+	// heap buffers are shared instead of copied, the control block is only created on the first duplicate
+	if (unicode_struct->arena == NULL && unicode_struct->string_buffer != NULL) {
+		if (unicode_struct->shared == NULL) {
+			unicode_struct->shared = _reencoder_shared_buffer_create(unicode_struct->string_buffer, 1);
+			if (unicode_struct->shared == NULL) {
+				reencoder_unicode_struct_free(&new_unicode_struct);
+				return NULL;
+			}
+		}
+		_reencoder_shared_buffer_retain(unicode_struct->shared);
+
+		new_unicode_struct->string_buffer = unicode_struct->string_buffer;
+		new_unicode_struct->shared = unicode_struct->shared;
+		new_unicode_struct->capacity = unicode_struct->capacity;
 	}
-	new_unicode_struct->string_buffer = (uint8_t*)malloc(unicode_struct->num_bytes + null_terminator_size);
-	if (new_unicode_struct->string_buffer == NULL) {
-		reencoder_unicode_struct_free(&new_unicode_struct);
-		return NULL;
+	else {
+		// accomodate for null-terminator of different sizes
+		size_t null_terminator_size = _reencoder_code_unit_size(unicode_struct->string_type);
+		new_unicode_struct->string_buffer = (uint8_t*)malloc(unicode_struct->num_bytes + null_terminator_size);
+		if (new_unicode_struct->string_buffer == NULL) {
+			reencoder_unicode_struct_free(&new_unicode_struct);
+			return NULL;
+		}
+
+		memcpy(new_unicode_struct->string_buffer, unicode_struct->string_buffer, unicode_struct->num_bytes + null_terminator_size);
+		new_unicode_struct->capacity = unicode_struct->num_bytes + null_terminator_size;
 	}
 
-	memcpy(new_unicode_struct->string_buffer, unicode_struct->string_buffer, unicode_struct->num_bytes + null_terminator_size);
 	new_unicode_struct->num_bytes = unicode_struct->num_bytes;
 	new_unicode_struct->string_validity = unicode_struct->string_validity;
 	new_unicode_struct->num_chars = unicode_struct->num_chars;
+	new_unicode_struct->is_host_order = unicode_struct->is_host_order;
+	new_unicode_struct->char_flags = unicode_struct->char_flags;
 
 	return new_unicode_struct;
 }
 
+unsigned int reencoder_unicode_struct_shrink(ReencoderUnicodeStruct* unicode_struct) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (unicode_struct == NULL || unicode_struct->string_buffer == NULL) {
+		return REENCODER_SHRINK_FAILURE_NO_STRUCT;
+	}
+
+	size_t exact_bytes = unicode_struct->num_bytes + _reencoder_code_unit_size(unicode_struct->string_type);
+	if (unicode_struct->arena != NULL || unicode_struct->shared != NULL || unicode_struct->capacity <= exact_bytes) {
+		return REENCODER_SHRINK_FAILURE_NO_OP;
+	}
+
+	uint8_t* trimmed_buffer = (uint8_t*)realloc(unicode_struct->string_buffer, exact_bytes);
+	if (trimmed_buffer == NULL) {
+		return REENCODER_SHRINK_FAILURE_OOM;
+	}
+
+	unicode_struct->string_buffer = trimmed_buffer;
+	unicode_struct->capacity = exact_bytes;
+
+	return REENCODER_SHRINK_SUCCESS;
+}
+
+unsigned int reencoder_unicode_struct_materialize(ReencoderUnicodeStruct* unicode_struct) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (unicode_struct == NULL || unicode_struct->string_buffer == NULL) {
+		return REENCODER_MATERIALIZE_FAILURE_NO_STRUCT;
+	}
+	if (!unicode_struct->is_host_order) {
+		return REENCODER_MATERIALIZE_FAILURE_NO_OP;
+	}
+
+	// system byte order already matches string_type, only the tag has to go
+	if (_reencoder_unicode_struct_storage_type(unicode_struct) == unicode_struct->string_type) {
+		unicode_struct->is_host_order = 0;
+		return REENCODER_MATERIALIZE_SUCCESS;
+	}
+
+	if (!_reencoder_unicode_struct_make_unique(unicode_struct)) {
+		return REENCODER_MATERIALIZE_FAILURE_OOM;
+	}
+
+	// swapping reads each unit before overwriting it, so the buffer can be both source and destination
+	if (unicode_struct->string_type == UTF_16BE || unicode_struct->string_type == UTF_16LE) {
+		_reencoder_utf16_write_buffer_swap_endian(unicode_struct->string_buffer, (const uint16_t*)unicode_struct->string_buffer, unicode_struct->num_bytes / sizeof(uint16_t));
+	}
+	else {
+		_reencoder_utf32_write_buffer_swap_endian(unicode_struct->string_buffer, (const uint32_t*)unicode_struct->string_buffer, unicode_struct->num_bytes / sizeof(uint32_t));
+	}
+	unicode_struct->is_host_order = 0;
+
+	return REENCODER_MATERIALIZE_SUCCESS;
+}
+
+size_t reencoder_unicode_struct_char_offset(const ReencoderUnicodeStruct* unicode_struct, size_t char_index) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (unicode_struct == NULL || unicode_struct->string_buffer == NULL || char_index > unicode_struct->num_chars) {
+		return SIZE_MAX;
+	}
+	if (unicode_struct->string_validity != REENCODER_UTF8_VALID && unicode_struct->string_validity != REENCODER_UTF8_VALID_REPAIRED &&
+		unicode_struct->string_validity != REENCODER_UTF16_VALID && unicode_struct->string_validity != REENCODER_UTF16_VALID_REPAIRED &&
+		unicode_struct->string_validity != REENCODER_UTF32_VALID && unicode_struct->string_validity != REENCODER_UTF32_VALID_REPAIRED) {
+		return SIZE_MAX;
+	}
+
+	// one code unit per character, the offset is known without looking at the string
+	size_t code_unit_size = _reencoder_code_unit_size(unicode_struct->string_type);
+	if (code_unit_size == sizeof(uint32_t) ||
+		(code_unit_size == sizeof(uint16_t) && (unicode_struct->char_flags & REENCODER_CHARS_BMP)) ||
+		(code_unit_size == sizeof(uint8_t) && (unicode_struct->char_flags & REENCODER_CHARS_ASCII))) {
+		return char_index * code_unit_size;
+	}
+	if (char_index == unicode_struct->num_chars) {
+		return unicode_struct->num_bytes;
+	}
+
+	// otherwise count the first code unit of each character: any byte but a continuation byte, any unit but a low surrogate
+	// only the high byte of a UTF-16 unit tells a low surrogate apart, which is the first byte in big-endian storage
+	const uint8_t* string = unicode_struct->string_buffer;
+	size_t high_byte = (code_unit_size == sizeof(uint16_t) && _reencoder_unicode_struct_storage_type(unicode_struct) == UTF_16LE) ? 1 : 0;
+	size_t chars_seen = 0;
+	for (size_t offset = 0; offset < unicode_struct->num_bytes; offset += code_unit_size) {
+		unsigned int is_first_unit = code_unit_size == sizeof(uint8_t) ?
+			(string[offset] & 0xC0) != 0x80 : (string[offset + high_byte] & 0xFC) != 0xDC;
+		if (!is_first_unit) {
+			continue;
+		}
+		if (chars_seen == char_index) {
+			return offset;
+		}
+		chars_seen++;
+	}
+
+	return SIZE_MAX;
+}
+
 const char* reencoder_encode_type_as_str(unsigned int encode_type) {
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] No (not planned)
@@ -90,77 +239,49 @@ const char* reencoder_outcome_as_str(unsigned int outcome) {
 }
 
 ReencoderUnicodeStruct* reencoder_convert(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* source_uint_buffer) {
-	if ((source_encoding != UTF_8 && source_encoding != UTF_16BE && source_encoding != UTF_16LE && source_encoding != UTF_32BE && source_encoding != UTF_32LE) ||
-		(target_encoding != UTF_8 && target_encoding != UTF_16BE && target_encoding != UTF_16LE && target_encoding != UTF_32BE && target_encoding != UTF_32LE)) {
-		return NULL;
-	}
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] Yes
 
-	// gather information about the source string, then check if source_uint_buffer string is valid for specified source_encoding.
-	// if not, return a struct with source_encoding.
-	size_t string_num_code_units = 0;
-	size_t string_size_bytes = 0;
-	unsigned int input_buffer_validity = 0;
-	if (source_encoding == UTF_8) {
-		// okay to cast a uint8_t to a char* for strlen here, since we are only looking for NULLs and don't care about lost data due to the sign bit
-		string_num_code_units = strlen((const char*)source_uint_buffer);
-		string_size_bytes = string_num_code_units * sizeof(uint8_t);
-		input_buffer_validity = _reencoder_utf8_seq_is_valid((const uint8_t*)source_uint_buffer);
-		if (input_buffer_validity != REENCODER_UTF8_VALID) {
-			return _reencoder_unicode_struct_express_populate(
-				source_encoding, (const void*)source_uint_buffer, string_size_bytes, input_buffer_validity, 0
-			);
-		}
-	}
-	else if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
-		string_num_code_units = _reencoder_utf16_strlen((uint16_t*)source_uint_buffer);
-		string_size_bytes = string_num_code_units * sizeof(uint16_t);
-		input_buffer_validity = _reencoder_utf16_seq_is_valid((const uint16_t*)source_uint_buffer, string_num_code_units);
-		if (input_buffer_validity != REENCODER_UTF16_VALID) {
-			return _reencoder_unicode_struct_express_populate(
-				source_encoding, (const void*)source_uint_buffer, string_size_bytes, input_buffer_validity, 0
-			);
-		}
-	}
-	else if (source_encoding == UTF_32BE || source_encoding == UTF_32LE) {
-		string_num_code_units = _reencoder_utf32_strlen((uint32_t*)source_uint_buffer);
-		string_size_bytes = string_num_code_units * sizeof(uint32_t);
-		input_buffer_validity = _reencoder_utf32_seq_is_valid((const uint32_t*)source_uint_buffer, string_num_code_units);
-		if (input_buffer_validity != REENCODER_UTF32_VALID) {
-			return _reencoder_unicode_struct_express_populate(
-				source_encoding, (const void*)source_uint_buffer, string_size_bytes, input_buffer_validity, 0
-			);
-		}
-	}
+	return reencoder_convert_arena(NULL, source_encoding, target_encoding, source_uint_buffer);
+}
 
-	// change encoding, assumes input is well-formed, since we already checked earlier
-	size_t output_buffer_index = 0;
-	size_t output_buffer_size = 0;
-	void* output_buffer = NULL;
-
-	if (_reencoder_change_encoding_dynamic(
-		source_encoding, target_encoding, string_num_code_units,
-		&output_buffer_index, &output_buffer_size, source_uint_buffer, &output_buffer
-	) != REENCODER_CONVERT_SUCCESS) {
-		// guaranteed to not be null args, output_buffer_index, output_buffer_size, output_buffer addresses have been passed in and they exist on the stack
+ReencoderUnicodeStruct* reencoder_convert_arena(ReencoderArena* arena, enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* source_uint_buffer) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	_REENCODER_STATS_CALL_BEGIN();
+
+	ReencoderContext transient_ctx;
+	_reencoder_context_init_transient(&transient_ctx, arena);
+
+	ReencoderUnicodeStruct* output_struct = reencoder_convert_ctx(&transient_ctx, source_encoding, target_encoding, source_uint_buffer);
+
+	_reencoder_context_release(&transient_ctx);
+
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_CONVERT);
+
+	return output_struct;
+}
+
+ReencoderUnicodeStruct* reencoder_convert_ctx(ReencoderContext* ctx, enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* source_uint_buffer) {
+	if ((source_encoding != UTF_8 && source_encoding != UTF_16BE && source_encoding != UTF_16LE && source_encoding != UTF_32BE && source_encoding != UTF_32LE) ||
+		(target_encoding != UTF_8 && target_encoding != UTF_16BE && target_encoding != UTF_16LE && target_encoding != UTF_32BE && target_encoding != UTF_32LE)) {
 		return NULL;
 	}
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
 
-	// create struct
-	ReencoderUnicodeStruct* output_struct = NULL;
-	if (target_encoding == UTF_8) {
-		output_struct = reencoder_utf8_parse((uint8_t*)output_buffer);
-	}
-	else if (target_encoding == UTF_16BE || target_encoding == UTF_16LE) {
-		output_struct = reencoder_utf16_parse_uint16((uint16_t*)output_buffer, target_encoding);
-	}
-	else if (target_encoding == UTF_32BE || target_encoding == UTF_32LE) {
-		output_struct = reencoder_utf32_parse_uint32((uint32_t*)output_buffer, target_encoding);
+	if (ctx == NULL) {
+		return reencoder_convert_arena(NULL, source_encoding, target_encoding, source_uint_buffer);
 	}
 
-	// clean up other allocated memory
-	free(output_buffer);
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_TRACE3(convert_entry, source_encoding, target_encoding, source_uint_buffer);
+	ReencoderUnicodeStruct* output_struct = _reencoder_convert_ctx_run(ctx, source_encoding, target_encoding, source_uint_buffer);
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_CONVERT);
+	_REENCODER_TRACE4(
+		convert_return, source_encoding, target_encoding, output_struct == NULL ? 0 : output_struct->num_bytes, output_struct == NULL ? 0 : output_struct->string_validity
+	);
 
 	return output_struct;
 }
@@ -169,123 +290,39 @@ unsigned int reencoder_repair_struct(ReencoderUnicodeStruct* unicode_struct) {
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] Yes
 
-	if (unicode_struct == NULL) {
-		return REENCODER_REPAIR_FAILURE_NO_STRUCT;
-	}
+	_REENCODER_STATS_CALL_BEGIN();
 
-	if (unicode_struct->string_validity == REENCODER_UTF8_VALID || unicode_struct->string_validity == REENCODER_UTF8_VALID_REPAIRED ||
-		unicode_struct->string_validity == REENCODER_UTF16_VALID || unicode_struct->string_validity == REENCODER_UTF16_VALID_REPAIRED ||
-		unicode_struct->string_validity == REENCODER_UTF32_VALID || unicode_struct->string_validity == REENCODER_UTF32_VALID_REPAIRED) {
-		return REENCODER_REPAIR_FAILURE_NO_OP;
-	}
+	ReencoderContext transient_ctx;
+	_reencoder_context_init_transient(&transient_ctx, NULL);
 
-	size_t output_buffer_index = 0;
-	size_t output_buffer_size = 0;
-	void* output_buffer = NULL;
+	unsigned int repair_outcome = reencoder_repair_struct_ctx(&transient_ctx, unicode_struct);
 
-	void* source_uint_buffer = NULL;
-	enum ReencoderEncodeType source_encoding;
-	size_t string_num_code_units = 0;
-	size_t bytes_adjusted = 0;
+	_reencoder_context_release(&transient_ctx);
 
-	if (unicode_struct->string_type == UTF_8) {
-		source_uint_buffer = (uint8_t*)malloc(unicode_struct->num_bytes + sizeof(uint8_t));
-		if (source_uint_buffer == NULL) {
-			return REENCODER_REPAIR_FAILURE_OOM;
-		}
-		memcpy((uint8_t*)source_uint_buffer, unicode_struct->string_buffer, unicode_struct->num_bytes);
-		source_encoding = unicode_struct->string_type;
-		string_num_code_units = unicode_struct->num_bytes / sizeof(uint8_t);
-	}
-	else if (unicode_struct->string_type == UTF_16BE || unicode_struct->string_type == UTF_16LE) {
-		bytes_adjusted = unicode_struct->num_bytes + (unicode_struct->num_bytes % sizeof(uint16_t));
-		source_uint_buffer = (uint16_t*)malloc(bytes_adjusted + sizeof(uint16_t));
-		if (source_uint_buffer == NULL) {
-			return REENCODER_REPAIR_FAILURE_OOM;
-		}
-		_reencoder_utf16_uint16_from_uint8(
-			(uint16_t*)source_uint_buffer, unicode_struct->string_buffer, unicode_struct->num_bytes, unicode_struct->string_type
-		);
-		source_encoding = reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE;
-		string_num_code_units = unicode_struct->num_bytes / sizeof(uint16_t);
-	}
-	else if (unicode_struct->string_type == UTF_32BE || unicode_struct->string_type == UTF_32LE) {
-		bytes_adjusted = unicode_struct->num_bytes + (unicode_struct->num_bytes % sizeof(uint32_t));
-		source_uint_buffer = (uint32_t*)malloc(bytes_adjusted + sizeof(uint32_t));
-		if (source_uint_buffer == NULL) {
-			return REENCODER_REPAIR_FAILURE_OOM;
-		}
-		_reencoder_utf32_uint32_from_uint8(
-			(uint32_t*)source_uint_buffer, unicode_struct->string_buffer, unicode_struct->num_bytes, unicode_struct->string_type
-		);
-		source_encoding = reencoder_is_system_little_endian() ? UTF_32LE : UTF_32BE;
-		string_num_code_units = unicode_struct->num_bytes / sizeof(uint32_t);
-	}
-	else {
-		return REENCODER_REPAIR_FAILURE_NO_STRUCT;
-	}
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_REPAIR);
 
-	// change encoding, mistakes will be converted to the replacement character
-	if (_reencoder_change_encoding_dynamic(
-		source_encoding, source_encoding, string_num_code_units,
-		&output_buffer_index, &output_buffer_size, (const void*)source_uint_buffer, &output_buffer
-	) != REENCODER_CONVERT_SUCCESS) {
-		// guaranteed to not be null args, output_buffer_index, output_buffer_size, output_buffer addresses have been passed in and they exist on the stack
-		return REENCODER_REPAIR_FAILURE_OOM;
-	}
+	return repair_outcome;
+}
 
-	free(unicode_struct->string_buffer);
+unsigned int reencoder_repair_struct_ctx(ReencoderContext* ctx, ReencoderUnicodeStruct* unicode_struct) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
 
-	// assign new string buffer to og struct
-	// endianness of original string may have been swapped during the conversion to uint16/32_t
-	if (unicode_struct->string_type == UTF_8) {
-		unicode_struct->string_buffer = (uint8_t*)output_buffer;
-	}
-	else if (unicode_struct->string_type == UTF_16BE || unicode_struct->string_type == UTF_16LE) {
-		if (source_encoding == unicode_struct->string_type) {
-			unicode_struct->string_buffer = (uint8_t*)output_buffer; // can cast to uint8_t* since we are storing to a uint8_t* buffer
-		}
-		else {
-			unicode_struct->string_buffer = (uint8_t*)malloc(bytes_adjusted + sizeof(uint16_t));
-			if (unicode_struct->string_buffer == NULL) {
-				return REENCODER_REPAIR_FAILURE_OOM;
-			}
-			_reencoder_utf16_write_buffer_swap_endian(unicode_struct->string_buffer, (const uint16_t*)output_buffer, output_buffer_index);
-			free(output_buffer);
-		}
+	if (ctx == NULL) {
+		return reencoder_repair_struct(unicode_struct);
 	}
-	else if (unicode_struct->string_type == UTF_32BE || unicode_struct->string_type == UTF_32LE) {
-		if (source_encoding == unicode_struct->string_type) {
-			unicode_struct->string_buffer = (uint8_t*)output_buffer; // can cast to uint8_t* since we are storing to a uint8_t* buffer
-		}
-		else {
-			unicode_struct->string_buffer = (uint8_t*)malloc(bytes_adjusted + sizeof(uint32_t));
-			if (unicode_struct->string_buffer == NULL) {
-				return REENCODER_REPAIR_FAILURE_OOM;
-			}
-			_reencoder_utf32_write_buffer_swap_endian(unicode_struct->string_buffer, (const uint32_t*)output_buffer, output_buffer_index);
-			free(output_buffer);
-		}
+	if (unicode_struct == NULL) {
+		return REENCODER_REPAIR_FAILURE_NO_STRUCT;
 	}
 
-	// populate remaining unicode_struct fields
-	if (unicode_struct->string_type == UTF_8) {
-		unicode_struct->num_bytes = output_buffer_index * sizeof(uint8_t);
-		unicode_struct->num_chars = _reencoder_utf8_determine_num_chars((const uint8_t*)unicode_struct->string_buffer);
-		unicode_struct->string_validity = REENCODER_UTF8_VALID_REPAIRED;
-	}
-	else if (unicode_struct->string_type == UTF_16BE || unicode_struct->string_type == UTF_16LE) {
-		unicode_struct->num_bytes = output_buffer_index * sizeof(uint16_t);
-		unicode_struct->num_chars = _reencoder_utf16_determine_num_chars((const uint16_t*)unicode_struct->string_buffer);
-		unicode_struct->string_validity = REENCODER_UTF16_VALID_REPAIRED;
-	}
-	else if (unicode_struct->string_type == UTF_32BE || unicode_struct->string_type == UTF_32LE) {
-		unicode_struct->num_bytes = output_buffer_index * sizeof(uint32_t);
-		unicode_struct->num_chars = _reencoder_utf32_strlen((const uint32_t*)unicode_struct->string_buffer);
-		unicode_struct->string_validity = REENCODER_UTF32_VALID_REPAIRED;
-	}
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_STATS_CALL_INPUT(unicode_struct->num_bytes);
+	_REENCODER_TRACE3(repair_entry, unicode_struct->string_type, unicode_struct->num_bytes, unicode_struct->string_validity);
+	unsigned int repair_outcome = _reencoder_repair_struct_ctx_run(ctx, unicode_struct);
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_REPAIR);
+	_REENCODER_TRACE3(repair_return, unicode_struct->string_type, unicode_struct->num_bytes, repair_outcome);
 
-	return REENCODER_REPAIR_SUCCESS;
+	return repair_outcome;
 }
 
 size_t reencoder_write_to_buffer(ReencoderUnicodeStruct* unicode_struct, uint8_t* target_buffer, unsigned int write_bom) {
@@ -296,6 +333,10 @@ size_t reencoder_write_to_buffer(ReencoderUnicodeStruct* unicode_struct, uint8_t
 		return 0;
 
 	}
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_STATS_CALL_INPUT(unicode_struct->num_bytes);
+	_REENCODER_TRACE3(write_entry, unicode_struct->string_type, unicode_struct->num_bytes, write_bom);
+
 	size_t offset_bytes = 0;
 	if (write_bom) {
 		switch (unicode_struct->string_type) {
@@ -322,7 +363,16 @@ size_t reencoder_write_to_buffer(ReencoderUnicodeStruct* unicode_struct, uint8_t
 		}
 	}
 
-	memcpy(target_buffer + offset_bytes, unicode_struct->string_buffer, unicode_struct->num_bytes);
+	// host-order buffers are brought into the byte order of string_type while copying
+	if (_reencoder_unicode_struct_storage_type(unicode_struct) == unicode_struct->string_type) {
+		memcpy(target_buffer + offset_bytes, unicode_struct->string_buffer, unicode_struct->num_bytes);
+	}
+	else {
+		_reencoder_copy_swapped(target_buffer + offset_bytes, unicode_struct->string_buffer, unicode_struct->num_bytes, unicode_struct->string_type);
+	}
+
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_WRITE);
+	_REENCODER_TRACE2(write_return, unicode_struct->string_type, offset_bytes + unicode_struct->num_bytes);
 
 	return offset_bytes + unicode_struct->num_bytes;
 }
@@ -334,6 +384,9 @@ size_t reencoder_write_to_file(ReencoderUnicodeStruct* unicode_struct, FILE* fp_
 	if (fp_write_binary == NULL || unicode_struct == NULL || unicode_struct->string_buffer == NULL) {
 		return 0;
 	}
+	_REENCODER_STATS_CALL_BEGIN();
+	_REENCODER_STATS_CALL_INPUT(unicode_struct->num_bytes);
+	_REENCODER_TRACE3(write_entry, unicode_struct->string_type, unicode_struct->num_bytes, write_bom);
 
 	size_t offset_bytes = 0;
 	size_t num_bytes_written_bom = 0;
@@ -362,14 +415,31 @@ size_t reencoder_write_to_file(ReencoderUnicodeStruct* unicode_struct, FILE* fp_
 		}
 	}
 	if (num_bytes_written_bom != offset_bytes) {
+		_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_WRITE);
+		_REENCODER_TRACE2(write_return, unicode_struct->string_type, 0);
 		return 0; // failed to write BOM
 	}
 
 	size_t num_bytes_written = 0;
-	num_bytes_written = fwrite(unicode_struct->string_buffer, sizeof(uint8_t), unicode_struct->num_bytes, fp_write_binary);
+	if (_reencoder_unicode_struct_storage_type(unicode_struct) == unicode_struct->string_type) {
+		num_bytes_written = fwrite(unicode_struct->string_buffer, sizeof(uint8_t), unicode_struct->num_bytes, fp_write_binary);
+	}
+	else {
+		// host-order buffers are swapped chunk by chunk on the stack, so writing never allocates
+		uint8_t chunk[_REENCODER_WRITE_SWAP_CHUNK_SIZE];
+		for (size_t chunk_start = 0; chunk_start < unicode_struct->num_bytes; chunk_start += sizeof(chunk)) {
+			size_t chunk_bytes = unicode_struct->num_bytes - chunk_start < sizeof(chunk) ? unicode_struct->num_bytes - chunk_start : sizeof(chunk);
+
+			_reencoder_copy_swapped(chunk, unicode_struct->string_buffer + chunk_start, chunk_bytes, unicode_struct->string_type);
+			num_bytes_written += fwrite(chunk, sizeof(uint8_t), chunk_bytes, fp_write_binary);
+		}
+	}
+	_REENCODER_STATS_CALL_END(REENCODER_STATS_CALL_WRITE);
 	if (num_bytes_written != unicode_struct->num_bytes) {
+		_REENCODER_TRACE2(write_return, unicode_struct->string_type, 0);
 		return 0; // failed to write string buffer
 	}
+	_REENCODER_TRACE2(write_return, unicode_struct->string_type, num_bytes_written_bom + num_bytes_written);
 
 	return num_bytes_written_bom + num_bytes_written;
 }
@@ -378,19 +448,23 @@ uint8_t reencoder_is_system_little_endian(void) {
 	// [Use Case] End-user Function
 	// [End-user Function Tested?] No (not planned)
 
+#if defined(_REENCODER_SYSTEM_LITTLE_ENDIAN)
+	return _REENCODER_SYSTEM_LITTLE_ENDIAN;
+#else
 	// BE: 0x0102 -> 0x01 0x02
 	// LE: 0x0102 -> 0x02 0x01
 	uint16_t determinator = 0x0102;
 
 	// if first byte is 0x02, it's little-endian
 	return (*(uint8_t*)&determinator == 0x02);
+#endif
 }
 
-ReencoderUnicodeStruct* _reencoder_unicode_struct_init(enum ReencoderEncodeType string_type) {
+ReencoderUnicodeStruct* _reencoder_unicode_struct_init(enum ReencoderEncodeType string_type, ReencoderArena* arena) {
 	// [Use Case] Internal Function (Non-static ONLY)
 	// [End-user Function Tested?] NA
 
-	ReencoderUnicodeStruct* unicode_struct = (ReencoderUnicodeStruct*)malloc(sizeof(ReencoderUnicodeStruct));
+	ReencoderUnicodeStruct* unicode_struct = (ReencoderUnicodeStruct*)_reencoder_alloc(arena, sizeof(ReencoderUnicodeStruct));
 	if (unicode_struct == NULL) {
 		return NULL;
 	}
@@ -400,15 +474,20 @@ ReencoderUnicodeStruct* _reencoder_unicode_struct_init(enum ReencoderEncodeType
 	unicode_struct->string_validity = 0;
 	unicode_struct->num_chars = 0;
 	unicode_struct->num_bytes = 0;
+	unicode_struct->capacity = 0;
+	unicode_struct->arena = arena;
+	unicode_struct->shared = NULL;
+	unicode_struct->is_host_order = 0;
+	unicode_struct->char_flags = 0;
 
 	return unicode_struct;
 }
 
-ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum ReencoderEncodeType string_type, const void* string_buffer, size_t string_buffer_bytes, unsigned int string_validity, size_t num_chars) {
+ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum ReencoderEncodeType string_type, const void* string_buffer, size_t string_buffer_bytes, unsigned int string_validity, size_t num_chars, unsigned int char_flags, ReencoderArena* arena) {
 	// [Use Case] Internal Function (Non-static, Used in _8/16/32)
 	// [End-user Function Tested?] NA
 
-	ReencoderUnicodeStruct* unicode_struct = _reencoder_unicode_struct_init(string_type);
+	ReencoderUnicodeStruct* unicode_struct = _reencoder_unicode_struct_init(string_type, arena);
 	if (unicode_struct == NULL) {
 		return NULL;
 	}
@@ -416,7 +495,7 @@ ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum Reencode
 	// copy to buffer differently based on character type
 	switch (string_type) {
 	case UTF_8:
-		unicode_struct->string_buffer = (uint8_t*)malloc(string_buffer_bytes + sizeof(uint8_t));
+		unicode_struct->string_buffer = (uint8_t*)_reencoder_alloc(arena, string_buffer_bytes + sizeof(uint8_t));
 		if (unicode_struct->string_buffer == NULL) {
 			reencoder_unicode_struct_free(&unicode_struct);
 			return NULL;
@@ -427,13 +506,13 @@ ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum Reencode
 
 		break;
 	case UTF_16BE:
-		unicode_struct->string_buffer = (uint8_t*)malloc(string_buffer_bytes + sizeof(uint16_t));
+		unicode_struct->string_buffer = (uint8_t*)_reencoder_alloc(arena, string_buffer_bytes + sizeof(uint16_t));
 		if (unicode_struct->string_buffer == NULL) {
 			reencoder_unicode_struct_free(&unicode_struct);
 			return NULL;
 		}
 
-		if (!reencoder_is_system_little_endian()) {
+		if (!_REENCODER_IS_SYSTEM_LITTLE_ENDIAN()) {
 			memcpy(unicode_struct->string_buffer, (const uint16_t*)string_buffer, string_buffer_bytes);
 		}
 		else {
@@ -445,13 +524,13 @@ ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum Reencode
 
 		break;
 	case UTF_16LE:
-		unicode_struct->string_buffer = (uint8_t*)malloc(string_buffer_bytes + sizeof(uint16_t));
+		unicode_struct->string_buffer = (uint8_t*)_reencoder_alloc(arena, string_buffer_bytes + sizeof(uint16_t));
 		if (unicode_struct->string_buffer == NULL) {
 			reencoder_unicode_struct_free(&unicode_struct);
 			return NULL;
 		}
 
-		if (reencoder_is_system_little_endian()) {
+		if (_REENCODER_IS_SYSTEM_LITTLE_ENDIAN()) {
 			memcpy(unicode_struct->string_buffer, (const uint16_t*)string_buffer, string_buffer_bytes);
 		}
 		else {
@@ -463,36 +542,38 @@ ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum Reencode
 
 		break;
 	case UTF_32BE:
-		unicode_struct->string_buffer = (uint8_t*)malloc(string_buffer_bytes + sizeof(uint32_t));
+		unicode_struct->string_buffer = (uint8_t*)_reencoder_alloc(arena, string_buffer_bytes + sizeof(uint32_t));
 		if (unicode_struct->string_buffer == NULL) {
 			reencoder_unicode_struct_free(&unicode_struct);
 			return NULL;
 		}
 
-		if (!reencoder_is_system_little_endian()) {
+		if (!_REENCODER_IS_SYSTEM_LITTLE_ENDIAN()) {
 			memcpy(unicode_struct->string_buffer, (const uint32_t*)string_buffer, string_buffer_bytes);
 		}
 		else {
-			for (size_t i = 0; i < string_buffer_bytes / sizeof(uint32_t); i++) {
-				_reencoder_utf32_write_buffer_swap_endian(unicode_struct->string_buffer, (const uint32_t*)string_buffer, string_buffer_bytes / sizeof(uint32_t));
-			}
+			_reencoder_utf32_write_buffer_swap_endian(unicode_struct->string_buffer, (const uint32_t*)string_buffer, string_buffer_bytes / sizeof(uint32_t));
 		}
+
+		memset(unicode_struct->string_buffer + string_buffer_bytes, 0x00, sizeof(uint32_t));
+
 		break;
 	case UTF_32LE:
-		unicode_struct->string_buffer = (uint8_t*)malloc(string_buffer_bytes + sizeof(uint32_t));
+		unicode_struct->string_buffer = (uint8_t*)_reencoder_alloc(arena, string_buffer_bytes + sizeof(uint32_t));
 		if (unicode_struct->string_buffer == NULL) {
 			reencoder_unicode_struct_free(&unicode_struct);
 			return NULL;
 		}
 
-		if (reencoder_is_system_little_endian()) {
+		if (_REENCODER_IS_SYSTEM_LITTLE_ENDIAN()) {
 			memcpy(unicode_struct->string_buffer, (const uint32_t*)string_buffer, string_buffer_bytes);
 		}
 		else {
-			for (size_t i = 0; i < string_buffer_bytes / sizeof(uint32_t); i++) {
-				_reencoder_utf32_write_buffer_swap_endian(unicode_struct->string_buffer, (const uint32_t*)string_buffer, string_buffer_bytes / sizeof(uint32_t));
-			}
+			_reencoder_utf32_write_buffer_swap_endian(unicode_struct->string_buffer, (const uint32_t*)string_buffer, string_buffer_bytes / sizeof(uint32_t));
 		}
+
+		memset(unicode_struct->string_buffer + string_buffer_bytes, 0x00, sizeof(uint32_t));
+
 		break;
 	default:
 		reencoder_unicode_struct_free(&unicode_struct);
@@ -501,13 +582,15 @@ ReencoderUnicodeStruct* _reencoder_unicode_struct_express_populate(enum Reencode
 
 	unicode_struct->string_validity = string_validity;
 
-	// only populate num_chars if the string is valid
+	// only populate num_chars and char_flags if the string is valid
 	if ((string_type == UTF_8 && string_validity == REENCODER_UTF8_VALID) ||
 		((string_type == UTF_16BE || string_type == UTF_16LE) && string_validity == REENCODER_UTF16_VALID) ||
 		((string_type == UTF_32BE || string_type == UTF_32LE) && string_validity == REENCODER_UTF32_VALID)) {
 		unicode_struct->num_chars = num_chars;
+		unicode_struct->char_flags = char_flags;
 	}
 	unicode_struct->num_bytes = string_buffer_bytes;
+	unicode_struct->capacity = string_buffer_bytes + _reencoder_code_unit_size(string_type);
 
 	return unicode_struct;
 }
@@ -536,6 +619,7 @@ void* _reencoder_grow_buffer(void* buffer, size_t* buffer_size_bytes, unsigned i
 	}
 
 	*buffer_size_bytes = new_size;
+	_REENCODER_STATS_GROW(new_size);
 	return new_buffer;
 }
 
@@ -573,7 +657,166 @@ void* _reencoder_grow_buffer_dynamic(enum ReencoderEncodeType string_type, void*
 	return buffer;
 }
 
-unsigned int _reencoder_change_encoding_dynamic(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer) {
+void* _reencoder_context_detach_output(ReencoderContext* ctx, ReencoderArena* arena, size_t buffer_bytes, size_t* buffer_capacity) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	// a transient context is released right after the call, and a compact context does not keep its scratch buffer between calls,
+	// so in both cases the output buffer can be handed over without copying
+	if (ctx->is_transient || ctx->memory_policy == REENCODER_MEMORY_POLICY_COMPACT) {
+		// scratch buffers can be reserved for the worst case, so even without a compact policy a handed-over buffer is only allowed the slack growth would leave
+		// realloc to a smaller size only fails in exceptional cases, in which case the larger buffer is simply kept
+		unsigned int needs_trim = ctx->memory_policy == REENCODER_MEMORY_POLICY_COMPACT ?
+			ctx->scratch_output_size > buffer_bytes : ctx->scratch_output_size / _REENCODER_CONTEXT_GROW_RATE > buffer_bytes;
+		if (arena == NULL && needs_trim) {
+			void* trimmed_buffer = realloc(ctx->scratch_output, buffer_bytes);
+			if (trimmed_buffer != NULL) {
+				ctx->scratch_output = trimmed_buffer;
+				ctx->scratch_output_size = buffer_bytes;
+			}
+		}
+
+		// buffers adopted into an arena are copied at their exact size
+		*buffer_capacity = arena == NULL ? ctx->scratch_output_size : buffer_bytes;
+
+		void* buffer = _reencoder_adopt_buffer(arena, ctx->scratch_output, buffer_bytes);
+		ctx->scratch_output = NULL;
+		ctx->scratch_output_size = 0;
+		return buffer;
+	}
+
+	void* buffer = _reencoder_alloc(arena, buffer_bytes);
+	if (buffer != NULL) {
+		memcpy(buffer, ctx->scratch_output, buffer_bytes);
+	}
+	*buffer_capacity = buffer_bytes;
+
+	return buffer;
+}
+
+unsigned int _reencoder_unicode_struct_make_unique(ReencoderUnicodeStruct* unicode_struct) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (unicode_struct->shared == NULL) {
+		return 1;
+	}
+
+	// last reference, nobody else can observe the buffer anymore
+	if (_reencoder_shared_buffer_refcount(unicode_struct->shared) == 1) {
+		free(unicode_struct->shared);
+		unicode_struct->shared = NULL;
+		return 1;
+	}
+
+	size_t buffer_bytes = unicode_struct->num_bytes + _reencoder_code_unit_size(unicode_struct->string_type);
+	uint8_t* private_buffer = (uint8_t*)malloc(buffer_bytes);
+	if (private_buffer == NULL) {
+		return 0;
+	}
+	memcpy(private_buffer, unicode_struct->string_buffer, buffer_bytes);
+
+	// other references may have been dropped since the check above, release frees the buffer if this was the last one
+	_reencoder_shared_buffer_release(unicode_struct->shared);
+	unicode_struct->shared = NULL;
+	unicode_struct->string_buffer = private_buffer;
+	unicode_struct->capacity = buffer_bytes;
+
+	return 1;
+}
+
+void _reencoder_unicode_struct_release_buffer(ReencoderUnicodeStruct* unicode_struct) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (unicode_struct->shared != NULL) {
+		_reencoder_shared_buffer_release(unicode_struct->shared);
+	}
+	else {
+		_reencoder_free(unicode_struct->arena, unicode_struct->string_buffer);
+	}
+
+	unicode_struct->string_buffer = NULL;
+	unicode_struct->shared = NULL;
+}
+
+size_t _reencoder_code_unit_size(enum ReencoderEncodeType string_type) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	switch (string_type) {
+	case UTF_8:
+		return sizeof(uint8_t);
+	case UTF_16BE:
+	case UTF_16LE:
+		return sizeof(uint16_t);
+	case UTF_32BE:
+	case UTF_32LE:
+		return sizeof(uint32_t);
+	default:
+		return 0;
+	}
+}
+
+enum ReencoderEncodeType _reencoder_host_order_type(enum ReencoderEncodeType string_type) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	switch (string_type) {
+	case UTF_16BE:
+	case UTF_16LE:
+		return _REENCODER_IS_SYSTEM_LITTLE_ENDIAN() ? UTF_16LE : UTF_16BE;
+	case UTF_32BE:
+	case UTF_32LE:
+		return _REENCODER_IS_SYSTEM_LITTLE_ENDIAN() ? UTF_32LE : UTF_32BE;
+	default:
+		return string_type;
+	}
+}
+
+enum ReencoderEncodeType _reencoder_unicode_struct_storage_type(const ReencoderUnicodeStruct* unicode_struct) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (!unicode_struct->is_host_order) {
+		return unicode_struct->string_type;
+	}
+
+	return _reencoder_host_order_type(unicode_struct->string_type);
+}
+
+ReencoderUnicodeStruct* _reencoder_unicode_struct_tag_host_order(ReencoderUnicodeStruct* unicode_struct, enum ReencoderEncodeType logical_type) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (unicode_struct == NULL || logical_type == UTF_8) {
+		return unicode_struct;
+	}
+
+	unicode_struct->string_type = logical_type;
+	unicode_struct->is_host_order = 1;
+
+	return unicode_struct;
+}
+
+void* _reencoder_adopt_buffer(ReencoderArena* arena, void* heap_buffer, size_t buffer_bytes) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	if (arena == NULL) {
+		return heap_buffer;
+	}
+
+	void* arena_buffer = _reencoder_arena_alloc(arena, buffer_bytes);
+	if (arena_buffer != NULL) {
+		memcpy(arena_buffer, heap_buffer, buffer_bytes);
+	}
+	free(heap_buffer);
+
+	return arena_buffer;
+}
+
+unsigned int _reencoder_change_encoding_dynamic(enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, size_t string_num_code_units, size_t* output_buffer_index, size_t* output_buffer_size, const void* source_buffer, void** output_buffer, size_t max_output_bytes) {
 	// [Use Case] Internal Function (Non-static ONLY)
 	// [End-user Function Tested?] NA
 
@@ -581,6 +824,9 @@ unsigned int _reencoder_change_encoding_dynamic(enum ReencoderEncodeType source_
 		return REENCODER_CONVERT_FAILURE_NULL_ARGS;
 	}
 
+	// compare in target code units, so the loop does not multiply on every character
+	size_t max_output_units = max_output_bytes == SIZE_MAX ? SIZE_MAX : max_output_bytes / _reencoder_code_unit_size(target_encoding);
+
 	const void* ptr_read = source_buffer;
 	size_t units_processed = 0;
 	while (units_processed < string_num_code_units) {
@@ -638,6 +884,9 @@ unsigned int _reencoder_change_encoding_dynamic(enum ReencoderEncodeType source_
 			units_written = _reencoder_utf32_encode_from_code_point((uint32_t*)*output_buffer, *output_buffer_index, code_point);
 		}
 		(*output_buffer_index) += units_written;
+		if (*output_buffer_index > max_output_units) {
+			return REENCODER_CONVERT_FAILURE_TOO_LARGE;
+		}
 
 		units_processed += units_read;
 	}
@@ -678,3 +927,262 @@ unsigned int _reencoder_code_point_is_valid(const uint32_t code_point) {
 
 	return 1;
 }
+
+unsigned int _reencoder_char_flags_from_max_code_point(uint32_t max_code_point) {
+	// [Use Case] Internal Function (Used in _8/16/32 ONLY)
+	// [End-user Function Tested?] NA
+
+	if (max_code_point < 0x80) {
+		return REENCODER_CHARS_ASCII | REENCODER_CHARS_LATIN1 | REENCODER_CHARS_BMP;
+	}
+	if (max_code_point <= 0xFF) {
+		return REENCODER_CHARS_LATIN1 | REENCODER_CHARS_BMP;
+	}
+	if (max_code_point <= 0xFFFF) {
+		return REENCODER_CHARS_BMP;
+	}
+
+	return 0;
+}
+
+
+static void _reencoder_copy_swapped(uint8_t* dest, const uint8_t* src, size_t num_bytes, enum ReencoderEncodeType string_type) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (string_type == UTF_16BE || string_type == UTF_16LE) {
+		_reencoder_utf16_write_buffer_swap_endian(dest, (const uint16_t*)src, num_bytes / sizeof(uint16_t));
+	}
+	else if (string_type == UTF_32BE || string_type == UTF_32LE) {
+		_reencoder_utf32_write_buffer_swap_endian(dest, (const uint32_t*)src, num_bytes / sizeof(uint32_t));
+	}
+}
+
+static ReencoderUnicodeStruct* _reencoder_convert_ctx_run(ReencoderContext* ctx, enum ReencoderEncodeType source_encoding, enum ReencoderEncodeType target_encoding, const void* source_uint_buffer) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// gather information about the source string, then check if source_uint_buffer string is valid for specified source_encoding.
+	// if not, return a struct with source_encoding.
+	size_t string_num_code_units = 0;
+	size_t string_size_bytes = 0;
+	unsigned int input_buffer_validity = 0;
+	unsigned int char_flags = 0;
+	if (source_encoding == UTF_8) {
+		// okay to cast a uint8_t to a char* for strlen here, since we are only looking for NULLs and don't care about lost data due to the sign bit
+		string_num_code_units = strlen((const char*)source_uint_buffer);
+		string_size_bytes = string_num_code_units * sizeof(uint8_t);
+		input_buffer_validity = _reencoder_utf8_seq_is_valid((const uint8_t*)source_uint_buffer, &char_flags);
+		_REENCODER_STATS_CALL_INPUT(string_size_bytes);
+		_REENCODER_STATS_VALIDATED(source_encoding, string_size_bytes, input_buffer_validity);
+		if (input_buffer_validity != REENCODER_UTF8_VALID) {
+			return _reencoder_unicode_struct_express_populate(
+				source_encoding, (const void*)source_uint_buffer, string_size_bytes, input_buffer_validity, 0, 0, ctx->arena
+			);
+		}
+	}
+	else if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
+		string_num_code_units = _reencoder_utf16_strlen((uint16_t*)source_uint_buffer);
+		string_size_bytes = string_num_code_units * sizeof(uint16_t);
+		input_buffer_validity = _reencoder_utf16_seq_is_valid((const uint16_t*)source_uint_buffer, string_num_code_units, &char_flags);
+		_REENCODER_STATS_CALL_INPUT(string_size_bytes);
+		_REENCODER_STATS_VALIDATED(source_encoding, string_size_bytes, input_buffer_validity);
+		if (input_buffer_validity != REENCODER_UTF16_VALID) {
+			return _reencoder_unicode_struct_express_populate(
+				source_encoding, (const void*)source_uint_buffer, string_size_bytes, input_buffer_validity, 0, 0, ctx->arena
+			);
+		}
+	}
+	else if (source_encoding == UTF_32BE || source_encoding == UTF_32LE) {
+		string_num_code_units = _reencoder_utf32_strlen((uint32_t*)source_uint_buffer);
+		string_size_bytes = string_num_code_units * sizeof(uint32_t);
+		input_buffer_validity = _reencoder_utf32_seq_is_valid((const uint32_t*)source_uint_buffer, string_num_code_units, &char_flags);
+		_REENCODER_STATS_CALL_INPUT(string_size_bytes);
+		_REENCODER_STATS_VALIDATED(source_encoding, string_size_bytes, input_buffer_validity);
+		if (input_buffer_validity != REENCODER_UTF32_VALID) {
+			return _reencoder_unicode_struct_express_populate(
+				source_encoding, (const void*)source_uint_buffer, string_size_bytes, input_buffer_validity, 0, 0, ctx->arena
+			);
+		}
+	}
+
+	size_t max_output_bytes = _reencoder_context_output_limit(ctx, string_size_bytes);
+
+	// host-order storage builds UTF-16/32 results in system byte order and tags them with target_encoding afterwards
+	enum ReencoderEncodeType storage_encoding = ctx->host_order_storage ? _reencoder_host_order_type(target_encoding) : target_encoding;
+
+	// same code unit width, only the byte order (if anything) changes, so skip decoding and copy or swap the validated units as-is
+	if (_reencoder_code_unit_size(source_encoding) == _reencoder_code_unit_size(target_encoding)) {
+		if (string_size_bytes > max_output_bytes) {
+			return NULL;
+		}
+
+		size_t num_chars = _reencoder_count_validated_chars(source_encoding, source_uint_buffer, string_num_code_units, char_flags);
+		ReencoderUnicodeStruct* output_struct = _reencoder_unicode_struct_express_populate(
+			storage_encoding, source_uint_buffer, string_size_bytes, input_buffer_validity, num_chars, char_flags, ctx->arena
+		);
+		_REENCODER_STATS_ADD(tier_calls[REENCODER_STATS_TIER_COPY], 1);
+		_REENCODER_STATS_ADD(bytes_converted[source_encoding][target_encoding], string_size_bytes);
+
+		return ctx->host_order_storage ? _reencoder_unicode_struct_tag_host_order(output_struct, target_encoding) : output_struct;
+	}
+
+	// change encoding into the context's output scratch buffer, through the kernel that suits the input's character distribution
+	// the input is well-formed, since we already checked earlier, and the kernel reserves the worst case (up to the cap) once, so the conversion never reallocates
+	// if validation found only ASCII, Latin-1 or BMP characters where that makes decoding trivial, units are widened or narrowed directly instead
+	size_t output_buffer_index = 0;
+	unsigned int kernel = REENCODER_STATS_TIER_COPY;
+	unsigned int convert_outcome = 0;
+	if (_reencoder_kernel_has_trivial_path(source_encoding, target_encoding, char_flags)) {
+		convert_outcome = _reencoder_kernel_convert_trivial(
+			source_encoding, target_encoding, char_flags, string_num_code_units,
+			&output_buffer_index, &ctx->scratch_output_size, source_uint_buffer, &ctx->scratch_output, max_output_bytes
+		);
+	}
+	else {
+		convert_outcome = _reencoder_kernel_convert(
+			source_encoding, target_encoding, string_num_code_units,
+			&output_buffer_index, &ctx->scratch_output_size, source_uint_buffer, &ctx->scratch_output, max_output_bytes, &kernel
+		);
+	}
+	if (convert_outcome != REENCODER_CONVERT_SUCCESS) {
+		// guaranteed to not be null args, output_buffer_index and scratch buffer addresses have been passed in and they exist
+		return NULL;
+	}
+	_REENCODER_STATS_ADD(tier_calls[kernel], 1);
+	_REENCODER_STATS_ADD(bytes_converted[source_encoding][target_encoding], string_size_bytes);
+
+	// the output holds the same characters as the validated input, so it is valid and its count and flags carry over without parsing it again
+	// every UTF-32 output unit is one character, anything else is counted on the source
+	size_t num_chars = output_buffer_index;
+	if (target_encoding != UTF_32BE && target_encoding != UTF_32LE) {
+		num_chars = _reencoder_count_validated_chars(source_encoding, source_uint_buffer, string_num_code_units, char_flags);
+	}
+	size_t unit_size = _reencoder_code_unit_size(target_encoding);
+	size_t output_bytes = output_buffer_index * unit_size;
+
+	ReencoderUnicodeStruct* output_struct = _reencoder_unicode_struct_init(storage_encoding, ctx->arena);
+	if (output_struct == NULL) {
+		return NULL;
+	}
+
+	// the kernels write system byte order, so flip the scratch buffer first if the struct is stored the other way round
+	if (storage_encoding != _reencoder_host_order_type(storage_encoding)) {
+		_reencoder_copy_swapped((uint8_t*)ctx->scratch_output, (const uint8_t*)ctx->scratch_output, output_bytes, storage_encoding);
+	}
+
+	size_t output_capacity = 0;
+	output_struct->string_buffer = (uint8_t*)_reencoder_context_detach_output(ctx, ctx->arena, output_bytes + unit_size, &output_capacity);
+	if (output_struct->string_buffer == NULL) {
+		reencoder_unicode_struct_free(&output_struct);
+		return NULL;
+	}
+
+	output_struct->capacity = output_capacity;
+	output_struct->num_bytes = output_bytes;
+	output_struct->num_chars = num_chars;
+	output_struct->char_flags = char_flags;
+	if (target_encoding == UTF_8) {
+		output_struct->string_validity = REENCODER_UTF8_VALID;
+	}
+	else if (target_encoding == UTF_16BE || target_encoding == UTF_16LE) {
+		output_struct->string_validity = REENCODER_UTF16_VALID;
+	}
+	else {
+		output_struct->string_validity = REENCODER_UTF32_VALID;
+	}
+
+	return ctx->host_order_storage ? _reencoder_unicode_struct_tag_host_order(output_struct, target_encoding) : output_struct;
+}
+
+static unsigned int _reencoder_repair_struct_ctx_run(ReencoderContext* ctx, ReencoderUnicodeStruct* unicode_struct) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (unicode_struct->string_validity == REENCODER_UTF8_VALID || unicode_struct->string_validity == REENCODER_UTF8_VALID_REPAIRED ||
+		unicode_struct->string_validity == REENCODER_UTF16_VALID || unicode_struct->string_validity == REENCODER_UTF16_VALID_REPAIRED ||
+		unicode_struct->string_validity == REENCODER_UTF32_VALID || unicode_struct->string_validity == REENCODER_UTF32_VALID_REPAIRED) {
+		return REENCODER_REPAIR_FAILURE_NO_OP;
+	}
+
+	// UTF-16 and UTF-32 repairs keep the length of the string, so only UTF-8 can hit a cap of 100% or more
+	size_t max_output_bytes = _reencoder_context_output_limit(ctx, unicode_struct->num_bytes);
+	if (unicode_struct->string_type != UTF_8 && unicode_struct->num_bytes > max_output_bytes) {
+		return REENCODER_REPAIR_FAILURE_TOO_LARGE;
+	}
+
+	// UTF-16 and UTF-32 replace each bad unit with a single replacement unit, so the length never changes and the buffer is repaired in place
+	// a buffer shared with duplicates must not change under them though, so take a private copy first
+	if (unicode_struct->string_type != UTF_8 && !_reencoder_unicode_struct_make_unique(unicode_struct)) {
+		return REENCODER_REPAIR_FAILURE_OOM;
+	}
+	if (unicode_struct->string_type == UTF_16BE || unicode_struct->string_type == UTF_16LE) {
+		size_t string_num_code_units = unicode_struct->num_bytes / sizeof(uint16_t);
+
+		unicode_struct->num_chars = _reencoder_utf16_repair_in_place(unicode_struct->string_buffer, string_num_code_units, _reencoder_unicode_struct_storage_type(unicode_struct), &unicode_struct->char_flags);
+		unicode_struct->num_bytes = string_num_code_units * sizeof(uint16_t);
+		unicode_struct->string_validity = REENCODER_UTF16_VALID_REPAIRED;
+		_REENCODER_STATS_ADD(tier_calls[REENCODER_STATS_TIER_SCALAR], 1);
+
+		return REENCODER_REPAIR_SUCCESS;
+	}
+	if (unicode_struct->string_type == UTF_32BE || unicode_struct->string_type == UTF_32LE) {
+		size_t string_num_code_units = unicode_struct->num_bytes / sizeof(uint32_t);
+
+		unicode_struct->num_chars = _reencoder_utf32_repair_in_place(unicode_struct->string_buffer, string_num_code_units, _reencoder_unicode_struct_storage_type(unicode_struct), &unicode_struct->char_flags);
+		unicode_struct->num_bytes = string_num_code_units * sizeof(uint32_t);
+		unicode_struct->string_validity = REENCODER_UTF32_VALID_REPAIRED;
+		_REENCODER_STATS_ADD(tier_calls[REENCODER_STATS_TIER_SCALAR], 1);
+
+		return REENCODER_REPAIR_SUCCESS;
+	}
+	if (unicode_struct->string_type != UTF_8) {
+		return REENCODER_REPAIR_FAILURE_NO_STRUCT;
+	}
+
+	// UTF-8 replacements can be longer than the bytes they replace, so repair into the context's output scratch buffer
+	size_t output_buffer_index = 0;
+	size_t num_chars = 0;
+	unsigned int char_flags = 0;
+	unsigned int repair_outcome = _reencoder_utf8_repair_to_buffer(
+		unicode_struct->string_buffer, unicode_struct->num_bytes, &ctx->scratch_output, &ctx->scratch_output_size, &output_buffer_index, &num_chars, &char_flags, max_output_bytes
+	);
+	if (repair_outcome != REENCODER_REPAIR_SUCCESS) {
+		return repair_outcome;
+	}
+
+	// build the new string buffer before releasing the old one, so that the struct is left untouched on failure
+	size_t repaired_capacity = 0;
+	uint8_t* repaired_buffer = (uint8_t*)_reencoder_context_detach_output(ctx, unicode_struct->arena, (output_buffer_index + 1) * sizeof(uint8_t), &repaired_capacity);
+	if (repaired_buffer == NULL) {
+		return REENCODER_REPAIR_FAILURE_OOM;
+	}
+
+	// UTF-8 repair never writes to the old buffer, so a shared buffer is simply released instead of copied
+	_reencoder_unicode_struct_release_buffer(unicode_struct);
+	unicode_struct->string_buffer = repaired_buffer;
+	unicode_struct->capacity = repaired_capacity;
+
+	unicode_struct->num_bytes = output_buffer_index * sizeof(uint8_t);
+	unicode_struct->num_chars = num_chars;
+	unicode_struct->char_flags = char_flags;
+	unicode_struct->string_validity = REENCODER_UTF8_VALID_REPAIRED;
+	_REENCODER_STATS_ADD(tier_calls[REENCODER_STATS_TIER_WORD], 1);
+
+	return REENCODER_REPAIR_SUCCESS;
+}
+
+static size_t _reencoder_count_validated_chars(enum ReencoderEncodeType string_type, const void* string_buffer, size_t string_num_code_units, unsigned int char_flags) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	// every UTF-32 code unit is one character, and so is every unit of pure ASCII UTF-8 or surrogate-free UTF-16
+	if (string_type == UTF_8 && !(char_flags & REENCODER_CHARS_ASCII)) {
+		return _reencoder_utf8_determine_num_chars((const uint8_t*)string_buffer);
+	}
+	if ((string_type == UTF_16BE || string_type == UTF_16LE) && !(char_flags & REENCODER_CHARS_BMP)) {
+		return _reencoder_utf16_determine_num_chars((const uint16_t*)string_buffer);
+	}
+
+	return string_num_code_units;
+}
@@ -0,0 +1,336 @@
+#include "../headers/reencoder_validate.h"
+
+/**
+ * @brief Finds where a serial check would be at the first character starting at or after a given code unit, assuming everything before it is well-formed.
+ *
+ * @param[in] string_type Encoding type of the buffer.
+ * @param[in] buffer Buffer being checked, in system endianness for UTF-16/UTF-32.
+ * @param[in] num_code_units Length of the whole buffer in code units.
+ * @param[in] index Code unit index to re-synchronise from.
+ *
+ * @return Index of the first character starting at or after index.
+ */
+static size_t _reencoder_validate_resync(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t index);
+
+/**
+ * @brief Returns the number of code units a malformed sequence spans, matching what a repair replaces with one U+FFFD.
+ *
+ * @param[in] string_type Encoding type of the buffer.
+ * @param[in] buffer Buffer being scanned, in system endianness for UTF-16/UTF-32.
+ * @param[in] num_code_units Length of the whole buffer in code units.
+ * @param[in] index Code unit index of the malformed sequence.
+ *
+ * @return Number of code units in the malformed sequence, at least 1.
+ */
+static size_t _reencoder_validate_error_units(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t index);
+
+/**
+ * @brief Checks one chunk of a buffer. Matches `_ReencoderTaskFunction`.
+ *
+ * @param[in] job Pointer to the `_ReencoderValidateJob` of the call.
+ * @param[in] worker_index Index of the worker running the task.
+ * @param[in] task_index Index of the chunk.
+ *
+ * @return void
+ */
+static void _reencoder_validate_run_task(void* job, size_t worker_index, size_t task_index);
+
+unsigned int reencoder_validate(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t* error_offset) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	size_t unit_size = _reencoder_code_unit_size(string_type);
+	if (unit_size == 0) {
+		return REENCODER_VALIDATE_FAILURE_INVALID_TYPE;
+	}
+	if (buffer == NULL && num_code_units != 0) {
+		return REENCODER_VALIDATE_FAILURE_NULL_ARGS;
+	}
+
+	size_t error_index = num_code_units;
+	unsigned int outcome = _reencoder_validate_range(string_type, buffer, num_code_units, 0, num_code_units, &error_index);
+	_REENCODER_STATS_VALIDATED(string_type, num_code_units * unit_size, outcome);
+	_REENCODER_STATS_ADD(tier_calls[string_type == UTF_32BE || string_type == UTF_32LE ? REENCODER_STATS_TIER_SCALAR : REENCODER_STATS_TIER_WORD], 1);
+
+	if (error_offset != NULL) {
+		*error_offset = error_index * unit_size;
+	}
+
+	return outcome;
+}
+
+unsigned int reencoder_validate_parallel(ReencoderThreadPool* pool, enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t* error_offset) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	size_t unit_size = _reencoder_code_unit_size(string_type);
+	if (unit_size == 0 || buffer == NULL || pool == NULL || pool->num_workers <= 1) {
+		return reencoder_validate(string_type, buffer, num_code_units, error_offset);
+	}
+
+	size_t chunk_units = _REENCODER_VALIDATE_CHUNK_BYTES / unit_size;
+	size_t num_tasks = (num_code_units + chunk_units - 1) / chunk_units;
+
+	// a single chunk is not worth handing out, and failing to allocate the results only costs the speedup
+	unsigned int* outcomes = num_tasks > 1 ? (unsigned int*)malloc(num_tasks * (sizeof(size_t) + sizeof(unsigned int))) : NULL;
+	if (outcomes == NULL) {
+		return reencoder_validate(string_type, buffer, num_code_units, error_offset);
+	}
+
+	_ReencoderValidateJob job;
+	job.string_type = string_type;
+	job.buffer = buffer;
+	job.num_code_units = num_code_units;
+	job.chunk_units = chunk_units;
+	job.error_indices = (size_t*)outcomes;
+	job.outcomes = (unsigned int*)(job.error_indices + num_tasks);
+
+	_reencoder_thread_pool_run(pool, num_tasks, _reencoder_validate_run_task, &job);
+
+	// a chunk only starts at the right place if every chunk before it is well-formed, so the first failing chunk has the serial result
+	unsigned int outcome = 0;
+	size_t error_index = num_code_units;
+	for (size_t i = 0; i < num_tasks; i++) {
+		outcome = job.outcomes[i];
+		if (outcome != REENCODER_UTF8_VALID && outcome != REENCODER_UTF16_VALID && outcome != REENCODER_UTF32_VALID) {
+			error_index = job.error_indices[i];
+			break;
+		}
+	}
+
+	free(outcomes);
+
+	// counted once for the whole call on the calling thread, like the serial path
+	_REENCODER_STATS_VALIDATED(string_type, num_code_units * unit_size, outcome);
+	_REENCODER_STATS_ADD(tier_calls[string_type == UTF_32BE || string_type == UTF_32LE ? REENCODER_STATS_TIER_SCALAR : REENCODER_STATS_TIER_WORD], 1);
+
+	if (error_offset != NULL) {
+		*error_offset = error_index * unit_size;
+	}
+
+	return outcome;
+}
+
+ReencoderErrorReport* reencoder_scan_errors(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, unsigned int summary_only) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	size_t unit_size = _reencoder_code_unit_size(string_type);
+	if (unit_size == 0 || (buffer == NULL && num_code_units != 0)) {
+		return NULL;
+	}
+
+	ReencoderErrorReport* report = (ReencoderErrorReport*)malloc(sizeof(ReencoderErrorReport));
+	if (report == NULL) {
+		return NULL;
+	}
+
+	report->string_type = string_type;
+	report->num_errors = 0;
+	report->spans = NULL;
+	memset(report->histogram, 0x00, sizeof(report->histogram));
+
+	unsigned int parse_offset = string_type == UTF_8 ? _REENCODER_UTF8_PARSE_OFFSET :
+		(string_type == UTF_16BE || string_type == UTF_16LE) ? _REENCODER_UTF16_PARSE_OFFSET : _REENCODER_UTF32_PARSE_OFFSET;
+
+	size_t spans_capacity = 0;
+	size_t i = 0;
+	while (i < num_code_units) {
+		// each call skips the clean run up to the next malformed sequence
+		size_t error_index = num_code_units;
+		unsigned int outcome = _reencoder_validate_range(string_type, buffer, num_code_units, i, num_code_units, &error_index);
+		if (error_index >= num_code_units) {
+			break;
+		}
+
+		size_t error_units = _reencoder_validate_error_units(string_type, buffer, num_code_units, error_index);
+
+		report->num_errors++;
+		report->histogram[outcome - parse_offset]++;
+		_REENCODER_STATS_OUTCOME(outcome);
+
+		if (!summary_only) {
+			if (report->num_errors > spans_capacity) {
+				spans_capacity = spans_capacity == 0 ? _REENCODER_SCAN_BASE_SPAN_CAPACITY : spans_capacity * 2;
+				ReencoderErrorSpan* spans = (ReencoderErrorSpan*)realloc(report->spans, spans_capacity * sizeof(ReencoderErrorSpan));
+				if (spans == NULL) {
+					reencoder_error_report_free(&report);
+					return NULL;
+				}
+				report->spans = spans;
+			}
+
+			ReencoderErrorSpan* span = &report->spans[report->num_errors - 1];
+			span->offset = error_index * unit_size;
+			span->length = error_units * unit_size;
+			span->outcome = outcome;
+		}
+
+		i = error_index + error_units;
+	}
+	_REENCODER_STATS_ADD(bytes_validated[string_type], num_code_units * unit_size);
+	_REENCODER_STATS_ADD(tier_calls[string_type == UTF_32BE || string_type == UTF_32LE ? REENCODER_STATS_TIER_SCALAR : REENCODER_STATS_TIER_WORD], 1);
+
+	return report;
+}
+
+void reencoder_error_report_free(ReencoderErrorReport** report) {
+	// [Use Case] End-user Function
+	// [End-user Function Tested?] Yes
+
+	if (report == NULL || *report == NULL) {
+		return;
+	}
+
+	free((*report)->spans);
+	free(*report);
+
+	*report = NULL;
+}
+
+unsigned int _reencoder_validate_range(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t range_start, size_t range_end, size_t* error_index) {
+	// [Use Case] Internal Function (Non-static ONLY)
+	// [End-user Function Tested?] NA
+
+	size_t i = range_start;
+
+	if (string_type == UTF_8) {
+		const uint8_t* string_uint8 = (const uint8_t*)buffer;
+
+		while (i < range_end) {
+			// clean runs are skipped a word at a time, the span ends early at null bytes, malformed sequences, and characters crossing range_end
+			size_t num_chars = 0;
+			i += _reencoder_utf8_valid_span(string_uint8 + i, range_end - i, &num_chars, NULL);
+			if (i >= range_end) {
+				break;
+			}
+
+			// re-check against the whole buffer, a character crossing range_end is only malformed if it is truncated by the buffer itself
+			unsigned int units_read = 0;
+			unsigned int return_code = _reencoder_utf8_buffer_idx0_is_valid(string_uint8 + i, num_code_units - i, &units_read);
+			if (return_code != REENCODER_UTF8_VALID) {
+				*error_index = i;
+				return return_code;
+			}
+			i += units_read;
+		}
+
+		return REENCODER_UTF8_VALID;
+	}
+
+	if (string_type == UTF_16BE || string_type == UTF_16LE) {
+		const uint16_t* string_uint16 = (const uint16_t*)buffer;
+
+		while (i < range_end) {
+			// word-at-a-time fast path: 4 units, none of them a surrogate, are always 4 valid characters
+			// a unit is a surrogate if its top 5 bits are 11011, which turns its lane of tagged into 0x0000
+			if (range_end - i >= sizeof(uint64_t) / sizeof(uint16_t)) {
+				uint64_t word;
+				memcpy(&word, string_uint16 + i, sizeof(uint64_t));
+				uint64_t tagged = (word & 0xF800F800F800F800ULL) ^ 0xD800D800D800D800ULL;
+				if (((tagged - 0x0001000100010001ULL) & ~tagged & 0x8000800080008000ULL) == 0) {
+					i += sizeof(uint64_t) / sizeof(uint16_t);
+					continue;
+				}
+			}
+
+			unsigned int units_read = 0;
+			unsigned int return_code = _reencoder_utf16_buffer_idx0_is_valid(string_uint16 + i, num_code_units - i, &units_read);
+			if (return_code != REENCODER_UTF16_VALID) {
+				*error_index = i;
+				return return_code;
+			}
+			i += units_read;
+		}
+
+		return REENCODER_UTF16_VALID;
+	}
+
+	const uint32_t* string_uint32 = (const uint32_t*)buffer;
+
+	for (; i < range_end; i++) {
+		unsigned int return_code = _reencoder_utf32_buffer_idx0_is_valid(string_uint32 + i);
+		if (return_code != REENCODER_UTF32_VALID) {
+			*error_index = i;
+			return return_code;
+		}
+	}
+
+	return REENCODER_UTF32_VALID;
+}
+
+static size_t _reencoder_validate_resync(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t index) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	if (string_type == UTF_8) {
+		const uint8_t* string_uint8 = (const uint8_t*)buffer;
+
+		// the character holding the byte before index starts at most 3 bytes earlier, at its only non-continuation byte
+		size_t lookback_limit = index >= 4 ? index - 4 : 0;
+		for (size_t i = index; i > lookback_limit;) {
+			i--;
+			if ((string_uint8[i] & 0b11000000) == 0b10000000) {
+				continue;
+			}
+
+			size_t char_end = i + _reencoder_utf8_determine_length_from_first_byte(string_uint8[i]);
+			if (char_end <= index) {
+				return index;
+			}
+			return char_end < num_code_units ? char_end : num_code_units;
+		}
+
+		// only continuation bytes, so something before index is malformed and an earlier chunk reports it
+		return index;
+	}
+
+	if (string_type == UTF_16BE || string_type == UTF_16LE) {
+		// a high surrogate is always the first unit of a character, so it pairs with the unit at index
+		uint16_t previous_unit = ((const uint16_t*)buffer)[index - 1];
+		return (previous_unit & 0xFC00) == 0xD800 ? index + 1 : index;
+	}
+
+	return index;
+}
+
+static size_t _reencoder_validate_error_units(enum ReencoderEncodeType string_type, const void* buffer, size_t num_code_units, size_t index) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	unsigned int units_read = 0;
+	if (string_type == UTF_8) {
+		_reencoder_utf8_buffer_idx0_is_valid((const uint8_t*)buffer + index, num_code_units - index, &units_read);
+	}
+	else if (string_type == UTF_16BE || string_type == UTF_16LE) {
+		_reencoder_utf16_buffer_idx0_is_valid((const uint16_t*)buffer + index, num_code_units - index, &units_read);
+	}
+
+	// UTF-32 malformations are always a single unit
+	return units_read == 0 ? 1 : units_read;
+}
+
+static void _reencoder_validate_run_task(void* job, size_t worker_index, size_t task_index) {
+	// [Use Case] Internal Function (Static)
+	// [End-user Function Tested?] NA
+
+	(void)worker_index;
+
+	_ReencoderValidateJob* validate_job = (_ReencoderValidateJob*)job;
+
+	size_t range_start = task_index * validate_job->chunk_units;
+	size_t range_end = range_start + validate_job->chunk_units;
+	if (range_end > validate_job->num_code_units) {
+		range_end = validate_job->num_code_units;
+	}
+
+	// every chunk but the first starts where a serial check would be if everything before it is well-formed
+	if (range_start != 0) {
+		range_start = _reencoder_validate_resync(validate_job->string_type, validate_job->buffer, validate_job->num_code_units, range_start);
+	}
+
+	validate_job->error_indices[task_index] = range_end;
+	validate_job->outcomes[task_index] = _reencoder_validate_range(
+		validate_job->string_type, validate_job->buffer, validate_job->num_code_units, range_start, range_end, &validate_job->error_indices[task_index]
+	);
+}
@@ -12,39 +12,90 @@
 #define REENCODER_OUTPUT_FILE_NAME "reencoder.h"
 static const char* REENCODER_FILE_NAMES_ROOT[] = {
 	"headers/reencoder_cp_locale.h",
+	"headers/reencoder_arena.h",
+	"headers/reencoder_stats.h",
+	"headers/reencoder_trace.h",
+	"headers/reencoder_context.h",
+	"headers/reencoder_shared.h",
 	"headers/reencoder_utf_common.h",
 	"headers/reencoder_utf_8.h",
 	"headers/reencoder_utf_16.h",
 	"headers/reencoder_utf_32.h",
+	"headers/reencoder_kernel.h",
+	"headers/reencoder_thread_pool.h",
+	"headers/reencoder_batch.h",
+	"headers/reencoder_validate.h",
 	"source/reencoder_cp_locale.c",
+	"source/reencoder_arena.c",
+	"source/reencoder_stats.c",
+	"source/reencoder_context.c",
+	"source/reencoder_shared.c",
 	"source/reencoder_utf_common.c",
 	"source/reencoder_utf_8.c",
 	"source/reencoder_utf_16.c",
-	"source/reencoder_utf_32.c"
+	"source/reencoder_utf_32.c",
+	"source/reencoder_kernel.c",
+	"source/reencoder_thread_pool.c",
+	"source/reencoder_batch.c",
+	"source/reencoder_validate.c"
 };
 static const char* REENCODER_FILE_NAMES_FROM_TEST_DIR[] = {
 	"../headers/reencoder_cp_locale.h",
+	"../headers/reencoder_arena.h",
+	"../headers/reencoder_stats.h",
+	"../headers/reencoder_trace.h",
+	"../headers/reencoder_context.h",
+	"../headers/reencoder_shared.h",
 	"../headers/reencoder_utf_common.h",
 	"../headers/reencoder_utf_8.h",
 	"../headers/reencoder_utf_16.h",
 	"../headers/reencoder_utf_32.h",
+	"../headers/reencoder_kernel.h",
+	"../headers/reencoder_thread_pool.h",
+	"../headers/reencoder_batch.h",
+	"../headers/reencoder_validate.h",
 	"../source/reencoder_cp_locale.c",
+	"../source/reencoder_arena.c",
+	"../source/reencoder_stats.c",
+	"../source/reencoder_context.c",
+	"../source/reencoder_shared.c",
 	"../source/reencoder_utf_common.c",
 	"../source/reencoder_utf_8.c",
 	"../source/reencoder_utf_16.c",
-	"../source/reencoder_utf_32.c"
+	"../source/reencoder_utf_32.c",
+	"../source/reencoder_kernel.c",
+	"../source/reencoder_thread_pool.c",
+	"../source/reencoder_batch.c",
+	"../source/reencoder_validate.c"
 };
 static const char* REENCODER_FILE_NAMES_FROM_DEBUG[] = {
 	"../../reenCoder/headers/reencoder_cp_locale.h",
+	"../../reenCoder/headers/reencoder_arena.h",
+	"../../reenCoder/headers/reencoder_stats.h",
+	"../../reenCoder/headers/reencoder_trace.h",
+	"../../reenCoder/headers/reencoder_context.h",
+	"../../reenCoder/headers/reencoder_shared.h",
 	"../../reenCoder/headers/reencoder_utf_common.h",
 	"../../reenCoder/headers/reencoder_utf_8.h",
 	"../../reenCoder/headers/reencoder_utf_16.h",
 	"../../reenCoder/headers/reencoder_utf_32.h",
+	"../../reenCoder/headers/reencoder_kernel.h",
+	"../../reenCoder/headers/reencoder_thread_pool.h",
+	"../../reenCoder/headers/reencoder_batch.h",
+	"../../reenCoder/headers/reencoder_validate.h",
 	"../../reenCoder/source/reencoder_cp_locale.c",
+	"../../reenCoder/source/reencoder_arena.c",
+	"../../reenCoder/source/reencoder_stats.c",
+	"../../reenCoder/source/reencoder_context.c",
+	"../../reenCoder/source/reencoder_shared.c",
 	"../../reenCoder/source/reencoder_utf_common.c",
 	"../../reenCoder/source/reencoder_utf_8.c",
 	"../../reenCoder/source/reencoder_utf_16.c",
-	"../../reenCoder/source/reencoder_utf_32.c"
+	"../../reenCoder/source/reencoder_utf_32.c",
+	"../../reenCoder/source/reencoder_kernel.c",
+	"../../reenCoder/source/reencoder_thread_pool.c",
+	"../../reenCoder/source/reencoder_batch.c",
+	"../../reenCoder/source/reencoder_validate.c"
 };
 
 int main(void) {
@@ -78,13 +129,13 @@ int main(void) {
 		uint8_t buf_cwd[512] = { '\0' };
 		consolidator_get_working_dir(buf_cwd, 512);
 
-		if (!consolidator_main(REENCODER_OUTPUT_FILE_NAME, NULL, 10, REENCODER_FILE_NAMES_ROOT, 0, NULL)) {
+		if (!consolidator_main(REENCODER_OUTPUT_FILE_NAME, NULL, sizeof(REENCODER_FILE_NAMES_ROOT) / sizeof(REENCODER_FILE_NAMES_ROOT[0]), REENCODER_FILE_NAMES_ROOT, 0, NULL)) {
 			printf("Consolidated files written to %s at %s (Root).\n", REENCODER_OUTPUT_FILE_NAME, buf_cwd);
 		}
-		else if (!consolidator_main(REENCODER_OUTPUT_FILE_NAME, NULL, 10, REENCODER_FILE_NAMES_FROM_TEST_DIR, 0, NULL)) {
+		else if (!consolidator_main(REENCODER_OUTPUT_FILE_NAME, NULL, sizeof(REENCODER_FILE_NAMES_FROM_TEST_DIR) / sizeof(REENCODER_FILE_NAMES_FROM_TEST_DIR[0]), REENCODER_FILE_NAMES_FROM_TEST_DIR, 0, NULL)) {
 			printf("Consolidated files written to %s at %s (Test Dir).\n", REENCODER_OUTPUT_FILE_NAME, buf_cwd);
 		}
-		else if (!consolidator_main(REENCODER_OUTPUT_FILE_NAME, NULL, 10, REENCODER_FILE_NAMES_FROM_DEBUG, 0, NULL)) {
+		else if (!consolidator_main(REENCODER_OUTPUT_FILE_NAME, NULL, sizeof(REENCODER_FILE_NAMES_FROM_DEBUG) / sizeof(REENCODER_FILE_NAMES_FROM_DEBUG[0]), REENCODER_FILE_NAMES_FROM_DEBUG, 0, NULL)) {
 			printf("Consolidated files written to %s at %s (Debug Folder).\n", REENCODER_OUTPUT_FILE_NAME, buf_cwd);
 		}
 		else {
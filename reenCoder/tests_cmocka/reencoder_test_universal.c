@@ -1,5 +1,12 @@
 #include "reencoder_test_universal.h"
 
+/**
+ * @brief Feeds the calling thread's kernel history with text of a single class until it settles on the given kernel.
+ *
+ * The text is 8 characters of 'a' (_REENCODER_KERNEL_ASCII), U+0434 (_REENCODER_KERNEL_GENERAL) or U+1F170 (_REENCODER_KERNEL_SUPPLEMENTARY), in the code units of source_encoding.
+ */
+static void _reencoder_test_kernel_prime(enum ReencoderEncodeType source_encoding, unsigned int kernel);
+
 void _reencoder_test_free_struct(void** state) {
 	(void)state;
 
@@ -22,3 +29,1208 @@ void _reencoder_test_duplicate_struct(void** state) {
 	reencoder_unicode_struct_free(&struct_actual);
 	reencoder_unicode_struct_free(&struct_duplicate);
 }
+
+void _reencoder_test_duplicate_shares_buffer(void** state) {
+	(void)state;
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse(_reencoder_test_string_utf_8_valid_long_sequence);
+	assert_non_null(struct_actual);
+
+	ReencoderUnicodeStruct* struct_first = reencoder_unicode_struct_duplicate(struct_actual);
+	ReencoderUnicodeStruct* struct_second = reencoder_unicode_struct_duplicate(struct_first);
+	assert_non_null(struct_first);
+	assert_non_null(struct_second);
+	assert_ptr_equal(struct_first->string_buffer, struct_actual->string_buffer);
+	assert_ptr_equal(struct_second->shared, struct_actual->shared);
+	assert_int_equal(_reencoder_shared_buffer_refcount(struct_actual->shared), 3);
+
+	// the buffer outlives the struct it was parsed into
+	reencoder_unicode_struct_free(&struct_actual);
+	reencoder_unicode_struct_free(&struct_first);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_long_sequence, struct_second);
+
+	reencoder_unicode_struct_free(&struct_second);
+}
+
+void _reencoder_test_duplicate_copy_on_write(void** state) {
+	(void)state;
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf16_parse_uint8(
+		_reencoder_test_string_utf_16_repair_broken, _reencoder_test_struct_utf_16_repair_fixed.num_bytes - _reencoder_test_added_bytes_utf_16_u8le_repair_fixed, UTF_16LE, UTF_16LE
+	);
+	assert_non_null(struct_actual);
+	ReencoderUnicodeStruct* struct_duplicate = reencoder_unicode_struct_duplicate(struct_actual);
+	assert_non_null(struct_duplicate);
+
+	// in-place repair must detach the duplicate from the shared buffer, leaving the original untouched
+	assert_int_equal(reencoder_repair_struct(struct_duplicate), REENCODER_REPAIR_SUCCESS);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_16_repair_fixed, struct_duplicate);
+	assert_ptr_not_equal(struct_duplicate->string_buffer, struct_actual->string_buffer);
+	assert_null(struct_duplicate->shared);
+	assert_memory_equal(struct_actual->string_buffer, _reencoder_test_string_utf_16_repair_broken, struct_actual->num_bytes - sizeof(uint16_t));
+	assert_int_equal(struct_actual->string_validity, REENCODER_UTF16_ERR_ODD_LENGTH);
+
+	// the original now holds the last reference, so repairing it needs no copy
+	uint8_t* buffer_before = struct_actual->string_buffer;
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_ptr_equal(struct_actual->string_buffer, buffer_before);
+	assert_null(struct_actual->shared);
+
+	reencoder_unicode_struct_free(&struct_actual);
+	reencoder_unicode_struct_free(&struct_duplicate);
+}
+
+
+void _reencoder_test_arena_parse(void** state) {
+	(void)state;
+
+	ReencoderArena* arena = reencoder_arena_create(0);
+	assert_non_null(arena);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse_arena(arena, _reencoder_test_string_utf_8_valid_2_byte);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_2_byte, struct_actual);
+	assert_ptr_equal(struct_actual->arena, arena);
+
+	reencoder_unicode_struct_free(&struct_actual);
+	assert_null(struct_actual);
+
+	reencoder_arena_destroy(&arena);
+	assert_null(arena);
+}
+
+void _reencoder_test_arena_convert(void** state) {
+	(void)state;
+
+	ReencoderArena* arena = reencoder_arena_create(0);
+	assert_non_null(arena);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_convert_arena(
+		arena, reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE, UTF_8, _reencoder_test_string_utf_16_u16_valid_long_sequence
+	);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_long_sequence, struct_actual);
+	assert_ptr_equal(struct_actual->arena, arena);
+
+	reencoder_arena_destroy(&arena);
+}
+
+void _reencoder_test_arena_repair(void** state) {
+	(void)state;
+
+	ReencoderArena* arena = reencoder_arena_create(0);
+	assert_non_null(arena);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse_arena(arena, _reencoder_test_string_utf_8_repair_broken);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_repair_fixed, struct_actual);
+	assert_ptr_equal(struct_actual->arena, arena);
+
+	reencoder_arena_destroy(&arena);
+}
+
+void _reencoder_test_arena_reset_reuses_memory(void** state) {
+	(void)state;
+
+	ReencoderArena* arena = reencoder_arena_create(0);
+	assert_non_null(arena);
+
+	ReencoderUnicodeStruct* struct_first = reencoder_utf8_parse_arena(arena, _reencoder_test_string_utf_8_valid_1_byte);
+	assert_non_null(struct_first);
+
+	reencoder_arena_reset(arena);
+
+	ReencoderUnicodeStruct* struct_second = reencoder_utf8_parse_arena(arena, _reencoder_test_string_utf_8_valid_1_byte);
+	assert_ptr_equal(struct_first, struct_second);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_1_byte, struct_second);
+
+	reencoder_arena_destroy(&arena);
+}
+
+void _reencoder_test_arena_oversized_allocation(void** state) {
+	(void)state;
+
+	// chunks far smaller than the string force a dedicated chunk for the string buffer
+	ReencoderArena* arena = reencoder_arena_create(64);
+	assert_non_null(arena);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse_arena(arena, _reencoder_test_string_utf_8_valid_long_sequence);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_long_sequence, struct_actual);
+
+	reencoder_arena_reset(arena);
+
+	struct_actual = reencoder_utf8_parse_arena(arena, _reencoder_test_string_utf_8_valid_4_byte);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_4_byte, struct_actual);
+
+	reencoder_arena_destroy(&arena);
+}
+
+void _reencoder_test_context_convert_reuses_scratch(void** state) {
+	(void)state;
+
+	ReencoderContext* ctx = reencoder_context_create(NULL);
+	assert_non_null(ctx);
+
+	enum ReencoderEncodeType source_encoding = reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE;
+
+	ReencoderUnicodeStruct* struct_first = reencoder_convert_ctx(ctx, source_encoding, UTF_8, _reencoder_test_string_utf_16_u16_valid_long_sequence);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_long_sequence, struct_first);
+	void* scratch_first = ctx->scratch_output;
+	assert_non_null(scratch_first);
+
+	// same size input must not grow the scratch buffer again
+	ReencoderUnicodeStruct* struct_second = reencoder_convert_ctx(ctx, source_encoding, UTF_8, _reencoder_test_string_utf_16_u16_valid_long_sequence);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_long_sequence, struct_second);
+	assert_ptr_equal(ctx->scratch_output, scratch_first);
+	assert_ptr_not_equal(struct_first->string_buffer, struct_second->string_buffer);
+	assert_int_equal(struct_second->capacity, struct_second->num_bytes + 1);
+
+	// without a context the scratch buffer is handed over, but never with more slack than growth would leave
+	ReencoderUnicodeStruct* struct_transient = reencoder_convert(source_encoding, UTF_8, _reencoder_test_string_utf_16_u16_valid_long_sequence);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_valid_long_sequence, struct_transient);
+	assert_true(struct_transient->capacity <= (struct_transient->num_bytes + 1) * _REENCODER_CONTEXT_GROW_RATE);
+
+	reencoder_unicode_struct_free(&struct_first);
+	reencoder_unicode_struct_free(&struct_second);
+	reencoder_unicode_struct_free(&struct_transient);
+	reencoder_context_destroy(&ctx);
+	assert_null(ctx);
+}
+
+void _reencoder_test_context_repair(void** state) {
+	(void)state;
+
+	ReencoderContext* ctx = reencoder_context_create(NULL);
+	assert_non_null(ctx);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf16_parse_uint8_ctx(
+		ctx, _reencoder_test_string_utf_16_repair_broken, _reencoder_test_struct_utf_16_repair_fixed.num_bytes - _reencoder_test_added_bytes_utf_16_u8le_repair_fixed, UTF_16LE, UTF_16LE
+	);
+	assert_non_null(struct_actual);
+	assert_non_null(ctx->scratch_source);
+
+	assert_int_equal(reencoder_repair_struct_ctx(ctx, struct_actual), REENCODER_REPAIR_SUCCESS);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_16_repair_fixed, struct_actual);
+
+	reencoder_unicode_struct_free(&struct_actual);
+	reencoder_context_destroy(&ctx);
+}
+
+void _reencoder_test_context_parse_odd_length(void** state) {
+	(void)state;
+
+	ReencoderArena* arena = reencoder_arena_create(0);
+	assert_non_null(arena);
+	ReencoderContext* ctx = reencoder_context_create(arena);
+	assert_non_null(ctx);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf16_parse_uint8_ctx(
+		ctx, _reencoder_test_string_utf_16_u8le_odd_broken, _reencoder_test_struct_utf_16_odd_padded.num_bytes - _reencoder_test_added_bytes_utf_16_u8le_odd_padded, UTF_16LE, UTF_16LE
+	);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_16_odd_padded, struct_actual);
+	assert_ptr_equal(struct_actual->arena, arena);
+
+	reencoder_context_destroy(&ctx);
+	reencoder_arena_destroy(&arena);
+}
+
+void _reencoder_test_context_memory_policy(void** state) {
+	(void)state;
+
+	ReencoderContext* ctx = reencoder_context_create(NULL);
+	assert_non_null(ctx);
+
+	// fast: the result is copied out at its exact size and the scratch buffer is kept
+	ReencoderUnicodeStruct* struct_fast = reencoder_utf8_parse(_reencoder_test_string_utf_8_repair_broken);
+	assert_int_equal(reencoder_repair_struct_ctx(ctx, struct_fast), REENCODER_REPAIR_SUCCESS);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_repair_fixed, struct_fast);
+	assert_int_equal(struct_fast->capacity, struct_fast->num_bytes + sizeof(uint8_t));
+	assert_non_null(ctx->scratch_output);
+
+	// compact: the scratch buffer is handed over, trimmed to its exact size
+	reencoder_context_set_memory_policy(ctx, REENCODER_MEMORY_POLICY_COMPACT);
+	ReencoderUnicodeStruct* struct_compact = reencoder_utf8_parse(_reencoder_test_string_utf_8_repair_broken);
+	assert_int_equal(reencoder_repair_struct_ctx(ctx, struct_compact), REENCODER_REPAIR_SUCCESS);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_repair_fixed, struct_compact);
+	assert_int_equal(struct_compact->capacity, struct_compact->num_bytes + sizeof(uint8_t));
+	assert_null(ctx->scratch_output);
+
+	reencoder_unicode_struct_free(&struct_fast);
+	reencoder_unicode_struct_free(&struct_compact);
+	reencoder_context_destroy(&ctx);
+}
+
+void _reencoder_test_context_max_expansion(void** state) {
+	(void)state;
+
+	static const uint8_t all_invalid[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 };
+	static const uint16_t lone_surrogates[] = { 0xD800, 0x0061, 0xDC00, 0x0061, 0x0000 };
+	static const uint8_t ascii[] = { 0x61, 0x62, 0x63, 0x64, 0x00 };
+
+	ReencoderContext* ctx = reencoder_context_create(NULL);
+	assert_non_null(ctx);
+
+	// every byte becomes a 3-byte replacement character, so 200% is too little and the struct is left untouched
+	ReencoderUnicodeStruct* struct_utf_8 = reencoder_utf8_parse(all_invalid);
+	reencoder_context_set_max_expansion(ctx, 200);
+	assert_int_equal(reencoder_repair_struct_ctx(ctx, struct_utf_8), REENCODER_REPAIR_FAILURE_TOO_LARGE);
+	assert_int_equal(struct_utf_8->num_bytes, 10);
+	assert_int_equal(struct_utf_8->string_validity, REENCODER_UTF8_ERR_INVALID_LEAD);
+
+	reencoder_context_set_max_expansion(ctx, 300);
+	assert_int_equal(reencoder_repair_struct_ctx(ctx, struct_utf_8), REENCODER_REPAIR_SUCCESS);
+	assert_int_equal(struct_utf_8->num_bytes, 30);
+	assert_int_equal(struct_utf_8->num_chars, 10);
+
+	// UTF-16 repairs keep their length, so only caps below 100% stop them
+	ReencoderUnicodeStruct* struct_utf_16 = reencoder_utf16_parse_uint16(lone_surrogates, UTF_16LE);
+	reencoder_context_set_max_expansion(ctx, 50);
+	assert_int_equal(reencoder_repair_struct_ctx(ctx, struct_utf_16), REENCODER_REPAIR_FAILURE_TOO_LARGE);
+	reencoder_context_set_max_expansion(ctx, 100);
+	assert_int_equal(reencoder_repair_struct_ctx(ctx, struct_utf_16), REENCODER_REPAIR_SUCCESS);
+
+	// ASCII to UTF-32 quadruples in size
+	reencoder_context_set_max_expansion(ctx, 300);
+	assert_null(reencoder_convert_ctx(ctx, UTF_8, UTF_32LE, ascii));
+	reencoder_context_set_max_expansion(ctx, 400);
+	ReencoderUnicodeStruct* struct_utf_32 = reencoder_convert_ctx(ctx, UTF_8, UTF_32LE, ascii);
+	assert_non_null(struct_utf_32);
+	assert_int_equal(struct_utf_32->num_bytes, 16);
+
+	// 0 removes the cap
+	reencoder_context_set_max_expansion(ctx, 0);
+	ReencoderUnicodeStruct* struct_uncapped = reencoder_convert_ctx(ctx, UTF_8, UTF_32LE, ascii);
+	assert_non_null(struct_uncapped);
+	assert_int_equal(struct_uncapped->num_bytes, 16);
+
+	reencoder_unicode_struct_free(&struct_utf_8);
+	reencoder_unicode_struct_free(&struct_utf_16);
+	reencoder_unicode_struct_free(&struct_utf_32);
+	reencoder_unicode_struct_free(&struct_uncapped);
+	reencoder_context_destroy(&ctx);
+}
+
+void _reencoder_test_shrink_after_repair(void** state) {
+	(void)state;
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse(_reencoder_test_string_utf_8_repair_broken);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->capacity, struct_actual->num_bytes + sizeof(uint8_t));
+
+	// replacements make the string grow, so the repaired buffer carries slack from growth, but never more than growth itself leaves
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_true(struct_actual->capacity > struct_actual->num_bytes + sizeof(uint8_t));
+	assert_true(struct_actual->capacity <= (struct_actual->num_bytes + sizeof(uint8_t)) * _REENCODER_CONTEXT_GROW_RATE);
+
+	assert_int_equal(reencoder_unicode_struct_shrink(struct_actual), REENCODER_SHRINK_SUCCESS);
+	assert_int_equal(struct_actual->capacity, struct_actual->num_bytes + sizeof(uint8_t));
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_repair_fixed, struct_actual);
+
+	assert_int_equal(reencoder_unicode_struct_shrink(struct_actual), REENCODER_SHRINK_FAILURE_NO_OP);
+	assert_int_equal(reencoder_unicode_struct_shrink(NULL), REENCODER_SHRINK_FAILURE_NO_STRUCT);
+
+	reencoder_unicode_struct_free(&struct_actual);
+}
+
+void _reencoder_test_convert_batch(void** state) {
+	(void)state;
+
+	const void* inputs[] = {
+		_reencoder_test_string_utf_16_u16_valid_long_sequence,
+		_reencoder_test_string_utf_16_u16_only_high_surrogate,
+		NULL
+	};
+	enum ReencoderEncodeType source_encoding = reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE;
+
+	ReencoderBatch* batch = reencoder_convert_batch(source_encoding, UTF_8, inputs, NULL, 3);
+	assert_non_null(batch);
+	assert_int_equal(batch->string_type, UTF_8);
+	assert_int_equal(batch->num_strings, 3);
+
+	// valid string is converted in place within the shared buffer
+	assert_int_equal(batch->validity[0], REENCODER_UTF8_VALID);
+	assert_int_equal(batch->num_bytes[0], _reencoder_test_struct_utf_8_valid_long_sequence.num_bytes);
+	assert_int_equal(batch->num_chars[0], _reencoder_test_struct_utf_8_valid_long_sequence.num_chars);
+	assert_memory_equal(batch->buffer + batch->offsets[0], _reencoder_test_struct_utf_8_valid_long_sequence.string_buffer, batch->num_bytes[0]);
+	assert_int_equal(batch->buffer[batch->offsets[0] + batch->num_bytes[0]], 0x00);
+
+	// invalid string keeps its source outcome and is stored empty
+	assert_int_equal(batch->validity[1], REENCODER_UTF16_ERR_UNPAIRED_HIGH);
+	assert_int_equal(batch->num_bytes[1], 0);
+	assert_int_equal(batch->buffer[batch->offsets[1]], 0x00);
+
+	// NULL input is an empty, valid string
+	assert_int_equal(batch->validity[2], REENCODER_UTF8_VALID);
+	assert_int_equal(batch->num_bytes[2], 0);
+	assert_int_equal(batch->num_chars[2], 0);
+	assert_int_equal(batch->buffer_bytes, batch->offsets[2] + 1);
+
+	reencoder_batch_free(&batch);
+	assert_null(batch);
+}
+
+void _reencoder_test_convert_batch_lengths(void** state) {
+	(void)state;
+
+	const void* inputs[] = {
+		_reencoder_test_string_utf_16_u16_valid_2_byte,
+		_reencoder_test_string_utf_16_u16_valid_2_byte
+	};
+	const size_t lengths[] = { 31, _reencoder_test_struct_utf_16_valid_2_byte.num_bytes / sizeof(uint16_t) };
+	enum ReencoderEncodeType source_encoding = reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE;
+
+	ReencoderBatch* batch = reencoder_convert_batch(source_encoding, UTF_16BE, inputs, lengths, 2);
+	assert_non_null(batch);
+
+	// same code unit width, units are copied and swapped to the target byte order
+	assert_int_equal(batch->validity[0], REENCODER_UTF16_VALID);
+	assert_int_equal(batch->num_bytes[0], 62);
+	assert_int_equal(batch->num_chars[0], 31);
+	assert_memory_equal(batch->buffer + batch->offsets[0], _reencoder_test_string_utf_16_u8be_valid_2_byte, 62);
+
+	assert_int_equal(batch->validity[1], REENCODER_UTF16_VALID);
+	assert_int_equal(batch->offsets[1], 64);
+	assert_int_equal(batch->num_bytes[1], _reencoder_test_struct_utf_16_valid_2_byte.num_bytes);
+	assert_int_equal(batch->num_chars[1], _reencoder_test_struct_utf_16_valid_2_byte.num_chars);
+	assert_memory_equal(batch->buffer + batch->offsets[1], _reencoder_test_string_utf_16_u8be_valid_2_byte, batch->num_bytes[1]);
+
+	reencoder_batch_free(&batch);
+	assert_null(batch);
+}
+
+static void _reencoder_test_thread_pool_count_task(void* job, size_t worker_index, size_t task_index) {
+	(void)worker_index;
+
+	// every task owns its own slot, so no synchronisation is needed
+	((unsigned int*)job)[task_index]++;
+}
+
+void _reencoder_test_thread_pool_run(void** state) {
+	(void)state;
+
+	ReencoderThreadPool* pool = reencoder_thread_pool_create(4);
+	assert_non_null(pool);
+	assert_int_equal(pool->num_workers, 4);
+
+	// several runs on the same pool, each task must run exactly once
+	unsigned int task_runs[1000];
+	for (unsigned int run = 0; run < 3; run++) {
+		memset(task_runs, 0x00, sizeof(task_runs));
+		_reencoder_thread_pool_run(pool, 1000, _reencoder_test_thread_pool_count_task, task_runs);
+		for (size_t i = 0; i < 1000; i++) {
+			assert_int_equal(task_runs[i], 1);
+		}
+	}
+
+	reencoder_thread_pool_destroy(&pool);
+	assert_null(pool);
+}
+
+void _reencoder_test_convert_batch_pool(void** state) {
+	(void)state;
+
+	// long, short and invalid strings mixed so that workers end up with uneven tasks
+	const void* inputs[300];
+	size_t lengths[300];
+	for (size_t i = 0; i < 300; i++) {
+		if (i % 3 == 0) {
+			inputs[i] = _reencoder_test_string_utf_16_u16_valid_long_sequence;
+			lengths[i] = _reencoder_test_struct_utf_16_le_valid_long_sequence.num_bytes / sizeof(uint16_t);
+		}
+		else if (i % 3 == 1) {
+			inputs[i] = _reencoder_test_string_utf_16_u16_valid_2_byte;
+			lengths[i] = i % 31;
+		}
+		else {
+			inputs[i] = _reencoder_test_string_utf_16_u16_only_high_surrogate;
+			lengths[i] = 2;
+		}
+	}
+	enum ReencoderEncodeType source_encoding = reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE;
+
+	ReencoderThreadPool* pool = reencoder_thread_pool_create(4);
+	assert_non_null(pool);
+
+	for (unsigned int target_encoding = UTF_8; target_encoding <= UTF_32LE; target_encoding++) {
+		ReencoderBatch* batch_expected = reencoder_convert_batch(source_encoding, target_encoding, inputs, lengths, 300);
+		ReencoderBatch* batch_actual = reencoder_convert_batch_pool(pool, source_encoding, target_encoding, inputs, lengths, 300);
+		assert_non_null(batch_expected);
+		assert_non_null(batch_actual);
+
+		assert_int_equal(batch_actual->buffer_bytes, batch_expected->buffer_bytes);
+		for (size_t i = 0; i < 300; i++) {
+			assert_int_equal(batch_actual->validity[i], batch_expected->validity[i]);
+			assert_int_equal(batch_actual->num_chars[i], batch_expected->num_chars[i]);
+			assert_int_equal(batch_actual->num_bytes[i], batch_expected->num_bytes[i]);
+			assert_memory_equal(batch_actual->buffer + batch_actual->offsets[i], batch_expected->buffer + batch_expected->offsets[i], batch_expected->num_bytes[i] + 1);
+		}
+
+		reencoder_batch_free(&batch_expected);
+		reencoder_batch_free(&batch_actual);
+	}
+
+	reencoder_thread_pool_destroy(&pool);
+}
+
+void _reencoder_test_validate(void** state) {
+	(void)state;
+
+	size_t error_offset = 0;
+
+	assert_int_equal(reencoder_validate(UTF_8, _reencoder_test_string_utf_8_valid_long_sequence, _reencoder_test_struct_utf_8_valid_long_sequence.num_bytes, &error_offset), REENCODER_UTF8_VALID);
+	assert_int_equal(error_offset, _reencoder_test_struct_utf_8_valid_long_sequence.num_bytes);
+
+	// offsets point at the start of the malformed sequence
+	assert_int_equal(reencoder_validate(UTF_8, _reencoder_test_string_utf_8_invalid_lead, 43, &error_offset), REENCODER_UTF8_ERR_INVALID_LEAD);
+	assert_int_equal(error_offset, 34);
+	assert_int_equal(reencoder_validate(UTF_8, _reencoder_test_string_utf_8_truncated, 44, &error_offset), REENCODER_UTF8_ERR_PREMATURE_END);
+	assert_int_equal(error_offset, 42);
+	assert_int_equal(reencoder_validate(UTF_8, _reencoder_test_string_utf_8_invalid_cont, 53, &error_offset), REENCODER_UTF8_ERR_INVALID_CONT);
+	assert_int_equal(error_offset, 43);
+
+	// UTF-16/UTF-32 offsets are in bytes, not code units
+	assert_int_equal(reencoder_validate(UTF_16LE, _reencoder_test_string_utf_16_u16_valid_long_sequence, _reencoder_test_struct_utf_16_le_valid_long_sequence.num_bytes / sizeof(uint16_t), &error_offset), REENCODER_UTF16_VALID);
+	assert_int_equal(error_offset, _reencoder_test_struct_utf_16_le_valid_long_sequence.num_bytes);
+	assert_int_equal(reencoder_validate(UTF_16LE, _reencoder_test_string_utf_16_u16_only_high_surrogate, 40, &error_offset), REENCODER_UTF16_ERR_UNPAIRED_HIGH);
+	assert_int_equal(error_offset, 31 * sizeof(uint16_t));
+
+	const uint32_t string_utf_32_surrogate[] = { 0x00000041, 0x0001F600, 0x0000DC00, 0x00000041 };
+	assert_int_equal(reencoder_validate(UTF_32LE, string_utf_32_surrogate, 4, &error_offset), REENCODER_UTF32_ERR_SURROGATE);
+	assert_int_equal(error_offset, 2 * sizeof(uint32_t));
+
+	// error_offset is optional, and an empty buffer is well-formed
+	assert_int_equal(reencoder_validate(UTF_8, _reencoder_test_string_utf_8_invalid_lead, 43, NULL), REENCODER_UTF8_ERR_INVALID_LEAD);
+	assert_int_equal(reencoder_validate(UTF_32BE, NULL, 0, &error_offset), REENCODER_UTF32_VALID);
+	assert_int_equal(error_offset, 0);
+	assert_int_equal(reencoder_validate(UTF_8, NULL, 1, &error_offset), REENCODER_VALIDATE_FAILURE_NULL_ARGS);
+}
+
+static void* _reencoder_test_repeat_buffer(const void* unit, size_t unit_bytes, size_t min_bytes, size_t* total_bytes) {
+	size_t repeats = (min_bytes / unit_bytes) + 1;
+	uint8_t* buffer = (uint8_t*)malloc((repeats * unit_bytes) + sizeof(uint32_t));
+	assert_non_null(buffer);
+
+	for (size_t i = 0; i < repeats; i++) {
+		memcpy(buffer + (i * unit_bytes), unit, unit_bytes);
+	}
+	memset(buffer + (repeats * unit_bytes), 0x00, sizeof(uint32_t));
+
+	*total_bytes = repeats * unit_bytes;
+	return buffer;
+}
+
+void _reencoder_test_validate_parallel_utf_8(void** state) {
+	(void)state;
+
+	ReencoderThreadPool* pool = reencoder_thread_pool_create(4);
+	assert_non_null(pool);
+
+	// mostly multi-byte characters, so chunk boundaries land inside characters
+	size_t num_bytes = 0;
+	uint8_t* buffer = (uint8_t*)_reencoder_test_repeat_buffer(
+		_reencoder_test_string_utf_8_valid_long_sequence, _reencoder_test_struct_utf_8_valid_long_sequence.num_bytes, 3 * _REENCODER_VALIDATE_CHUNK_BYTES, &num_bytes
+	);
+
+	size_t error_offset = 0;
+	assert_int_equal(reencoder_validate_parallel(pool, UTF_8, buffer, num_bytes, &error_offset), REENCODER_UTF8_VALID);
+	assert_int_equal(error_offset, num_bytes);
+
+	// corrupt single bytes around chunk boundaries, the outcome and offset must match a serial check
+	const size_t corrupt_offsets[] = { _REENCODER_VALIDATE_CHUNK_BYTES - 1, _REENCODER_VALIDATE_CHUNK_BYTES, _REENCODER_VALIDATE_CHUNK_BYTES + 1, (2 * _REENCODER_VALIDATE_CHUNK_BYTES) + 2 };
+	const uint8_t corrupt_bytes[] = { 0x80, 0xFF, 0xC0, 0x00 };
+	for (size_t i = 0; i < sizeof(corrupt_offsets) / sizeof(corrupt_offsets[0]); i++) {
+		for (size_t j = 0; j < sizeof(corrupt_bytes); j++) {
+			uint8_t original_byte = buffer[corrupt_offsets[i]];
+			buffer[corrupt_offsets[i]] = corrupt_bytes[j];
+
+			size_t error_offset_expected = 0;
+			unsigned int outcome_expected = reencoder_validate_parallel(NULL, UTF_8, buffer, num_bytes, &error_offset_expected);
+			if (corrupt_bytes[j] != 0x00) {
+				assert_int_equal(outcome_expected, _reencoder_utf8_seq_is_valid(buffer, NULL));
+			}
+
+			assert_int_equal(reencoder_validate_parallel(pool, UTF_8, buffer, num_bytes, &error_offset), outcome_expected);
+			assert_int_equal(error_offset, error_offset_expected);
+
+			buffer[corrupt_offsets[i]] = original_byte;
+		}
+	}
+
+	// with errors in two chunks the earlier one wins
+	buffer[(2 * _REENCODER_VALIDATE_CHUNK_BYTES) + 5] = 0xFF;
+	buffer[_REENCODER_VALIDATE_CHUNK_BYTES + 5] = 0xFE;
+	assert_int_equal(reencoder_validate_parallel(pool, UTF_8, buffer, num_bytes, &error_offset), REENCODER_UTF8_ERR_INVALID_LEAD);
+	assert_int_equal(error_offset, _REENCODER_VALIDATE_CHUNK_BYTES + 5);
+
+	assert_int_equal(reencoder_validate_parallel(pool, UTF_8, NULL, 1, NULL), REENCODER_VALIDATE_FAILURE_NULL_ARGS);
+	assert_int_equal(reencoder_validate_parallel(pool, 99, buffer, num_bytes, NULL), REENCODER_VALIDATE_FAILURE_INVALID_TYPE);
+
+	free(buffer);
+	reencoder_thread_pool_destroy(&pool);
+}
+
+void _reencoder_test_validate_parallel_utf_16(void** state) {
+	(void)state;
+
+	ReencoderThreadPool* pool = reencoder_thread_pool_create(4);
+	assert_non_null(pool);
+
+	size_t num_bytes = 0;
+	uint16_t* buffer = (uint16_t*)_reencoder_test_repeat_buffer(
+		_reencoder_test_string_utf_16_u16_valid_long_sequence, _reencoder_test_struct_utf_16_le_valid_long_sequence.num_bytes, 3 * _REENCODER_VALIDATE_CHUNK_BYTES, &num_bytes
+	);
+	size_t num_units = num_bytes / sizeof(uint16_t);
+	size_t chunk_units = _REENCODER_VALIDATE_CHUNK_BYTES / sizeof(uint16_t);
+
+	// surrogate pair split across a chunk boundary is well-formed
+	buffer[chunk_units - 1] = 0xD83D;
+	buffer[chunk_units] = 0xDE00;
+	size_t error_offset = 0;
+	assert_int_equal(reencoder_validate_parallel(pool, UTF_16LE, buffer, num_units, &error_offset), REENCODER_UTF16_VALID);
+	assert_int_equal(error_offset, num_bytes);
+
+	// lone high surrogate right before the boundary
+	buffer[chunk_units] = 0x0041;
+	assert_int_equal(reencoder_validate_parallel(pool, UTF_16LE, buffer, num_units, &error_offset), _reencoder_utf16_seq_is_valid(buffer, num_units, NULL));
+	assert_int_equal(error_offset, (chunk_units - 1) * sizeof(uint16_t));
+
+	// lone low surrogate right at the boundary
+	buffer[chunk_units - 1] = 0x0041;
+	buffer[chunk_units] = 0xDE00;
+	assert_int_equal(reencoder_validate_parallel(pool, UTF_16LE, buffer, num_units, &error_offset), REENCODER_UTF16_ERR_UNPAIRED_LOW);
+	assert_int_equal(error_offset, chunk_units * sizeof(uint16_t));
+
+	// high surrogate ending the buffer
+	buffer[chunk_units] = 0x0041;
+	buffer[num_units - 1] = 0xD83D;
+	assert_int_equal(reencoder_validate_parallel(pool, UTF_16LE, buffer, num_units, &error_offset), REENCODER_UTF16_ERR_UNPAIRED_HIGH);
+	assert_int_equal(error_offset, (num_units - 1) * sizeof(uint16_t));
+
+	free(buffer);
+	reencoder_thread_pool_destroy(&pool);
+}
+
+void _reencoder_test_scan_errors(void** state) {
+	(void)state;
+
+	// A, lone continuation, B, lead followed by another lead (twice), C, overlong, D, out of range, truncated
+	const uint8_t string_utf_8_broken[] = { 0x41, 0x80, 0x42, 0xC2, 0xC0, 0x43, 0xE0, 0x80, 0x80, 0x44, 0xF4, 0x90, 0x80, 0x80, 0xE2, 0x82 };
+	const ReencoderErrorSpan spans_expected[] = {
+		{ 1, 1, REENCODER_UTF8_ERR_INVALID_LEAD },
+		{ 3, 1, REENCODER_UTF8_ERR_INVALID_CONT },
+		{ 4, 1, REENCODER_UTF8_ERR_INVALID_CONT },
+		{ 6, 3, REENCODER_UTF8_ERR_OVERLONG_3BYTE },
+		{ 10, 4, REENCODER_UTF8_ERR_OUT_OF_RANGE },
+		{ 14, 2, REENCODER_UTF8_ERR_PREMATURE_END }
+	};
+
+	ReencoderErrorReport* report = reencoder_scan_errors(UTF_8, string_utf_8_broken, sizeof(string_utf_8_broken), 0);
+	assert_non_null(report);
+	assert_int_equal(report->num_errors, 6);
+	for (size_t i = 0; i < 6; i++) {
+		assert_int_equal(report->spans[i].offset, spans_expected[i].offset);
+		assert_int_equal(report->spans[i].length, spans_expected[i].length);
+		assert_int_equal(report->spans[i].outcome, spans_expected[i].outcome);
+	}
+	assert_int_equal(report->histogram[REENCODER_UTF8_ERR_INVALID_CONT - _REENCODER_UTF8_PARSE_OFFSET], 2);
+	reencoder_error_report_free(&report);
+	assert_null(report);
+
+	// summary only keeps the counts
+	report = reencoder_scan_errors(UTF_8, string_utf_8_broken, sizeof(string_utf_8_broken), 1);
+	assert_non_null(report);
+	assert_int_equal(report->num_errors, 6);
+	assert_null(report->spans);
+	assert_int_equal(report->histogram[REENCODER_UTF8_VALID - _REENCODER_UTF8_PARSE_OFFSET], 0);
+	assert_int_equal(report->histogram[REENCODER_UTF8_ERR_INVALID_LEAD - _REENCODER_UTF8_PARSE_OFFSET], 1);
+	assert_int_equal(report->histogram[REENCODER_UTF8_ERR_OVERLONG_3BYTE - _REENCODER_UTF8_PARSE_OFFSET], 1);
+	assert_int_equal(report->histogram[REENCODER_UTF8_ERR_PREMATURE_END - _REENCODER_UTF8_PARSE_OFFSET], 1);
+	reencoder_error_report_free(&report);
+
+	// UTF-16 offsets and lengths are in bytes, a surrogate pair is well-formed
+	const uint16_t string_utf_16_broken[] = { 0x0041, 0xD800, 0x0042, 0xDC00, 0xD800, 0xDC00, 0xD800 };
+	report = reencoder_scan_errors(UTF_16LE, string_utf_16_broken, 7, 0);
+	assert_non_null(report);
+	assert_int_equal(report->num_errors, 3);
+	assert_int_equal(report->spans[0].offset, 2);
+	assert_int_equal(report->spans[0].length, 2);
+	assert_int_equal(report->spans[0].outcome, REENCODER_UTF16_ERR_UNPAIRED_HIGH);
+	assert_int_equal(report->spans[1].offset, 6);
+	assert_int_equal(report->spans[1].outcome, REENCODER_UTF16_ERR_UNPAIRED_LOW);
+	assert_int_equal(report->spans[2].offset, 12);
+	assert_int_equal(report->spans[2].outcome, REENCODER_UTF16_ERR_UNPAIRED_HIGH);
+	reencoder_error_report_free(&report);
+
+	// clean buffer has no errors at all
+	report = reencoder_scan_errors(UTF_8, _reencoder_test_string_utf_8_valid_long_sequence, _reencoder_test_struct_utf_8_valid_long_sequence.num_bytes, 0);
+	assert_non_null(report);
+	assert_int_equal(report->num_errors, 0);
+	assert_null(report->spans);
+	reencoder_error_report_free(&report);
+
+	assert_null(reencoder_scan_errors(99, string_utf_8_broken, sizeof(string_utf_8_broken), 0));
+	assert_null(reencoder_scan_errors(UTF_8, NULL, 1, 0));
+}
+
+#if defined(REENCODER_ENABLE_STATS)
+static void _reencoder_test_stats_validate_task(void* job, size_t worker_index, size_t task_index) {
+	(void)job;
+	(void)worker_index;
+	(void)task_index;
+
+	reencoder_validate(UTF_8, _reencoder_test_string_utf_8_valid_2_byte, sizeof(_reencoder_test_string_utf_8_valid_2_byte) - 1, NULL);
+}
+#endif
+
+void _reencoder_test_stats(void** state) {
+	(void)state;
+
+	ReencoderStats stats;
+	ReencoderStats stats_zero;
+	memset(&stats_zero, 0x00, sizeof(ReencoderStats));
+	assert_int_equal(reencoder_stats_get(NULL), 0);
+
+#if defined(REENCODER_ENABLE_STATS)
+	// counted before the reset, so it must not show up afterwards
+	ReencoderErrorReport* report = reencoder_scan_errors(UTF_8, _reencoder_test_string_utf_8_repair_broken, sizeof(_reencoder_test_string_utf_8_repair_broken) - 1, 1);
+	assert_non_null(report);
+	size_t num_errors = report->num_errors;
+	reencoder_error_report_free(&report);
+
+	reencoder_stats_reset();
+	assert_int_equal(reencoder_stats_get(&stats), 1);
+	assert_memory_equal(&stats, &stats_zero, sizeof(ReencoderStats));
+
+	// A, lone continuation, B
+	const uint8_t string_utf_8_broken[] = { 0x41, 0x80, 0x42 };
+	assert_int_equal(reencoder_validate(UTF_8, string_utf_8_broken, sizeof(string_utf_8_broken), NULL), REENCODER_UTF8_ERR_INVALID_LEAD);
+	reencoder_stats_get(&stats);
+	assert_int_equal(stats.bytes_validated[UTF_8], sizeof(string_utf_8_broken));
+	assert_int_equal(stats.malformed_inputs[0][REENCODER_UTF8_ERR_INVALID_LEAD - _REENCODER_UTF8_PARSE_OFFSET], 1);
+	assert_int_equal(stats.tier_calls[REENCODER_STATS_TIER_WORD], 1);
+
+	// same width is copied and pure ASCII is widened as-is, anything else goes through whichever conversion kernel the thread's history picks
+	ReencoderUnicodeStruct* struct_actual = reencoder_convert(UTF_8, UTF_8, _reencoder_test_string_utf_8_valid_1_byte);
+	assert_non_null(struct_actual);
+	reencoder_unicode_struct_free(&struct_actual);
+	struct_actual = reencoder_convert(UTF_8, UTF_32LE, _reencoder_test_string_utf_8_valid_1_byte);
+	assert_non_null(struct_actual);
+	reencoder_unicode_struct_free(&struct_actual);
+	struct_actual = reencoder_convert(UTF_8, UTF_32LE, _reencoder_test_string_utf_8_valid_3_byte);
+	assert_non_null(struct_actual);
+	reencoder_unicode_struct_free(&struct_actual);
+	reencoder_stats_get(&stats);
+	assert_int_equal(stats.bytes_converted[UTF_8][UTF_8], strlen((const char*)_reencoder_test_string_utf_8_valid_1_byte));
+	assert_int_equal(stats.bytes_converted[UTF_8][UTF_32LE], strlen((const char*)_reencoder_test_string_utf_8_valid_1_byte) + strlen((const char*)_reencoder_test_string_utf_8_valid_3_byte));
+	assert_int_equal(stats.tier_calls[REENCODER_STATS_TIER_COPY], 2);
+	assert_int_equal(stats.tier_calls[REENCODER_STATS_TIER_SCALAR] + stats.tier_calls[REENCODER_STATS_TIER_ASCII] + stats.tier_calls[REENCODER_STATS_TIER_SUPPLEMENTARY], 1);
+	assert_true(stats.buffer_grows > 0);
+	assert_true(stats.peak_buffer_bytes > 0);
+
+	// one replacement per malformed sequence
+	struct_actual = reencoder_utf8_parse(_reencoder_test_string_utf_8_repair_broken);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	reencoder_unicode_struct_free(&struct_actual);
+	reencoder_stats_get(&stats);
+	assert_int_equal(stats.replacements_inserted[UTF_8], num_errors);
+	assert_int_equal(stats.tier_calls[REENCODER_STATS_TIER_WORD], 2);
+
+	// workers exit when their pool is destroyed, their counts stay and the workers of the next pool take over their blocks
+	reencoder_stats_reset();
+	size_t num_blocks = _reencoder_stats_num_blocks();
+	for (size_t round = 1; round <= 3; round++) {
+		ReencoderThreadPool* pool = reencoder_thread_pool_create(4);
+		assert_non_null(pool);
+		_reencoder_thread_pool_run(pool, 100, _reencoder_test_stats_validate_task, NULL);
+		reencoder_thread_pool_destroy(&pool);
+
+		reencoder_stats_get(&stats);
+		assert_int_equal(stats.bytes_validated[UTF_8], round * 100 * (sizeof(_reencoder_test_string_utf_8_valid_2_byte) - 1));
+		assert_true(_reencoder_stats_num_blocks() <= num_blocks + 4);
+	}
+
+	reencoder_stats_reset();
+	reencoder_stats_get(&stats);
+	assert_memory_equal(&stats, &stats_zero, sizeof(ReencoderStats));
+#else
+	// compiled out, nothing is ever counted
+	memset(&stats, 0xFF, sizeof(ReencoderStats));
+	assert_int_equal(reencoder_stats_get(&stats), 0);
+	assert_memory_equal(&stats, &stats_zero, sizeof(ReencoderStats));
+	reencoder_stats_reset();
+#endif
+}
+
+void _reencoder_test_stats_histograms(void** state) {
+	(void)state;
+
+	// every value falls between the lower bounds of its bucket and the next
+	for (uint64_t value = 0; value < 4096; value++) {
+		size_t bucket = reencoder_stats_bucket_index(value);
+		assert_true(reencoder_stats_bucket_lower_bound(bucket) <= value);
+		assert_true(reencoder_stats_bucket_lower_bound(bucket + 1) > value);
+	}
+	assert_int_equal(reencoder_stats_bucket_index(UINT64_MAX), REENCODER_STATS_NUM_BUCKETS - 1);
+	assert_int_equal(reencoder_stats_bucket_lower_bound(reencoder_stats_bucket_index(1ULL << 40)), 1ULL << 40);
+
+	// percentiles report the largest value of their bucket
+	uint64_t histogram[REENCODER_STATS_NUM_BUCKETS];
+	memset(histogram, 0x00, sizeof(histogram));
+	assert_int_equal(reencoder_stats_percentile(histogram, 99.0), 0);
+	histogram[reencoder_stats_bucket_index(10)] = 99;
+	histogram[reencoder_stats_bucket_index(1000)] = 1;
+	assert_int_equal(reencoder_stats_percentile(histogram, 50.0), reencoder_stats_bucket_lower_bound(reencoder_stats_bucket_index(10) + 1) - 1);
+	assert_int_equal(reencoder_stats_percentile(histogram, 99.0), reencoder_stats_bucket_lower_bound(reencoder_stats_bucket_index(10) + 1) - 1);
+	assert_int_equal(reencoder_stats_percentile(histogram, 100.0), reencoder_stats_bucket_lower_bound(reencoder_stats_bucket_index(1000) + 1) - 1);
+
+	ReencoderStats stats;
+	reencoder_stats_get(&stats);
+
+#if defined(REENCODER_ENABLE_STATS)
+	reencoder_stats_reset();
+
+	// only the outermost entry point is recorded, not the parse a conversion does internally
+	size_t num_bytes = strlen((const char*)_reencoder_test_string_utf_8_valid_1_byte);
+	ReencoderUnicodeStruct* struct_actual = reencoder_convert(UTF_8, UTF_16LE, _reencoder_test_string_utf_8_valid_1_byte);
+	assert_non_null(struct_actual);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	struct_actual = reencoder_utf8_parse(_reencoder_test_string_utf_8_repair_broken);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	uint8_t buffer[256];
+	assert_int_equal(reencoder_write_to_buffer(struct_actual, buffer, 0), struct_actual->num_bytes);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	reencoder_stats_get(&stats);
+	assert_int_equal(stats.call_count[REENCODER_STATS_CALL_CONVERT], 1);
+	assert_int_equal(stats.call_count[REENCODER_STATS_CALL_PARSE], 1);
+	assert_int_equal(stats.call_count[REENCODER_STATS_CALL_REPAIR], 1);
+	assert_int_equal(stats.call_count[REENCODER_STATS_CALL_WRITE], 1);
+	assert_int_equal(stats.call_input_bytes_sum[REENCODER_STATS_CALL_CONVERT], num_bytes);
+	assert_int_equal(stats.call_input_bytes[REENCODER_STATS_CALL_CONVERT][reencoder_stats_bucket_index(num_bytes)], 1);
+	assert_int_equal(stats.call_input_bytes_sum[REENCODER_STATS_CALL_PARSE], sizeof(_reencoder_test_string_utf_8_repair_broken) - 1);
+	for (size_t i = 0; i < REENCODER_STATS_NUM_CALLS; i++) {
+		uint64_t latency_total = 0;
+		for (size_t j = 0; j < REENCODER_STATS_NUM_BUCKETS; j++) {
+			latency_total += stats.call_latency_ns[i][j];
+		}
+		assert_int_equal(latency_total, 1);
+	}
+#endif
+
+	// both dumps are written in full, whether or not anything was counted
+	FILE* fp_tmp = tmpfile();
+	if (fp_tmp == NULL) {
+		fail_msg("%s", _REENCODER_TEST_FAIL_STRINGS[_REENCODER_TEST_FAIL_TEMP_FILE]);
+	}
+
+	char line[512];
+	unsigned int found = 0;
+	assert_int_equal(reencoder_stats_dump(&stats, fp_tmp, REENCODER_STATS_DUMP_TEXT), 1);
+	rewind(fp_tmp);
+	while (fgets(line, sizeof(line), fp_tmp) != NULL) {
+		found |= strncmp(line, "reencoder_call_latency_ns_count{call=\"convert\"}", strlen("reencoder_call_latency_ns_count{call=\"convert\"}")) == 0;
+	}
+	assert_true(found);
+
+	rewind(fp_tmp);
+	assert_int_equal(reencoder_stats_dump(&stats, fp_tmp, REENCODER_STATS_DUMP_JSON), 1);
+	rewind(fp_tmp);
+	assert_non_null(fgets(line, sizeof(line), fp_tmp));
+	assert_int_equal(line[0], '{');
+
+	assert_int_equal(reencoder_stats_dump(&stats, fp_tmp, 99), 0);
+	assert_int_equal(reencoder_stats_dump(NULL, fp_tmp, REENCODER_STATS_DUMP_JSON), 0);
+
+	fclose(fp_tmp);
+}
+
+void _reencoder_test_kernel_select(void** state) {
+	(void)state;
+
+	// each class of text settles on its own kernel, whatever the thread converted before
+	for (size_t i = 0; i < 16; i++) {
+		_reencoder_kernel_select(UTF_8, _reencoder_test_string_utf_8_valid_1_byte, sizeof(_reencoder_test_string_utf_8_valid_1_byte) - 1);
+	}
+	assert_int_equal(_reencoder_kernel_select(UTF_8, _reencoder_test_string_utf_8_valid_1_byte, sizeof(_reencoder_test_string_utf_8_valid_1_byte) - 1), _REENCODER_KERNEL_ASCII);
+	for (size_t i = 0; i < 16; i++) {
+		_reencoder_kernel_select(UTF_8, _reencoder_test_string_utf_8_valid_2_byte, sizeof(_reencoder_test_string_utf_8_valid_2_byte) - 1);
+	}
+	assert_int_equal(_reencoder_kernel_select(UTF_8, _reencoder_test_string_utf_8_valid_2_byte, sizeof(_reencoder_test_string_utf_8_valid_2_byte) - 1), _REENCODER_KERNEL_GENERAL);
+	for (size_t i = 0; i < 16; i++) {
+		_reencoder_kernel_select(UTF_8, _reencoder_test_string_utf_8_valid_4_byte, sizeof(_reencoder_test_string_utf_8_valid_4_byte) - 1);
+	}
+	assert_int_equal(_reencoder_kernel_select(UTF_8, _reencoder_test_string_utf_8_valid_4_byte, sizeof(_reencoder_test_string_utf_8_valid_4_byte) - 1), _REENCODER_KERNEL_SUPPLEMENTARY);
+	for (size_t i = 0; i < 16; i++) {
+		_reencoder_kernel_select(UTF_16LE, _reencoder_test_string_utf_16_u16_valid_4_byte, (sizeof(_reencoder_test_string_utf_16_u16_valid_4_byte) / sizeof(uint16_t)) - 1);
+	}
+	assert_int_equal(_reencoder_kernel_select(UTF_16LE, _reencoder_test_string_utf_16_u16_valid_4_byte, (sizeof(_reencoder_test_string_utf_16_u16_valid_4_byte) / sizeof(uint16_t)) - 1), _REENCODER_KERNEL_SUPPLEMENTARY);
+
+	// histories are kept per source encoding, so the UTF-8 one is left alone
+	assert_int_equal(_reencoder_kernel_select(UTF_8, _reencoder_test_string_utf_8_valid_4_byte, sizeof(_reencoder_test_string_utf_8_valid_4_byte) - 1), _REENCODER_KERNEL_SUPPLEMENTARY);
+
+	// 85% ASCII sits between the thresholds to enter and leave the ASCII kernel, so it keeps whichever kernel the thread was already on
+	const uint8_t string_utf_8_mostly_ascii[] = {
+		0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0xd0, 0xb4, 0xd0, 0xb4, 0xd0, 0xb4, 0x00
+	};
+	_reencoder_test_kernel_prime(UTF_8, _REENCODER_KERNEL_ASCII);
+	for (size_t i = 0; i < 16; i++) {
+		assert_int_equal(_reencoder_kernel_select(UTF_8, string_utf_8_mostly_ascii, sizeof(string_utf_8_mostly_ascii) - 1), _REENCODER_KERNEL_ASCII);
+	}
+	_reencoder_test_kernel_prime(UTF_8, _REENCODER_KERNEL_GENERAL);
+	for (size_t i = 0; i < 16; i++) {
+		assert_int_equal(_reencoder_kernel_select(UTF_8, string_utf_8_mostly_ascii, sizeof(string_utf_8_mostly_ascii) - 1), _REENCODER_KERNEL_GENERAL);
+	}
+
+	// nothing to sample keeps the current kernel
+	assert_int_equal(_reencoder_kernel_select(UTF_8, "", 0), _REENCODER_KERNEL_GENERAL);
+}
+
+void _reencoder_test_kernel_convert(void** state) {
+	(void)state;
+
+	const void* sources[] = {
+		_reencoder_test_string_utf_8_valid_long_sequence, _reencoder_test_string_utf_8_valid_3_byte, _reencoder_test_string_utf_8_valid_4_byte,
+		_reencoder_test_string_utf_16_u16_valid_long_sequence, _reencoder_test_string_utf_16_u16_valid_4_byte,
+		_reencoder_test_string_utf_32_u32_valid_long_sequence, _reencoder_test_string_utf_32_u32_valid
+	};
+	const enum ReencoderEncodeType source_encodings[] = { UTF_8, UTF_8, UTF_8, UTF_16LE, UTF_16LE, UTF_32LE, UTF_32LE };
+	const size_t source_units[] = {
+		sizeof(_reencoder_test_string_utf_8_valid_long_sequence) - 1, sizeof(_reencoder_test_string_utf_8_valid_3_byte) - 1, sizeof(_reencoder_test_string_utf_8_valid_4_byte) - 1,
+		(sizeof(_reencoder_test_string_utf_16_u16_valid_long_sequence) / sizeof(uint16_t)) - 1, (sizeof(_reencoder_test_string_utf_16_u16_valid_4_byte) / sizeof(uint16_t)) - 1,
+		(sizeof(_reencoder_test_string_utf_32_u32_valid_long_sequence) / sizeof(uint32_t)) - 1, (sizeof(_reencoder_test_string_utf_32_u32_valid) / sizeof(uint32_t)) - 1
+	};
+	const enum ReencoderEncodeType target_encodings[] = { UTF_8, UTF_16LE, UTF_32LE };
+	const unsigned int kernels[] = { _REENCODER_KERNEL_GENERAL, _REENCODER_KERNEL_ASCII, _REENCODER_KERNEL_SUPPLEMENTARY };
+
+	// every kernel writes exactly what the scalar conversion writes, for every pair of code unit sizes
+	for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+		for (size_t j = 0; j < sizeof(target_encodings) / sizeof(target_encodings[0]); j++) {
+			if (_reencoder_code_unit_size(source_encodings[i]) == _reencoder_code_unit_size(target_encodings[j])) {
+				continue;
+			}
+
+			size_t expected_index = 0;
+			size_t expected_size = 0;
+			void* expected_buffer = NULL;
+			assert_int_equal(_reencoder_change_encoding_dynamic(
+				source_encodings[i], target_encodings[j], source_units[i], &expected_index, &expected_size, sources[i], &expected_buffer, SIZE_MAX
+			), REENCODER_CONVERT_SUCCESS);
+
+			for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+				_reencoder_test_kernel_prime(source_encodings[i], kernels[k]);
+
+				size_t actual_index = 0;
+				size_t actual_size = 0;
+				void* actual_buffer = NULL;
+				unsigned int kernel = 0;
+				assert_int_equal(_reencoder_kernel_convert(
+					source_encodings[i], target_encodings[j], source_units[i], &actual_index, &actual_size, sources[i], &actual_buffer, SIZE_MAX, &kernel
+				), REENCODER_CONVERT_SUCCESS);
+				assert_int_equal(kernel, kernels[k]);
+				assert_int_equal(actual_index, expected_index);
+				assert_memory_equal(actual_buffer, expected_buffer, (expected_index + 1) * _reencoder_code_unit_size(target_encodings[j]));
+				free(actual_buffer);
+			}
+
+			free(expected_buffer);
+		}
+	}
+
+	// ASCII runs stop at the cap like single characters do
+	size_t output_index = 0;
+	size_t output_size = 0;
+	void* output_buffer = NULL;
+	_reencoder_test_kernel_prime(UTF_8, _REENCODER_KERNEL_ASCII);
+	assert_int_equal(_reencoder_kernel_convert(
+		UTF_8, UTF_32LE, sizeof(_reencoder_test_string_utf_8_valid_long_sequence) - 1, &output_index, &output_size, _reencoder_test_string_utf_8_valid_long_sequence, &output_buffer, 100, NULL
+	), REENCODER_CONVERT_FAILURE_TOO_LARGE);
+	assert_true(output_index <= (100 / sizeof(uint32_t)) + 1);
+	free(output_buffer);
+}
+
+void _reencoder_test_char_flags(void** state) {
+	(void)state;
+
+	const unsigned int flags_ascii = REENCODER_CHARS_ASCII | REENCODER_CHARS_LATIN1 | REENCODER_CHARS_BMP;
+	const unsigned int flags_latin1 = REENCODER_CHARS_LATIN1 | REENCODER_CHARS_BMP;
+
+	// café ÿ
+	const uint8_t string_utf_8_latin1[] = { 0x63, 0x61, 0x66, 0xc3, 0xa9, 0x20, 0xc3, 0xbf, 0x00 };
+	const uint8_t* sources_utf_8[] = {
+		_reencoder_test_string_utf_8_valid_1_byte, string_utf_8_latin1, _reencoder_test_string_utf_8_valid_2_byte, _reencoder_test_string_utf_8_valid_4_byte
+	};
+	const unsigned int flags_utf_8[] = { flags_ascii, flags_latin1, REENCODER_CHARS_BMP, 0 };
+	const size_t num_chars_utf_8[] = { 61, 6, 68, 61 };
+	for (size_t i = 0; i < sizeof(sources_utf_8) / sizeof(sources_utf_8[0]); i++) {
+		ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse(sources_utf_8[i]);
+		assert_non_null(struct_actual);
+		assert_int_equal(struct_actual->char_flags, flags_utf_8[i]);
+		assert_int_equal(struct_actual->num_chars, num_chars_utf_8[i]);
+
+		ReencoderUnicodeStruct* struct_duplicate = reencoder_unicode_struct_duplicate(struct_actual);
+		assert_non_null(struct_duplicate);
+		assert_int_equal(struct_duplicate->char_flags, flags_utf_8[i]);
+		reencoder_unicode_struct_free(&struct_duplicate);
+		reencoder_unicode_struct_free(&struct_actual);
+	}
+
+	// surrogate pairs take UTF-16 out of the BMP, and UTF-16 read from bytes is flagged the same as UTF-16 read from units
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf16_parse_uint16(_reencoder_test_string_utf_16_u16_valid_2_byte, UTF_16LE);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->char_flags, flags_ascii);
+	assert_int_equal(struct_actual->num_chars, 62);
+	reencoder_unicode_struct_free(&struct_actual);
+	struct_actual = reencoder_utf16_parse_uint8(_reencoder_test_string_utf_16_u8be_valid_2_byte, sizeof(_reencoder_test_string_utf_16_u8be_valid_2_byte) - sizeof(uint16_t), UTF_16BE, UTF_16LE);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->char_flags, flags_ascii);
+	assert_int_equal(struct_actual->num_chars, 62);
+	reencoder_unicode_struct_free(&struct_actual);
+	struct_actual = reencoder_utf16_parse_uint16(_reencoder_test_string_utf_16_u16_valid_4_byte, UTF_16BE);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->char_flags, 0);
+	assert_int_equal(struct_actual->num_chars, 62);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	// conversions keep the characters, so the flags carry over to the target encoding
+	const uint32_t string_utf_32_bmp[] = { 0x4e2d, 0x0061, 0x00e9, 0xfffd, 0x0000 };
+	struct_actual = reencoder_utf32_parse_uint32(string_utf_32_bmp, UTF_32LE);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->char_flags, REENCODER_CHARS_BMP);
+	reencoder_unicode_struct_free(&struct_actual);
+	struct_actual = reencoder_convert(UTF_8, UTF_16LE, string_utf_8_latin1);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->char_flags, flags_latin1);
+	assert_int_equal(struct_actual->num_chars, 6);
+	reencoder_unicode_struct_free(&struct_actual);
+	struct_actual = reencoder_convert(UTF_8, UTF_8, _reencoder_test_string_utf_8_valid_1_byte);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->char_flags, flags_ascii);
+	assert_int_equal(struct_actual->num_chars, 61);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	// invalid strings have no flags
+	const uint8_t string_utf_8_broken[] = { 0x41, 0x80, 0x42, 0x00 };
+	struct_actual = reencoder_utf8_parse(string_utf_8_broken);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->char_flags, 0);
+	reencoder_unicode_struct_free(&struct_actual);
+}
+
+void _reencoder_test_char_flags_after_repair(void** state) {
+	(void)state;
+
+	// the replacement character (U+FFFD) is in the BMP, but not in Latin-1
+	const uint8_t string_utf_8_broken[] = { 0x41, 0x80, 0x42, 0x00 };
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse(string_utf_8_broken);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_int_equal(struct_actual->char_flags, REENCODER_CHARS_BMP);
+	assert_int_equal(struct_actual->num_chars, 3);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 2), 4);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	// characters above U+FFFF in the valid runs are kept, and so is their range
+	const uint8_t string_utf_8_broken_4_byte[] = { 0xf0, 0x9f, 0x98, 0x80, 0xff, 0x00 };
+	struct_actual = reencoder_utf8_parse(string_utf_8_broken_4_byte);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_int_equal(struct_actual->char_flags, 0);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	// UTF-16 and UTF-32 are repaired in place, in either byte order
+	const uint16_t string_utf_16_broken[] = { 0x0041, 0xdc00, 0x00e9, 0x0000 };
+	struct_actual = reencoder_utf16_parse_uint16(string_utf_16_broken, UTF_16BE);
+	assert_non_null(struct_actual);
+	assert_int_equal(struct_actual->char_flags, 0);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_int_equal(struct_actual->char_flags, REENCODER_CHARS_BMP);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 3), 6);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	const uint16_t string_utf_16_broken_pair[] = { 0xd83d, 0xde00, 0xd800, 0x0000 };
+	struct_actual = reencoder_utf16_parse_uint16(string_utf_16_broken_pair, UTF_16LE);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_int_equal(struct_actual->char_flags, 0);
+	assert_int_equal(struct_actual->num_chars, 2);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	const uint32_t string_utf_32_broken[] = { 0x0041, 0x110000, 0x0000 };
+	struct_actual = reencoder_utf32_parse_uint32(string_utf_32_broken, UTF_32LE);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_int_equal(struct_actual->char_flags, REENCODER_CHARS_BMP);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	// a repaired string takes the same conversion paths its flags allow as a parsed one
+	struct_actual = reencoder_utf16_parse_uint16(string_utf_16_broken, reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_true(_reencoder_kernel_has_trivial_path(UTF_16LE, UTF_32LE, struct_actual->char_flags));
+	assert_false(_reencoder_kernel_has_trivial_path(UTF_16LE, UTF_8, struct_actual->char_flags));
+	reencoder_unicode_struct_free(&struct_actual);
+}
+
+void _reencoder_test_convert_trivial(void** state) {
+	(void)state;
+
+	// café ÿ, and BMP text mixing CJK, ASCII, Latin-1 and U+FFFD
+	const uint8_t string_utf_8_latin1[] = { 0x63, 0x61, 0x66, 0xc3, 0xa9, 0x20, 0xc3, 0xbf, 0x00 };
+	const uint16_t string_utf_16_latin1[] = { 0x0063, 0x0061, 0x0066, 0x00e9, 0x0020, 0x00ff, 0x0000 };
+	const uint16_t string_utf_16_bmp[] = { 0x4e2d, 0x0061, 0x00e9, 0xfffd, 0x0000 };
+	const uint32_t string_utf_32_bmp[] = { 0x4e2d, 0x0061, 0x00e9, 0xfffd, 0x0000 };
+
+	const void* sources[] = {
+		_reencoder_test_string_utf_8_valid_long_sequence, string_utf_8_latin1, _reencoder_test_string_utf_16_u16_valid_2_byte, string_utf_16_latin1,
+		string_utf_16_bmp, string_utf_32_bmp, _reencoder_test_string_utf_8_valid_2_byte, _reencoder_test_string_utf_16_u16_valid_4_byte
+	};
+	const enum ReencoderEncodeType source_encodings[] = { UTF_8, UTF_8, UTF_16LE, UTF_16LE, UTF_16LE, UTF_32LE, UTF_8, UTF_16LE };
+	const size_t source_units[] = {
+		sizeof(_reencoder_test_string_utf_8_valid_long_sequence) - 1, sizeof(string_utf_8_latin1) - 1,
+		(sizeof(_reencoder_test_string_utf_16_u16_valid_2_byte) / sizeof(uint16_t)) - 1, (sizeof(string_utf_16_latin1) / sizeof(uint16_t)) - 1,
+		(sizeof(string_utf_16_bmp) / sizeof(uint16_t)) - 1, (sizeof(string_utf_32_bmp) / sizeof(uint32_t)) - 1,
+		sizeof(_reencoder_test_string_utf_8_valid_2_byte) - 1, (sizeof(_reencoder_test_string_utf_16_u16_valid_4_byte) / sizeof(uint16_t)) - 1
+	};
+	// number of targets (of UTF-8, UTF-16, UTF-32) each source has a trivial path to
+	const size_t num_trivial_paths[] = { 2, 2, 2, 2, 1, 1, 0, 0 };
+	const enum ReencoderEncodeType target_encodings[] = { UTF_8, UTF_16LE, UTF_32LE };
+
+	// the trivial path writes exactly what the scalar conversion writes
+	for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+		unsigned int char_flags = 0;
+		if (source_encodings[i] == UTF_8) {
+			assert_int_equal(_reencoder_utf8_seq_is_valid((const uint8_t*)sources[i], &char_flags), REENCODER_UTF8_VALID);
+		}
+		else if (source_encodings[i] == UTF_16LE) {
+			assert_int_equal(_reencoder_utf16_seq_is_valid((const uint16_t*)sources[i], source_units[i], &char_flags), REENCODER_UTF16_VALID);
+		}
+		else {
+			assert_int_equal(_reencoder_utf32_seq_is_valid((const uint32_t*)sources[i], source_units[i], &char_flags), REENCODER_UTF32_VALID);
+		}
+
+		size_t trivial_paths = 0;
+		for (size_t j = 0; j < sizeof(target_encodings) / sizeof(target_encodings[0]); j++) {
+			if (!_reencoder_kernel_has_trivial_path(source_encodings[i], target_encodings[j], char_flags)) {
+				continue;
+			}
+			trivial_paths++;
+
+			size_t expected_index = 0;
+			size_t expected_size = 0;
+			void* expected_buffer = NULL;
+			assert_int_equal(_reencoder_change_encoding_dynamic(
+				source_encodings[i], target_encodings[j], source_units[i], &expected_index, &expected_size, sources[i], &expected_buffer, SIZE_MAX
+			), REENCODER_CONVERT_SUCCESS);
+
+			size_t actual_index = 0;
+			size_t actual_size = 0;
+			void* actual_buffer = NULL;
+			assert_int_equal(_reencoder_kernel_convert_trivial(
+				source_encodings[i], target_encodings[j], char_flags, source_units[i], &actual_index, &actual_size, sources[i], &actual_buffer, SIZE_MAX
+			), REENCODER_CONVERT_SUCCESS);
+			assert_int_equal(actual_index, expected_index);
+			assert_memory_equal(actual_buffer, expected_buffer, (expected_index + 1) * _reencoder_code_unit_size(target_encodings[j]));
+
+			free(actual_buffer);
+			free(expected_buffer);
+		}
+		assert_int_equal(trivial_paths, num_trivial_paths[i]);
+	}
+
+	// widening stops at the cap before writing anything, Latin-1 into UTF-8 as soon as it passes it
+	size_t output_index = 0;
+	size_t output_size = 0;
+	void* output_buffer = NULL;
+	assert_int_equal(_reencoder_kernel_convert_trivial(
+		UTF_8, UTF_32LE, REENCODER_CHARS_ASCII | REENCODER_CHARS_LATIN1 | REENCODER_CHARS_BMP, sizeof(_reencoder_test_string_utf_8_valid_long_sequence) - 1,
+		&output_index, &output_size, _reencoder_test_string_utf_8_valid_long_sequence, &output_buffer, 100
+	), REENCODER_CONVERT_FAILURE_TOO_LARGE);
+	assert_int_equal(output_index, 0);
+	assert_int_equal(_reencoder_kernel_convert_trivial(
+		UTF_16LE, UTF_8, REENCODER_CHARS_LATIN1 | REENCODER_CHARS_BMP, (sizeof(string_utf_16_latin1) / sizeof(uint16_t)) - 1,
+		&output_index, &output_size, string_utf_16_latin1, &output_buffer, 4
+	), REENCODER_CONVERT_FAILURE_TOO_LARGE);
+	assert_int_equal(output_index, 5);
+	free(output_buffer);
+}
+
+void _reencoder_test_char_offset(void** state) {
+	(void)state;
+
+	// one byte per character
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse(_reencoder_test_string_utf_8_valid_1_byte);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 5), 5);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, struct_actual->num_chars), struct_actual->num_bytes);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, struct_actual->num_chars + 1), SIZE_MAX);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	// 以 utf-8 ...
+	struct_actual = reencoder_utf8_parse(_reencoder_test_string_utf_8_valid_3_byte);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 0), 0);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 1), 3);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 2), 4);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, struct_actual->num_chars), struct_actual->num_bytes);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	// surrogate pair, space, surrogate pair, in either byte order
+	const enum ReencoderEncodeType encodings_utf_16[] = { UTF_16LE, UTF_16BE };
+	for (size_t i = 0; i < sizeof(encodings_utf_16) / sizeof(encodings_utf_16[0]); i++) {
+		struct_actual = reencoder_utf16_parse_uint16(_reencoder_test_string_utf_16_u16_valid_4_byte, encodings_utf_16[i]);
+		assert_non_null(struct_actual);
+		assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 1), 4);
+		assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 2), 6);
+		assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, struct_actual->num_chars), struct_actual->num_bytes);
+		reencoder_unicode_struct_free(&struct_actual);
+	}
+
+	struct_actual = reencoder_utf16_parse_uint16(_reencoder_test_string_utf_16_u16_valid_2_byte, UTF_16BE);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 10), 20);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	struct_actual = reencoder_utf32_parse_uint32(_reencoder_test_string_utf_32_u32_valid, UTF_32BE);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 3), 12);
+	reencoder_unicode_struct_free(&struct_actual);
+
+	// invalid strings cannot be indexed until they are repaired, after which they are walked
+	const uint8_t string_utf_8_broken[] = { 0x41, 0x80, 0x42, 0x00 };
+	struct_actual = reencoder_utf8_parse(string_utf_8_broken);
+	assert_non_null(struct_actual);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 0), SIZE_MAX);
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 1), 1);
+	assert_int_equal(reencoder_unicode_struct_char_offset(struct_actual, 2), 4);
+	reencoder_unicode_struct_free(&struct_actual);
+	assert_int_equal(reencoder_unicode_struct_char_offset(NULL, 0), SIZE_MAX);
+}
+
+static void _reencoder_test_kernel_prime(enum ReencoderEncodeType source_encoding, unsigned int kernel) {
+	uint32_t code_point = kernel == _REENCODER_KERNEL_ASCII ? 0x61 : (kernel == _REENCODER_KERNEL_SUPPLEMENTARY ? 0x1F170 : 0x0434);
+
+	uint8_t units_utf_8[8 * 4];
+	uint16_t units_utf_16[8 * 2];
+	uint32_t units_utf_32[8];
+	size_t num_units = 0;
+	for (size_t i = 0; i < 8; i++) {
+		if (source_encoding == UTF_8) {
+			num_units += _reencoder_utf8_encode_from_code_point(units_utf_8, num_units, code_point);
+		}
+		else if (source_encoding == UTF_16BE || source_encoding == UTF_16LE) {
+			num_units += _reencoder_utf16_encode_from_code_point(units_utf_16, num_units, code_point);
+		}
+		else {
+			num_units += _reencoder_utf32_encode_from_code_point(units_utf_32, num_units, code_point);
+		}
+	}
+
+	const void* units = source_encoding == UTF_8 ? (const void*)units_utf_8 : (source_encoding == UTF_16BE || source_encoding == UTF_16LE ? (const void*)units_utf_16 : (const void*)units_utf_32);
+	for (size_t i = 0; i < 32; i++) {
+		_reencoder_kernel_select(source_encoding, units, num_units);
+	}
+	assert_int_equal(_reencoder_kernel_select(source_encoding, units, num_units), kernel);
+}
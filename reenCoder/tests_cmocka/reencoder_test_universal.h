@@ -5,13 +5,94 @@
 #include <setjmp.h>
 #include <cmocka.h>
 #include "reencoder_test_utf_definitions.h"
+#include "reencoder_test_utf_8.h"
+#include "reencoder_test_utf_16.h"
+#include "../headers/reencoder_batch.h"
+#include "../headers/reencoder_validate.h"
+#include "../headers/reencoder_kernel.h"
 
 // Struct operations
 void _reencoder_test_free_struct(void** state);
 void _reencoder_test_duplicate_struct(void** state);
+void _reencoder_test_duplicate_shares_buffer(void** state);
+void _reencoder_test_duplicate_copy_on_write(void** state);
+
+// Arena operations
+void _reencoder_test_arena_parse(void** state);
+void _reencoder_test_arena_convert(void** state);
+void _reencoder_test_arena_repair(void** state);
+void _reencoder_test_arena_reset_reuses_memory(void** state);
+void _reencoder_test_arena_oversized_allocation(void** state);
+void _reencoder_test_context_convert_reuses_scratch(void** state);
+void _reencoder_test_context_repair(void** state);
+void _reencoder_test_context_parse_odd_length(void** state);
+void _reencoder_test_context_memory_policy(void** state);
+void _reencoder_test_context_max_expansion(void** state);
+void _reencoder_test_shrink_after_repair(void** state);
+
+// Batch operations
+void _reencoder_test_convert_batch(void** state);
+void _reencoder_test_convert_batch_lengths(void** state);
+void _reencoder_test_thread_pool_run(void** state);
+void _reencoder_test_convert_batch_pool(void** state);
+
+// Validation
+void _reencoder_test_validate(void** state);
+void _reencoder_test_validate_parallel_utf_8(void** state);
+void _reencoder_test_validate_parallel_utf_16(void** state);
+void _reencoder_test_scan_errors(void** state);
+
+// Statistics
+void _reencoder_test_stats(void** state);
+void _reencoder_test_stats_histograms(void** state);
+
+// Conversion kernels
+void _reencoder_test_kernel_select(void** state);
+void _reencoder_test_kernel_convert(void** state);
+
+// Character flags
+void _reencoder_test_char_flags(void** state);
+void _reencoder_test_char_flags_after_repair(void** state);
+void _reencoder_test_convert_trivial(void** state);
+void _reencoder_test_char_offset(void** state);
 
 static struct CMUnitTest _reencoder_universal_test_array[] = {
 	// Struct operations
 	cmocka_unit_test(_reencoder_test_free_struct),
-	cmocka_unit_test(_reencoder_test_duplicate_struct)
+	cmocka_unit_test(_reencoder_test_duplicate_struct),
+	cmocka_unit_test(_reencoder_test_duplicate_shares_buffer),
+	cmocka_unit_test(_reencoder_test_duplicate_copy_on_write),
+	// Arena operations
+	cmocka_unit_test(_reencoder_test_arena_parse),
+	cmocka_unit_test(_reencoder_test_arena_convert),
+	cmocka_unit_test(_reencoder_test_arena_repair),
+	cmocka_unit_test(_reencoder_test_arena_reset_reuses_memory),
+	cmocka_unit_test(_reencoder_test_arena_oversized_allocation),
+	cmocka_unit_test(_reencoder_test_context_convert_reuses_scratch),
+	cmocka_unit_test(_reencoder_test_context_repair),
+	cmocka_unit_test(_reencoder_test_context_parse_odd_length),
+	cmocka_unit_test(_reencoder_test_context_memory_policy),
+	cmocka_unit_test(_reencoder_test_context_max_expansion),
+	cmocka_unit_test(_reencoder_test_shrink_after_repair),
+	// Batch operations
+	cmocka_unit_test(_reencoder_test_convert_batch),
+	cmocka_unit_test(_reencoder_test_convert_batch_lengths),
+	cmocka_unit_test(_reencoder_test_thread_pool_run),
+	cmocka_unit_test(_reencoder_test_convert_batch_pool),
+	// Validation
+	cmocka_unit_test(_reencoder_test_validate),
+	cmocka_unit_test(_reencoder_test_validate_parallel_utf_8),
+	cmocka_unit_test(_reencoder_test_validate_parallel_utf_16),
+	cmocka_unit_test(_reencoder_test_scan_errors),
+	// Statistics
+	cmocka_unit_test(_reencoder_test_stats),
+	cmocka_unit_test(_reencoder_test_stats_histograms),
+	// Conversion kernels
+	cmocka_unit_test(_reencoder_test_kernel_select),
+	cmocka_unit_test(_reencoder_test_kernel_convert),
+	// Character flags
+	cmocka_unit_test(_reencoder_test_char_flags),
+	cmocka_unit_test(_reencoder_test_char_flags_after_repair),
+	cmocka_unit_test(_reencoder_test_convert_trivial),
+	cmocka_unit_test(_reencoder_test_char_offset)
 };
@@ -164,6 +164,21 @@ void _reencoder_test_invalid_utf_16_u8be_only_low_surrogate_sequence(void** stat
 	*state = struct_actual;
 }
 
+void _reencoder_test_valid_utf_16_u8be_unaligned(void** state) {
+	(void)state;
+
+	// start the input one byte into the buffer so no code unit is aligned to 2 bytes
+	uint8_t unaligned_buffer[_REENCODER_TEST_NUM_BYTES_UTF_16_VALID_LONG_SEQUENCE + 1] = { 0x00 };
+	memcpy(unaligned_buffer + 1, _reencoder_test_string_utf_16_u8be_valid_long_sequence, _REENCODER_TEST_NUM_BYTES_UTF_16_VALID_LONG_SEQUENCE);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf16_parse_uint8(
+		unaligned_buffer + 1, _reencoder_test_struct_utf_16_le_valid_long_sequence.num_bytes, UTF_16BE, UTF_16LE
+	);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_16_le_valid_long_sequence, struct_actual);
+
+	*state = struct_actual;
+}
+
 void _reencoder_test_valid_utf_16_from_utf_8(void** state) {
 	(void)state;
 
@@ -185,6 +200,20 @@ void _reencoder_test_valid_utf_16_from_utf_32(void** state) {
 	*state = struct_actual;
 }
 
+void _reencoder_test_valid_utf_16_be_from_utf_16(void** state) {
+	(void)state;
+
+	// same code unit width, only the byte order changes
+	ReencoderUnicodeStruct* struct_actual = reencoder_convert(
+		reencoder_is_system_little_endian() ? UTF_16LE : UTF_16BE, UTF_16BE, _reencoder_test_string_utf_16_u16_valid_long_sequence
+	);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_16_be_valid_long_sequence, struct_actual);
+	assert_int_equal(struct_actual->string_buffer[struct_actual->num_bytes], 0x00);
+	assert_int_equal(struct_actual->string_buffer[struct_actual->num_bytes + 1], 0x00);
+
+	*state = struct_actual;
+}
+
 void _reencoder_test_invalid_utf_16_from_utf_8(void** state) {
 	(void)state;
 
@@ -219,6 +248,67 @@ void _reencoder_test_fix_utf_16(void** state) {
 	*state = struct_actual;
 }
 
+void _reencoder_test_fix_utf_16_be_in_place(void** state) {
+	(void)state;
+
+	// drop the trailing odd byte so the string stays big-endian, then build the expected output by swapping the fixed LE string
+	size_t num_bytes = _reencoder_test_struct_utf_16_repair_fixed.num_bytes - sizeof(uint16_t);
+	uint8_t expected_buffer[sizeof(_reencoder_test_string_utf_16_repair_fixed)] = { 0x00 };
+	for (size_t i = 0; i < num_bytes; i += sizeof(uint16_t)) {
+		expected_buffer[i] = _reencoder_test_string_utf_16_repair_fixed[i + 1];
+		expected_buffer[i + 1] = _reencoder_test_string_utf_16_repair_fixed[i];
+	}
+	ReencoderUnicodeStruct struct_expected = {
+		.string_type = UTF_16BE,
+		.string_validity = REENCODER_UTF16_VALID_REPAIRED,
+		.num_bytes = num_bytes,
+		.num_chars = _reencoder_test_struct_utf_16_repair_fixed.num_chars - 1,
+		.string_buffer = expected_buffer
+	};
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf16_parse_uint8(_reencoder_test_string_utf_16_repair_broken, num_bytes, UTF_16LE, UTF_16BE);
+	assert_non_null(struct_actual);
+	uint8_t* buffer_before = struct_actual->string_buffer;
+
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	_reencoder_test_struct_equal(&struct_expected, struct_actual);
+	assert_ptr_equal(struct_actual->string_buffer, buffer_before);
+
+	*state = struct_actual;
+}
+
+void _reencoder_test_host_order_utf_16_be(void** state) {
+	(void)state;
+
+	ReencoderContext* ctx = reencoder_context_create(NULL);
+	assert_non_null(ctx);
+	reencoder_context_set_host_order_storage(ctx, 1);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf16_parse_uint8_ctx(
+		ctx, _reencoder_test_string_utf_16_u8be_valid_long_sequence, _reencoder_test_struct_utf_16_be_valid_long_sequence.num_bytes, UTF_16BE, UTF_16BE
+	);
+	reencoder_context_destroy(&ctx);
+	assert_non_null(struct_actual);
+
+	// logically UTF-16BE, but held in system byte order
+	assert_int_equal(struct_actual->string_type, UTF_16BE);
+	assert_true(struct_actual->is_host_order);
+	assert_int_equal(struct_actual->num_chars, _reencoder_test_struct_utf_16_be_valid_long_sequence.num_chars);
+	assert_memory_equal(struct_actual->string_buffer, _reencoder_test_string_utf_16_u16_valid_long_sequence, struct_actual->num_bytes);
+
+	// writing out applies the byte order of string_type
+	uint8_t write_buffer[_REENCODER_TEST_NUM_BYTES_UTF_16_VALID_LONG_SEQUENCE] = { 0x00 };
+	size_t bytes_written = reencoder_write_to_buffer(struct_actual, write_buffer, 0);
+	_reencoder_test_buffer_equal(&_reencoder_test_struct_utf_16_be_valid_long_sequence, write_buffer, bytes_written, 0);
+
+	assert_int_equal(reencoder_unicode_struct_materialize(struct_actual), REENCODER_MATERIALIZE_SUCCESS);
+	assert_false(struct_actual->is_host_order);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_16_be_valid_long_sequence, struct_actual);
+	assert_int_equal(reencoder_unicode_struct_materialize(struct_actual), REENCODER_MATERIALIZE_FAILURE_NO_OP);
+
+	*state = struct_actual;
+}
+
 void _reencoder_test_write_utf_16_le_w_bom_to_buffer(void** state) {
 	(void)state;
 
@@ -94,15 +94,21 @@ void _reencoder_test_valid_utf_16_u8be_valid_4_byte(void** state);
 void _reencoder_test_valid_utf_16_u8be_valid_long_sequence(void** state);
 void _reencoder_test_invalid_utf_16_u8be_only_high_surrogate_sequence(void** state);
 void _reencoder_test_invalid_utf_16_u8be_only_low_surrogate_sequence(void** state);
+void _reencoder_test_valid_utf_16_u8be_unaligned(void** state);
 
 // Other encodings to UTF-16
 void _reencoder_test_valid_utf_16_from_utf_8(void** state);
 void _reencoder_test_valid_utf_16_from_utf_32(void** state);
+void _reencoder_test_valid_utf_16_be_from_utf_16(void** state);
 void _reencoder_test_invalid_utf_16_from_utf_8(void** state);
 void _reencoder_test_invalid_utf_16_from_utf_32(void** state);
 
 // Repairs
 void _reencoder_test_fix_utf_16(void** state);
+void _reencoder_test_fix_utf_16_be_in_place(void** state);
+
+// Host-order storage
+void _reencoder_test_host_order_utf_16_be(void** state);
 
 // Write-outs
 void _reencoder_test_write_utf_16_le_w_bom_to_buffer(void** state);
@@ -134,13 +140,18 @@ static struct CMUnitTest _reencoder_utf_16_test_array[] = {
 	cmocka_unit_test_teardown(_reencoder_test_valid_utf_16_u8be_valid_long_sequence, _reencoder_test_teardown_struct),
 	cmocka_unit_test_teardown(_reencoder_test_invalid_utf_16_u8be_only_high_surrogate_sequence, _reencoder_test_teardown_struct),
 	cmocka_unit_test_teardown(_reencoder_test_invalid_utf_16_u8be_only_low_surrogate_sequence, _reencoder_test_teardown_struct),
+	cmocka_unit_test_teardown(_reencoder_test_valid_utf_16_u8be_unaligned, _reencoder_test_teardown_struct),
 	// Other encodings to UTF-16
 	cmocka_unit_test_teardown(_reencoder_test_valid_utf_16_from_utf_8, _reencoder_test_teardown_struct),
 	cmocka_unit_test_teardown(_reencoder_test_valid_utf_16_from_utf_32, _reencoder_test_teardown_struct),
+	cmocka_unit_test_teardown(_reencoder_test_valid_utf_16_be_from_utf_16, _reencoder_test_teardown_struct),
 	cmocka_unit_test_teardown(_reencoder_test_invalid_utf_16_from_utf_8, _reencoder_test_teardown_struct),
 	cmocka_unit_test_teardown(_reencoder_test_invalid_utf_16_from_utf_32, _reencoder_test_teardown_struct),
 	// Repairs
 	cmocka_unit_test_teardown(_reencoder_test_fix_utf_16, _reencoder_test_teardown_struct),
+	cmocka_unit_test_teardown(_reencoder_test_fix_utf_16_be_in_place, _reencoder_test_teardown_struct),
+	// Host-order storage
+	cmocka_unit_test_teardown(_reencoder_test_host_order_utf_16_be, _reencoder_test_teardown_struct),
 	// Write-outs
 	cmocka_unit_test(_reencoder_test_write_utf_16_le_w_bom_to_buffer),
 	cmocka_unit_test(_reencoder_test_write_utf_16_le_wo_bom_to_buffer),
@@ -123,6 +123,21 @@ void _reencoder_test_invalid_utf_32_u8be_out_of_range(void** state) {
 	*state = struct_actual;
 }
 
+void _reencoder_test_valid_utf_32_u8be_unaligned(void** state) {
+	(void)state;
+
+	// start the input one byte into the buffer so no code unit is aligned to 4 bytes
+	uint8_t unaligned_buffer[_REENCODER_TEST_NUM_BYTES_UTF_32_VALID_LONG_SEQUENCE + 1] = { 0x00 };
+	memcpy(unaligned_buffer + 1, _reencoder_test_string_utf_32_u8be_valid_long_sequence, _REENCODER_TEST_NUM_BYTES_UTF_32_VALID_LONG_SEQUENCE);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf32_parse_uint8(
+		unaligned_buffer + 1, _reencoder_test_struct_utf_32_le_valid_long_sequence.num_bytes, UTF_32BE, UTF_32LE
+	);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_32_le_valid_long_sequence, struct_actual);
+
+	*state = struct_actual;
+}
+
 void _reencoder_test_valid_utf_32_from_utf_8(void** state) {
 	(void)state;
 
@@ -145,6 +160,20 @@ void _reencoder_test_valid_utf_32_from_utf_16(void** state) {
 	*state = struct_actual;
 }
 
+void _reencoder_test_valid_utf_32_be_from_utf_32(void** state) {
+	(void)state;
+
+	// same code unit width, only the byte order changes
+	ReencoderUnicodeStruct* struct_actual = reencoder_convert(
+		reencoder_is_system_little_endian() ? UTF_32LE : UTF_32BE, UTF_32BE, _reencoder_test_string_utf_32_u32_valid_long_sequence
+	);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_32_be_valid_long_sequence, struct_actual);
+	const uint8_t null_terminator[sizeof(uint32_t)] = { 0x00 };
+	assert_memory_equal(struct_actual->string_buffer + struct_actual->num_bytes, null_terminator, sizeof(uint32_t));
+
+	*state = struct_actual;
+}
+
 void _reencoder_test_invalid_utf_32_from_utf_8(void** state) {
 	(void)state;
 
@@ -179,6 +208,65 @@ void _reencoder_test_fix_utf_32(void** state) {
 	*state = struct_actual;
 }
 
+void _reencoder_test_fix_utf_32_be_in_place(void** state) {
+	(void)state;
+
+	// build the expected output by swapping the fixed LE string
+	size_t num_bytes = _reencoder_test_struct_utf_32_repair_fixed.num_bytes;
+	uint8_t expected_buffer[sizeof(_reencoder_test_string_utf_32_repair_fixed)] = { 0x00 };
+	for (size_t i = 0; i < num_bytes; i += sizeof(uint32_t)) {
+		for (size_t j = 0; j < sizeof(uint32_t); j++) {
+			expected_buffer[i + j] = _reencoder_test_string_utf_32_repair_fixed[i + (sizeof(uint32_t) - 1 - j)];
+		}
+	}
+	ReencoderUnicodeStruct struct_expected = {
+		.string_type = UTF_32BE,
+		.string_validity = REENCODER_UTF32_VALID_REPAIRED,
+		.num_bytes = num_bytes,
+		.num_chars = _reencoder_test_struct_utf_32_repair_fixed.num_chars,
+		.string_buffer = expected_buffer
+	};
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf32_parse_uint8(_reencoder_test_string_utf_32_repair_broken, num_bytes, UTF_32LE, UTF_32BE);
+	assert_non_null(struct_actual);
+	uint8_t* buffer_before = struct_actual->string_buffer;
+
+	assert_int_equal(reencoder_repair_struct(struct_actual), REENCODER_REPAIR_SUCCESS);
+	_reencoder_test_struct_equal(&struct_expected, struct_actual);
+	assert_ptr_equal(struct_actual->string_buffer, buffer_before);
+
+	*state = struct_actual;
+}
+
+void _reencoder_test_host_order_utf_32_be(void** state) {
+	(void)state;
+
+	ReencoderContext* ctx = reencoder_context_create(NULL);
+	assert_non_null(ctx);
+	reencoder_context_set_host_order_storage(ctx, 1);
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_convert_ctx(ctx, UTF_8, UTF_32BE, _reencoder_test_string_utf_8_valid_long_sequence);
+	reencoder_context_destroy(&ctx);
+	assert_non_null(struct_actual);
+
+	// logically UTF-32BE, but held in system byte order
+	assert_int_equal(struct_actual->string_type, UTF_32BE);
+	assert_true(struct_actual->is_host_order);
+	assert_int_equal(struct_actual->num_chars, _reencoder_test_struct_utf_32_be_valid_long_sequence.num_chars);
+	assert_memory_equal(struct_actual->string_buffer, _reencoder_test_string_utf_32_u32_valid_long_sequence, struct_actual->num_bytes);
+
+	// writing out applies the byte order of string_type, the long sequence spans several swap chunks
+	FILE* fp_tmp = tmpfile();
+	if (fp_tmp == NULL) {
+		fail_msg("%s", _REENCODER_TEST_FAIL_STRINGS[_REENCODER_TEST_FAIL_TEMP_FILE]);
+	}
+	size_t bytes_written = reencoder_write_to_file(struct_actual, fp_tmp, 1);
+	_reencoder_test_file_equal(&_reencoder_test_struct_utf_32_be_valid_long_sequence, fp_tmp, bytes_written, 1);
+	fclose(fp_tmp);
+
+	*state = struct_actual;
+}
+
 void _reencoder_test_write_utf_32_le_w_bom_to_buffer(void** state) {
 	(void)state;
 
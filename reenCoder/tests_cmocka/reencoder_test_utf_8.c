@@ -171,6 +171,16 @@ void _reencoder_test_fix_utf_8(void** state) {
 	*state = struct_actual;
 }
 
+void _reencoder_test_fix_utf_8_sparse(void** state) {
+	(void)state;
+
+	ReencoderUnicodeStruct* struct_actual = reencoder_utf8_parse(_reencoder_test_string_utf_8_repair_sparse_broken);
+	reencoder_repair_struct(struct_actual);
+	_reencoder_test_struct_equal(&_reencoder_test_struct_utf_8_repair_sparse_fixed, struct_actual);
+
+	*state = struct_actual;
+}
+
 void _reencoder_test_write_utf_8_w_bom_to_buffer(void** state) {
 	(void)state;
 
@@ -122,6 +122,14 @@ static ReencoderUnicodeStruct _reencoder_test_struct_utf_8_repair_fixed = {
 	.string_buffer = (uint8_t*)_reencoder_test_string_utf_8_repair_fixed
 };
 
+static ReencoderUnicodeStruct _reencoder_test_struct_utf_8_repair_sparse_fixed = {
+	.string_type = UTF_8,
+	.string_validity = REENCODER_UTF8_VALID_REPAIRED,
+	.num_bytes = 111,
+	.num_chars = 104,
+	.string_buffer = (uint8_t*)_reencoder_test_string_utf_8_repair_sparse_fixed
+};
+
 // UTF-8 self-checks
 void _reencoder_test_valid_utf_8_valid_1_byte(void** state);
 void _reencoder_test_valid_utf_8_valid_2_byte(void** state);
@@ -145,6 +153,7 @@ void _reencoder_test_invalid_utf_8_from_utf_32(void** state);
 
 // Repairs
 void _reencoder_test_fix_utf_8(void** state);
+void _reencoder_test_fix_utf_8_sparse(void** state);
 
 // Write-outs
 void _reencoder_test_write_utf_8_w_bom_to_buffer(void** state);
@@ -181,6 +190,7 @@ static struct CMUnitTest _reencoder_utf_8_test_array[] = {
 	cmocka_unit_test_teardown(_reencoder_test_invalid_utf_8_from_utf_32, _reencoder_test_teardown_struct),
 	// Repairs
 	cmocka_unit_test_teardown(_reencoder_test_fix_utf_8, _reencoder_test_teardown_struct),
+	cmocka_unit_test_teardown(_reencoder_test_fix_utf_8_sparse, _reencoder_test_teardown_struct),
 	// Write-outs
 	cmocka_unit_test(_reencoder_test_write_utf_8_w_bom_to_buffer),
 	cmocka_unit_test(_reencoder_test_write_utf_8_wo_bom_to_buffer),